@@ -12,8 +12,11 @@
 #include "driver/gpio.h"
 #include "product_pins.h"
 #include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
 #include <stdlib.h>
 #include <string.h>
+#include "boot_trace.h"
 
 #if defined(CONFIG_LILYGO_T_AMOLED_LITE_147) || \
     defined(CONFIG_LILYGO_T_DISPLAY_S3_AMOLED) || \
@@ -22,10 +25,27 @@
 
 #define SEND_BUF_SIZE           (16384)
 #define DEFAULT_SPI_HANDLER     (SPI3_HOST)
+#define READ_SCK_SPEED          (5000000)
+#define INIT_MAX_PASSES         (3)
+#define INIT_BATCH_SIZE         (16)
+
+#define LCD_CMD_RDDPM           (0x0A)
+#define LCD_CMD_RDDCOLMOD       (0x0C)
+#define LCD_CMD_COLMOD          (0x3A)
+#define LCD_CMD_SLPIN           (0x10)
+#define LCD_CMD_SLPOUT          (0x11)
+#define LCD_CMD_DISPOFF         (0x28)
+#define LCD_CMD_DISPON          (0x29)
+#define LCD_CMD_IDMOFF          (0x38)
+#define LCD_CMD_IDMON           (0x39)
+#define SLPOUT_SETTLE_MS        (120)
+#define RDDPM_SLEEP_OUT         (0x10)
+#define RDDPM_DISPLAY_ON        (0x04)
 
 static const char *TAG = "AMOLED";
 static uint16_t *pBuffer = NULL;
 static spi_device_handle_t spi = NULL;
+static spi_device_handle_t spi_read = NULL;
 static uint8_t _brightness;
 
 #ifndef LOW
@@ -43,6 +63,7 @@ static uint8_t _brightness;
 
 
 void amoled_write_cmd(uint32_t cmd, uint8_t *pdat, uint32_t lenght);
+uint8_t amoled_read_cmd(uint32_t cmd);
 
 static bool __init_qspi_bus();
 
@@ -74,6 +95,114 @@ static void inline clrCS()
     digitalWrite(BOARD_DISP_CS, HIGH);
 }
 
+typedef enum {
+    INIT_VERIFIED,
+    INIT_MISMATCH,
+    INIT_UNVERIFIED,
+} __init_result_t;
+
+typedef struct {
+    spi_device_handle_t dev;
+    spi_transaction_t trans[INIT_BATCH_SIZE];
+    // The packed tables are const in flash, DMA reads the parameters from here
+    WORD_ALIGNED_ATTR uint8_t param[INIT_BATCH_SIZE][INIT_STREAM_MAX_PARAMS];
+    uint32_t next;
+    uint32_t pending;
+} __init_batch_t;
+
+static void __init_batch_wait(__init_batch_t *b)
+{
+    spi_transaction_t *done;
+    spi_device_get_trans_result(b->dev, &done, portMAX_DELAY);
+    b->pending--;
+}
+
+static void __init_batch_write(void *user, uint8_t cmd, const uint8_t *param, uint8_t len)
+{
+    __init_batch_t *b = (__init_batch_t *)user;
+    if (b->pending == INIT_BATCH_SIZE) {
+        __init_batch_wait(b);
+    }
+    spi_transaction_t *t = &b->trans[b->next];
+    uint8_t *buf = b->param[b->next];
+    b->next = (b->next + 1) % INIT_BATCH_SIZE;
+    memset(t, 0, sizeof(*t));
+    t->flags = (SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR);
+    t->cmd = 0x02;
+    t->addr = cmd << 8;
+    t->length = 8 * len;
+    // Copied out of the flash table, the slot stays untouched until its result is taken
+    if (len <= sizeof(t->tx_data)) {
+        t->flags |= SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, param, len);
+    } else {
+        memcpy(buf, param, len);
+        t->tx_buffer = buf;
+    }
+    spi_device_queue_trans(b->dev, t, portMAX_DELAY);
+    b->pending++;
+}
+
+static void __init_batch_flush(void *user)
+{
+    __init_batch_t *b = (__init_batch_t *)user;
+    while (b->pending) {
+        __init_batch_wait(b);
+    }
+}
+
+static void __init_single_write(void *user, uint8_t cmd, const uint8_t *param, uint8_t len)
+{
+    amoled_write_cmd(cmd << 8, (uint8_t *)param, len);
+}
+
+static void __send_init_sequence(spi_device_handle_t batch_dev)
+{
+    static __init_batch_t batch;
+    init_stream_ops_t ops = {
+        .write = __init_single_write,
+    };
+    if (batch_dev) {
+        memset(&batch, 0, sizeof(batch));
+        batch.dev = batch_dev;
+        ops.write = __init_batch_write;
+        ops.flush = __init_batch_flush;
+        ops.user = &batch;
+    }
+    init_stream_run(AMOLED_INIT_STREAM, &ops);
+}
+
+static __init_result_t __verify_init()
+{
+    if (!spi_read) {
+        return INIT_UNVERIFIED;
+    }
+
+    // Pixel format the table asked for, the last COLMOD write wins
+    int colmod = -1;
+    const uint8_t *param;
+    uint8_t len;
+    if (init_stream_find(AMOLED_INIT_STREAM, LCD_CMD_COLMOD, &param, &len) && len) {
+        colmod = param[0];
+    }
+
+    uint8_t dpm = amoled_read_cmd(LCD_CMD_RDDPM << 8);
+    uint8_t fmt = amoled_read_cmd(LCD_CMD_RDDCOLMOD << 8);
+    ESP_LOGD(TAG, "RDDPM:0x%02x RDDCOLMOD:0x%02x", dpm, fmt);
+
+    // A floating or unconnected read line returns all zeros or all ones
+    if ((dpm == 0x00 || dpm == 0xFF) && (fmt == 0x00 || fmt == 0xFF)) {
+        return INIT_UNVERIFIED;
+    }
+    if ((dpm & (RDDPM_SLEEP_OUT | RDDPM_DISPLAY_ON)) != (RDDPM_SLEEP_OUT | RDDPM_DISPLAY_ON)) {
+        return INIT_MISMATCH;
+    }
+    if (colmod >= 0 && (fmt & 0x07) != (colmod & 0x07)) {
+        return INIT_MISMATCH;
+    }
+    return INIT_VERIFIED;
+}
+
 void display_init()
 {
     __init_qspi_bus();
@@ -164,20 +293,53 @@ static bool __init_qspi_bus()
         ESP_LOGE(TAG, "spi_bus_add_device fail!");
         return false;
     }
-    // prevent initialization failure
-    int retry = 2;
-    while (retry--) {
-        const lcd_cmd_t *t = AMOLED_INIT_CMD;
-        for (uint32_t i = 0; i < AMOLED_INIT_CMD_LEN; i++) {
-            amoled_write_cmd(t[i].addr, (uint8_t *)t[i].param, t[i].len & 0x1F);
-            if (t[i].len & 0x80) {
-                delay(120);
-            }
-            if (t[i].len & 0x20) {
-                delay(10);
-            }
+    // Register reads run single line at a lower clock, the controllers do not read back at write speed
+    devcfg.clock_speed_hz = READ_SCK_SPEED;
+    ret = spi_bus_add_device(DEFAULT_SPI_HANDLER, &devcfg, &spi_read);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "read device unavailable, init sequence is not verified");
+        spi_read = NULL;
+    }
+
+    // While the table is sent CS is driven by the SPI peripheral, so commands can be queued
+    spi_device_handle_t spi_batch = NULL;
+    devcfg.clock_speed_hz = DEFAULT_SCK_SPEED;
+    devcfg.spics_io_num = BOARD_DISP_CS;
+    devcfg.queue_size = INIT_BATCH_SIZE;
+    if (spi_bus_add_device(DEFAULT_SPI_HANDLER, &devcfg, &spi_batch) != ESP_OK) {
+        spi_batch = NULL;
+    }
+
+    int64_t start = esp_timer_get_time();
+    int pass = 0;
+    __init_result_t result = INIT_UNVERIFIED;
+    while (pass < INIT_MAX_PASSES) {
+        pass++;
+        __send_init_sequence(spi_batch);
+        // Hand CS back to software for the readback, retries go out one command at a time
+        if (spi_batch) {
+            spi_bus_remove_device(spi_batch);
+            spi_batch = NULL;
+            pinMode(BOARD_DISP_CS, OUTPUT);
+            clrCS();
+        }
+        int span = boot_trace_begin("init_verify");
+        result = __verify_init();
+        boot_trace_end(span);
+        if (result == INIT_VERIFIED) {
+            break;
+        }
+        // Without a readable status fall back to the old blind second pass
+        if (result == INIT_UNVERIFIED && pass >= 2) {
+            break;
+        }
+        if (result == INIT_MISMATCH) {
+            ESP_LOGW(TAG, "init sequence pass %d not accepted, resending", pass);
         }
     }
+    ESP_LOGI(TAG, "init sequence %s after %d pass(es), %lld ms",
+             result == INIT_VERIFIED ? "verified" : result == INIT_MISMATCH ? "FAILED" : "unverified",
+             pass, (long long)((esp_timer_get_time() - start) / 1000));
     return true;
 }
 
@@ -210,6 +372,23 @@ void amoled_write_cmd(uint32_t cmd, uint8_t *pdat, uint32_t lenght)
     clrCS();
 }
 
+uint8_t amoled_read_cmd(uint32_t cmd)
+{
+    if (!spi_read) {
+        return 0;
+    }
+    setCS();
+    spi_transaction_t t;
+    memset(&t, 0, sizeof(t));
+    t.flags = SPI_TRANS_USE_RXDATA;
+    t.cmd = 0x03;
+    t.addr = cmd;
+    t.rxlength = 8;
+    spi_device_polling_transmit(spi_read, &t);
+    clrCS();
+    return t.rx_data[0];
+}
+
 void amoled_set_brightness(uint8_t level)
 {
     _brightness = level;
@@ -222,6 +401,25 @@ uint8_t amoled_get_brightness()
     return _brightness;
 }
 
+// Idle mode drops to 8 colours, the SH8501 runs it with the AOD timing of its init table
+void amoled_set_idle(bool on)
+{
+    amoled_write_cmd((on ? LCD_CMD_IDMON : LCD_CMD_IDMOFF) << 8, NULL, 0);
+}
+
+void amoled_sleep(bool on)
+{
+    if (on) {
+        amoled_write_cmd(LCD_CMD_DISPOFF << 8, NULL, 0);
+        amoled_write_cmd(LCD_CMD_SLPIN << 8, NULL, 0);
+    } else {
+        amoled_write_cmd(LCD_CMD_SLPOUT << 8, NULL, 0);
+        // Same settle as the init tables give 0x11, delay() rounds short waits to no tick
+        vTaskDelay(pdMS_TO_TICKS(SLPOUT_SETTLE_MS));
+        amoled_write_cmd(LCD_CMD_DISPON << 8, NULL, 0);
+    }
+}
+
 void amoled_set_window(uint16_t xs, uint16_t ys, uint16_t xe, uint16_t ye)
 {
 
@@ -8,6 +8,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "product_pins.h"
 
 #ifdef __cplusplus
@@ -24,6 +25,11 @@ void amoled_set_brightness(uint8_t level);
 
 uint8_t amoled_get_brightness();
 
+void amoled_set_idle(bool on);
+
+// SLPIN with the display off, the frame memory is kept
+void amoled_sleep(bool on);
+
 void amoled_set_window(uint16_t xs, uint16_t ys, uint16_t xe, uint16_t ye);
 
 void amoled_push_buffer(uint16_t *data, uint32_t len);
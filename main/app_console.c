@@ -0,0 +1,203 @@
+/**
+ * @file      app_console.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_console.h"
+#include "nvs.h"
+#include "esp_log.h"
+#include "pmu_telemetry.h"
+#include "boot_trace.h"
+#include "trace_ring.h"
+#include "touch_driver.h"
+#include "latency_probe.h"
+#include "i2c_sched.h"
+#include "i2c_driver.h"
+#include "display_pm.h"
+#include "render_cache.h"
+#include "app_console.h"
+
+#if CONFIG_LILYGO_CONSOLE
+
+static const char *TAG = "console";
+
+static int cmd_pmu(int argc, char **argv)
+{
+    esp_err_t ret = pmu_telemetry_dump();
+    if (ret != ESP_OK) {
+        printf("pmu: %s\n", esp_err_to_name(ret));
+        return 1;
+    }
+    return 0;
+}
+
+#if CONFIG_LILYGO_BOOT_TRACE
+static int cmd_boottrace(int argc, char **argv)
+{
+    boot_trace_export_json(stdout);
+    return 0;
+}
+#endif
+
+#if CONFIG_LILYGO_TRACE_RING
+static int cmd_trace(int argc, char **argv)
+{
+    trace_ring_dump(stdout);
+    return 0;
+}
+
+static int cmd_tracebin(int argc, char **argv)
+{
+    trace_ring_export(stdout);
+    return 0;
+}
+#endif
+
+#if CONFIG_LILYGO_LATENCY_PROBE
+static int cmd_latency(int argc, char **argv)
+{
+    latency_probe_print(stdout);
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        latency_probe_reset();
+    }
+    return 0;
+}
+#endif
+
+static int cmd_i2c(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "scan") == 0) {
+        i2c_drv_scan();
+        return 0;
+    }
+    i2c_sched_dump(stdout);
+    return 0;
+}
+
+#if CONFIG_LILYGO_DISPLAY_PM
+static int cmd_display(int argc, char **argv)
+{
+    display_pm_print(stdout);
+    return 0;
+}
+#endif
+
+#if CONFIG_LILYGO_RENDER_CACHE
+static int cmd_render(int argc, char **argv)
+{
+    render_cache_dump(stdout);
+    return 0;
+}
+#endif
+
+#if CONFIG_LILYGO_T_HMI
+static int cmd_touchcal(int argc, char **argv)
+{
+    esp_err_t ret = board_hmi_touch_calib_erase();
+    if (ret != ESP_OK && ret != ESP_ERR_NVS_NOT_FOUND) {
+        printf("touchcal: %s\n", esp_err_to_name(ret));
+        return 1;
+    }
+    printf("touch calibration cleared, it runs again on the next boot\n");
+    return 0;
+}
+#endif
+
+static const esp_console_cmd_t commands[] = {
+    {
+        .command = "pmu",
+        .help = "Read and print the PMU rails, battery and VBUS state",
+        .func = cmd_pmu,
+    },
+    {
+        .command = "i2c",
+        .help = "Print per-device I2C scheduler statistics, \"i2c scan\" prints the bus map",
+        .func = cmd_i2c,
+    },
+#if CONFIG_LILYGO_BOOT_TRACE
+    {
+        .command = "boottrace",
+        .help = "Print the boot timeline as Chrome trace JSON",
+        .func = cmd_boottrace,
+    },
+#endif
+#if CONFIG_LILYGO_TRACE_RING
+    {
+        .command = "trace",
+        .help = "Print the touch, flush and I2C event trace",
+        .func = cmd_trace,
+    },
+    {
+        .command = "tracebin",
+        .help = "Print the event trace as hex for tools/trace_decode.py",
+        .func = cmd_tracebin,
+    },
+#endif
+#if CONFIG_LILYGO_LATENCY_PROBE
+    {
+        .command = "latency",
+        .help = "Print the touch to photon latency histogram, \"latency reset\" also clears it",
+        .func = cmd_latency,
+    },
+#endif
+#if CONFIG_LILYGO_DISPLAY_PM
+    {
+        .command = "display",
+        .help = "Print the display power state",
+        .func = cmd_display,
+    },
+#endif
+#if CONFIG_LILYGO_RENDER_CACHE
+    {
+        .command = "render",
+        .help = "Print the shadow and gradient render cache statistics",
+        .func = cmd_render,
+    },
+#endif
+#if CONFIG_LILYGO_T_HMI
+    {
+        .command = "touchcal",
+        .help = "Forget the touch calibration so the next boot asks for it",
+        .func = cmd_touchcal,
+    },
+#endif
+};
+
+esp_err_t app_console_start(void)
+{
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = "lilygo>";
+
+    esp_console_register_help_command();
+    for (size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); i++) {
+        ESP_ERROR_CHECK(esp_console_cmd_register(&commands[i]));
+    }
+
+    esp_err_t ret;
+#if CONFIG_ESP_CONSOLE_UART_DEFAULT || CONFIG_ESP_CONSOLE_UART_CUSTOM
+    esp_console_dev_uart_config_t hw_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    ret = esp_console_new_repl_uart(&hw_config, &repl_config, &repl);
+#elif CONFIG_ESP_CONSOLE_USB_CDC
+    esp_console_dev_usb_cdc_config_t hw_config = ESP_CONSOLE_DEV_CDC_CONFIG_DEFAULT();
+    ret = esp_console_new_repl_usb_cdc(&hw_config, &repl_config, &repl);
+#elif CONFIG_ESP_CONSOLE_USB_SERIAL_JTAG
+    esp_console_dev_usb_serial_jtag_config_t hw_config = ESP_CONSOLE_DEV_USB_SERIAL_JTAG_CONFIG_DEFAULT();
+    ret = esp_console_new_repl_usb_serial_jtag(&hw_config, &repl_config, &repl);
+#else
+    ret = ESP_ERR_NOT_SUPPORTED;
+#endif
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "console unavailable: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    return esp_console_start_repl(repl);
+}
+
+#endif
@@ -0,0 +1,22 @@
+/**
+ * @file      app_console.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Serial REPL with the diagnostic commands, see "help"
+esp_err_t app_console_start(void);
+
+#ifdef __cplusplus
+}
+#endif
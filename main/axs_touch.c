@@ -0,0 +1,174 @@
+/**
+ * @file      axs_touch.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "trace_ring.h"
+#include "axs_touch.h"
+
+#define AXS_READ_CMD            0xB5
+#define AXS_HEADER_LEN          2
+#define AXS_POINT_LEN           6
+#define AXS_REPORT_LEN(points)  (AXS_HEADER_LEN + AXS_POINT_LEN * (points))
+#define AXS_STUCK_US            (100 * 1000)
+
+#define AXS_POINT(buf, i)       ((buf) + AXS_HEADER_LEN + AXS_POINT_LEN * (i))
+#define AXS_POINT_X(p)          ((((uint16_t)(p)[0] & 0x0F) << 8) | (p)[1])
+#define AXS_POINT_Y(p)          ((((uint16_t)(p)[2] & 0x0F) << 8) | (p)[3])
+
+static const char *TAG = "axs";
+
+static i2c_master_bus_handle_t bus_handle = NULL;
+static i2c_master_dev_handle_t dev = NULL;
+static SemaphoreHandle_t done = NULL;
+static bool async = false;
+
+// The async transfer reads these after the call returns, they must stay put
+static uint8_t cmd[11] = {AXS_READ_CMD, 0xAB, 0xA5, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static uint8_t rx[AXS_REPORT_LEN(AXS_TOUCH_MAX_POINTS)];
+static size_t rx_len;
+
+static bool pending = false;
+static volatile bool xfer_ok;
+static int64_t start_us;
+static uint8_t want = 1;
+static axs_touch_report_t last;
+
+static bool axs_touch_done(i2c_master_dev_handle_t i2c_dev, const i2c_master_event_data_t *evt, void *arg)
+{
+    BaseType_t woken = pdFALSE;
+    xfer_ok = evt->event == I2C_EVENT_DONE;
+    trace_i2c(AXS_TOUCH_ADDRESS, AXS_READ_CMD, rx_len, xfer_ok ? ESP_OK : ESP_FAIL, esp_timer_get_time() - start_us);
+    xSemaphoreGiveFromISR(done, &woken);
+    return woken == pdTRUE;
+}
+
+static void axs_touch_parse(void)
+{
+    axs_touch_report_t r = {.gesture = rx[0]};
+    uint8_t num = rx[1];
+    if (!num && (AXS_POINT_X(AXS_POINT(rx, 0)) || AXS_POINT_Y(AXS_POINT(rx, 0)))) {
+        num = 1;
+    }
+    if (num > AXS_TOUCH_MAX_POINTS) {
+        num = AXS_TOUCH_MAX_POINTS;
+    }
+    // A second finger shows up in the count first, the next read fetches its record
+    want = num ? num : 1;
+    uint8_t have = (rx_len - AXS_HEADER_LEN) / AXS_POINT_LEN;
+    for (uint8_t i = 0; !r.gesture && i < num && i < have; i++) {
+        r.points[i].x = AXS_POINT_X(AXS_POINT(rx, i));
+        r.points[i].y = AXS_POINT_Y(AXS_POINT(rx, i));
+        r.count++;
+    }
+    last = r;
+}
+
+static esp_err_t axs_touch_start(void)
+{
+    rx_len = AXS_REPORT_LEN(want);
+    cmd[7] = rx_len;
+    start_us = esp_timer_get_time();
+    pending = async;
+    esp_err_t ret = i2c_master_transmit_receive(dev, cmd, sizeof(cmd), rx, rx_len, AXS_TOUCH_TIMEOUT_MS);
+    if (ret != ESP_OK) {
+        pending = false;
+    }
+    if (!async) {
+        trace_i2c(AXS_TOUCH_ADDRESS, AXS_READ_CMD, rx_len, ret, esp_timer_get_time() - start_us);
+    }
+    return ret;
+}
+
+esp_err_t axs_touch_init(i2c_master_bus_handle_t bus)
+{
+    i2c_device_config_t cfg = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = AXS_TOUCH_ADDRESS,
+        .scl_speed_hz = AXS_TOUCH_SPEED_HZ,
+    };
+    esp_err_t ret = i2c_master_bus_add_device(bus, &cfg, &dev);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    bus_handle = bus;
+
+    done = xSemaphoreCreateBinary();
+    if (!done) {
+        return ESP_ERR_NO_MEM;
+    }
+    // Fails on a bus without a transaction queue, reads then block for at most the timeout
+    i2c_master_event_callbacks_t cbs = {
+        .on_trans_done = axs_touch_done,
+    };
+    async = i2c_master_register_event_callbacks(dev, &cbs, NULL) == ESP_OK;
+    ESP_LOGI(TAG, "touch at %d kHz, %s reads", AXS_TOUCH_SPEED_HZ / 1000, async ? "async" : "blocking");
+    return ESP_OK;
+}
+
+esp_err_t axs_touch_read(axs_touch_report_t *report, uint32_t wait_ms)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (!async) {
+        ret = axs_touch_start();
+        if (ret == ESP_OK) {
+            uint8_t asked = want;
+            axs_touch_parse();
+            if (want > asked) {
+                ret = axs_touch_start();
+                if (ret == ESP_OK) {
+                    axs_touch_parse();
+                }
+            }
+        }
+        *report = last;
+        return ret;
+    }
+
+    if (pending && esp_timer_get_time() - start_us > AXS_STUCK_US) {
+        // The lost transfer may still be queued with cmd and rx, they are only reused once the bus is idle
+        ESP_LOGW(TAG, "touch read lost, resetting the bus");
+        i2c_master_bus_reset(bus_handle);
+        if (i2c_master_bus_wait_all_done(bus_handle, AXS_TOUCH_TIMEOUT_MS) != ESP_OK) {
+            // Still busy, try again one stuck period later
+            start_us = esp_timer_get_time();
+            *report = last;
+            return ESP_FAIL;
+        }
+        xSemaphoreTake(done, 0);
+        pending = false;
+    }
+    if (!pending) {
+        ret = axs_touch_start();
+    }
+    if (ret != ESP_OK) {
+        *report = last;
+        return ret;
+    }
+    if (xSemaphoreTake(done, pdMS_TO_TICKS(wait_ms)) == pdTRUE) {
+        pending = false;
+        if (xfer_ok) {
+            axs_touch_parse();
+        } else {
+            ret = ESP_FAIL;
+        }
+        // Polling callers get this read's result on their next call
+        if (!wait_ms) {
+            axs_touch_start();
+        }
+    } else if (wait_ms) {
+        // The read is still in flight, nothing newer than the last report
+        ret = ESP_ERR_TIMEOUT;
+    }
+    *report = last;
+    return ret;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file      axs_touch.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/i2c_master.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AXS_TOUCH_ADDRESS       0x3B
+#define AXS_TOUCH_MAX_POINTS    3
+#define AXS_TOUCH_SPEED_HZ      400000
+#define AXS_TOUCH_TIMEOUT_MS    20
+#define AXS_TOUCH_QUEUE_DEPTH   4       // bus trans_queue_depth that enables the async path
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+} axs_touch_point_t;
+
+// Controller coordinates, the board maps them to the screen
+typedef struct {
+    uint8_t gesture;
+    uint8_t count;
+    axs_touch_point_t points[AXS_TOUCH_MAX_POINTS];
+} axs_touch_report_t;
+
+/*
+ * AXS15231 touch on its own I2C device. When the bus was created with a
+ * transaction queue, reads are asynchronous and complete from the I2C ISR,
+ * otherwise they are plain blocking transfers with a bounded timeout.
+ */
+esp_err_t axs_touch_init(i2c_master_bus_handle_t bus);
+
+/*
+ * Latest report. Each read asks for as many point records as the previous
+ * report had, so a single finger costs 8 bytes instead of the full 20.
+ * With wait_ms 0 an async read never blocks: it returns the last completed
+ * report and queues the next read for the following call. With a wait,
+ * ESP_ERR_TIMEOUT means no read completed in time and report holds the
+ * previous one.
+ */
+esp_err_t axs_touch_read(axs_touch_report_t *report, uint32_t wait_ms);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,213 @@
+/**
+ * @file      boot_splash.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "product_pins.h"
+#include "tft_driver.h"
+#include "boot_splash.h"
+
+#define SPLASH_HEADER_SIZE      (16)
+#define SPLASH_FLAG_SWAPPED     (0x01)
+#define SPLASH_FLUSH_TIMEOUT_MS (100)
+
+#if CONFIG_LV_COLOR_16_SWAP
+#define SPLASH_SWAPPED          (SPLASH_FLAG_SWAPPED)
+#else
+#define SPLASH_SWAPPED          (0)
+#endif
+
+static const char *TAG = "splash";
+
+static SemaphoreHandle_t flush_done = NULL;
+static volatile bool active = false;
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint16_t count;
+    uint16_t value;
+    bool repeat;
+} splash_decoder_t;
+
+static bool splash_next(splash_decoder_t *d, uint16_t *px)
+{
+    if (!d->count) {
+        if (d->p >= d->end) {
+            return false;
+        }
+        uint8_t c = *d->p++;
+        d->count = (c & 0x7F) + 1;
+        d->repeat = c & 0x80;
+        if (d->repeat) {
+            if (d->end - d->p < 2) {
+                return false;
+            }
+            memcpy(&d->value, d->p, 2);
+            d->p += 2;
+        }
+    }
+    if (!d->repeat) {
+        if (d->end - d->p < 2) {
+            return false;
+        }
+        memcpy(&d->value, d->p, 2);
+        d->p += 2;
+    }
+    d->count--;
+    *px = d->value;
+    return true;
+}
+
+// Decode one image row, keeping the pixels that land on screen
+static void splash_decode_row(splash_decoder_t *d, uint16_t *row, int x, uint16_t w, uint16_t screen_w)
+{
+    uint16_t px;
+    for (int i = 0; i < w; i++) {
+        if (!splash_next(d, &px)) {
+            return;
+        }
+        int sx = x + i;
+        if (sx >= 0 && sx < screen_w) {
+            row[sx] = px;
+        }
+    }
+}
+
+static void splash_push(uint16_t screen_w, uint16_t y, uint16_t rows, uint16_t *buf)
+{
+#if DISPLAY_FULLRESH
+    display_push_colors(0, y, screen_w, rows, buf);
+#else
+    display_push_colors(0, y, screen_w, y + rows, buf);
+#endif
+}
+
+bool boot_splash_flush_ready(void)
+{
+    if (!active) {
+        return false;
+    }
+    if (xPortInIsrContext()) {
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR(flush_done, &woken);
+        if (woken) {
+            portYIELD_FROM_ISR();
+        }
+    } else {
+        xSemaphoreGive(flush_done);
+    }
+    return true;
+}
+
+bool boot_splash_show(const uint8_t *image, size_t size)
+{
+    // Same orientation LVGL is registered with
+    const uint16_t screen_w = AMOLED_HEIGHT;
+    const uint16_t screen_h = AMOLED_WIDTH;
+
+    if (size < SPLASH_HEADER_SIZE || memcmp(image, "LSPL", 4) != 0) {
+        ESP_LOGE(TAG, "invalid splash image");
+        return false;
+    }
+    uint16_t w, h, bg, flags;
+    uint32_t payload;
+    memcpy(&w, image + 4, 2);
+    memcpy(&h, image + 6, 2);
+    memcpy(&bg, image + 8, 2);
+    memcpy(&flags, image + 10, 2);
+    memcpy(&payload, image + 12, 4);
+    if (payload > size - SPLASH_HEADER_SIZE) {
+        ESP_LOGE(TAG, "truncated splash image");
+        return false;
+    }
+    if ((flags & SPLASH_FLAG_SWAPPED) != SPLASH_SWAPPED) {
+        ESP_LOGE(TAG, "splash byte order does not match LV_COLOR_16_SWAP");
+        return false;
+    }
+
+    int64_t start = esp_timer_get_time();
+
+    // Two bands, so the next one is decoded while the previous is still on the bus
+    size_t band_size = screen_w * BOOT_SPLASH_BAND_ROWS * sizeof(uint16_t);
+    uint16_t *bands[2];
+    bands[0] = (uint16_t *)heap_caps_malloc(band_size, MALLOC_CAP_DMA);
+    bands[1] = (uint16_t *)heap_caps_malloc(band_size, MALLOC_CAP_DMA);
+    if (!bands[0]) {
+        free(bands[1]);
+        ESP_LOGE(TAG, "no memory for the splash band");
+        return false;
+    }
+    int band_count = bands[1] ? 2 : 1;
+
+    if (!flush_done) {
+        flush_done = xSemaphoreCreateCounting(2, 0);
+    }
+    active = true;
+
+    splash_decoder_t dec = {
+        .p = image + SPLASH_HEADER_SIZE,
+        .end = image + SPLASH_HEADER_SIZE + payload,
+    };
+    int img_x = ((int)screen_w - w) / 2;
+    int img_y = ((int)screen_h - h) / 2;
+    int in_flight = 0;
+    int next = 0;
+
+    // Image rows above the screen
+    for (int iy = 0; iy < -img_y && iy < h; iy++) {
+        splash_decode_row(&dec, bands[0], img_x, w, 0);
+    }
+
+    for (uint16_t y = 0; y < screen_h; y += BOOT_SPLASH_BAND_ROWS) {
+        uint16_t rows = screen_h - y < BOOT_SPLASH_BAND_ROWS ? screen_h - y : BOOT_SPLASH_BAND_ROWS;
+        uint16_t *band = bands[next];
+
+#if !DISPLAY_FULLRESH
+        // The panel IO still reads from this band until its flush completes
+        if (in_flight == band_count) {
+            xSemaphoreTake(flush_done, pdMS_TO_TICKS(SPLASH_FLUSH_TIMEOUT_MS));
+            in_flight--;
+        }
+#endif
+        for (uint16_t r = 0; r < rows; r++) {
+            uint16_t *row = band + r * screen_w;
+            for (uint16_t x = 0; x < screen_w; x++) {
+                row[x] = bg;
+            }
+            int iy = y + r - img_y;
+            if (iy >= 0 && iy < h) {
+                splash_decode_row(&dec, row, img_x, w, screen_w);
+            }
+        }
+
+        splash_push(screen_w, y, rows, band);
+#if !DISPLAY_FULLRESH
+        in_flight++;
+#endif
+        next = (next + 1) % band_count;
+    }
+
+    while (in_flight--) {
+        xSemaphoreTake(flush_done, pdMS_TO_TICKS(SPLASH_FLUSH_TIMEOUT_MS));
+    }
+    active = false;
+    // Drop completions that arrived after a timeout
+    while (xSemaphoreTake(flush_done, 0) == pdTRUE) {
+    }
+
+    free(bands[0]);
+    free(bands[1]);
+    ESP_LOGI(TAG, "%ux%u splash in %lld us", w, h, (long long)(esp_timer_get_time() - start));
+    return true;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file      boot_splash.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BOOT_SPLASH_BAND_ROWS   (16)
+
+/*
+ * Stream a splash made by tools/png2splash.py straight to the panel with
+ * display_push_colors(), centred and clipped to the screen. Needs nothing
+ * but display_init(), LVGL does not have to be up.
+ */
+bool boot_splash_show(const uint8_t *image, size_t size);
+
+/*
+ * Call from the board's flush ready path before lv_disp_flush_ready().
+ * Returns true while the splash owns the panel, the event is consumed then.
+ */
+bool boot_splash_flush_ready(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,233 @@
+/**
+ * @file      boot_stages.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "boot_stages.h"
+#include "boot_trace.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#else
+#include <time.h>
+#define ESP_LOGE(tag, fmt, ...)     printf("E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...)     printf("W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#endif
+
+static const char *TAG = "BOOT";
+static int64_t boot_t0;
+static uint32_t boot_done_inline;
+
+#ifdef ESP_PLATFORM
+static EventGroupHandle_t boot_group;
+#endif
+
+static int64_t boot_now_us()
+{
+#ifdef ESP_PLATFORM
+    return esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+static void boot_stage_exec(boot_stage_t *stage)
+{
+    int span = boot_trace_begin(stage->name);
+    stage->start_us = boot_now_us() - boot_t0;
+    stage->fn();
+    stage->end_us = boot_now_us() - boot_t0;
+    boot_trace_end(span);
+}
+
+#ifdef ESP_PLATFORM
+static void boot_stage_task(void *arg)
+{
+    boot_stage_t *stage = (boot_stage_t *)arg;
+    boot_stage_exec(stage);
+    xEventGroupSetBits(boot_group, BOOT_STAGE_DEP(stage->id));
+    vTaskDelete(NULL);
+}
+#endif
+
+static void boot_stage_start(boot_stage_t *stage, bool parallel)
+{
+    (void)parallel;
+#ifdef ESP_PLATFORM
+    if (parallel) {
+        uint32_t stack = stage->stack_size ? stage->stack_size : BOOT_STAGE_STACK_DEFAULT;
+        if (xTaskCreate(boot_stage_task, stage->name, stack, stage, uxTaskPriorityGet(NULL), NULL) == pdPASS) {
+            return;
+        }
+        ESP_LOGW(TAG, "No memory for stage task %s, running it inline", stage->name);
+    }
+#endif
+    boot_stage_exec(stage);
+    boot_done_inline |= BOOT_STAGE_DEP(stage->id);
+}
+
+static uint32_t boot_stages_wait(uint32_t running)
+{
+    uint32_t bits = boot_done_inline & running;
+#ifdef ESP_PLATFORM
+    if (!bits) {
+        bits = xEventGroupWaitBits(boot_group, running, pdFALSE, pdFALSE, portMAX_DELAY) & running;
+    }
+#endif
+    return bits;
+}
+
+bool boot_stages_run(boot_stage_t *stages, size_t count, bool parallel)
+{
+    if (count == 0 || count > BOOT_STAGES_MAX) {
+        return false;
+    }
+
+    const uint32_t all = BOOT_STAGE_DEP(count) - 1;
+    uint32_t started = 0;
+    uint32_t done = 0;
+    bool ok = true;
+
+#ifdef ESP_PLATFORM
+    if (parallel) {
+        boot_group = xEventGroupCreate();
+        parallel = boot_group != NULL;
+    }
+#else
+    parallel = false;
+#endif
+
+    boot_done_inline = 0;
+    boot_t0 = boot_now_us();
+    for (size_t i = 0; i < count; i++) {
+        stages[i].id = i;
+        stages[i].start_us = -1;
+        stages[i].end_us = -1;
+    }
+
+    while (done != all) {
+        for (size_t i = 0; i < count; i++) {
+            uint32_t bit = BOOT_STAGE_DEP(i);
+            if ((started & bit) || (stages[i].deps & ~done)) {
+                continue;
+            }
+            started |= bit;
+            boot_stage_start(&stages[i], parallel);
+            if (!parallel) {
+                // One at a time, re-scan from the top so the table order is kept
+                done |= boot_done_inline;
+                i = (size_t) -1;
+            }
+        }
+
+        if (done == all) {
+            break;
+        }
+        uint32_t running = started & ~done;
+        if (!running) {
+            // Nothing in flight and nothing runnable: a cycle or a missing stage
+            for (size_t i = 0; i < count; i++) {
+                if (!(started & BOOT_STAGE_DEP(i))) {
+                    ESP_LOGE(TAG, "Stage %s never became ready (deps 0x%lx, done 0x%lx)",
+                             stages[i].name, (unsigned long)stages[i].deps, (unsigned long)done);
+                }
+            }
+            ok = false;
+            break;
+        }
+        done |= boot_stages_wait(running);
+    }
+
+#ifdef ESP_PLATFORM
+    if (boot_group) {
+        vEventGroupDelete(boot_group);
+        boot_group = NULL;
+    }
+#endif
+    return ok;
+}
+
+uint32_t boot_stages_critical_path(const boot_stage_t *stages, size_t count, int64_t *length_us)
+{
+    uint8_t order[BOOT_STAGES_MAX];
+    int64_t finish[BOOT_STAGES_MAX];
+    int8_t prev[BOOT_STAGES_MAX];
+    size_t n = 0;
+
+    if (count > BOOT_STAGES_MAX) {
+        count = BOOT_STAGES_MAX;
+    }
+
+    // A stage always starts after its dependencies ended, so start time is a topological order
+    for (size_t i = 0; i < count; i++) {
+        if (stages[i].start_us < 0 || stages[i].end_us < 0) {
+            continue;
+        }
+        size_t j = n++;
+        while (j > 0 && stages[order[j - 1]].start_us > stages[i].start_us) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    int best = -1;
+    for (size_t k = 0; k < n; k++) {
+        uint8_t i = order[k];
+        int64_t start = 0;
+        prev[i] = -1;
+        for (size_t d = 0; d < count; d++) {
+            if ((stages[i].deps & BOOT_STAGE_DEP(d)) && stages[d].end_us >= 0 && finish[d] > start) {
+                start = finish[d];
+                prev[i] = d;
+            }
+        }
+        finish[i] = start + (stages[i].end_us - stages[i].start_us);
+        if (best < 0 || finish[i] > finish[best]) {
+            best = i;
+        }
+    }
+
+    uint32_t path = 0;
+    if (length_us) {
+        *length_us = best < 0 ? 0 : finish[best];
+    }
+    for (int i = best; i >= 0; i = prev[i]) {
+        path |= BOOT_STAGE_DEP(i);
+    }
+    return path;
+}
+
+void boot_stages_report(const boot_stage_t *stages, size_t count)
+{
+    int64_t critical_us = 0, sum_us = 0, wall_us = 0;
+    uint32_t path = boot_stages_critical_path(stages, count, &critical_us);
+
+    printf("  %-12s %10s %10s %10s\n", "stage", "start(ms)", "end(ms)", "time(ms)");
+    for (size_t i = 0; i < count; i++) {
+        const boot_stage_t *s = &stages[i];
+        if (s->end_us < 0) {
+            printf("  %-12s %10s\n", s->name, "not run");
+            continue;
+        }
+        printf("%c %-12s %10.1f %10.1f %10.1f\n", (path & BOOT_STAGE_DEP(i)) ? '*' : ' ', s->name,
+               s->start_us / 1000.0, s->end_us / 1000.0, (s->end_us - s->start_us) / 1000.0);
+        sum_us += s->end_us - s->start_us;
+        if (s->end_us > wall_us) {
+            wall_us = s->end_us;
+        }
+    }
+    printf("  wall %.1f ms, sequential %.1f ms, critical path (*) %.1f ms\n",
+           wall_us / 1000.0, sum_us / 1000.0, critical_us / 1000.0);
+}
@@ -0,0 +1,53 @@
+/**
+ * @file      boot_stages.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BOOT_STAGES_MAX             24
+#define BOOT_STAGE_DEP(id)          (1UL << (id))
+#define BOOT_STAGE_STACK_DEFAULT    6144
+
+typedef void (*boot_stage_fn_t)(void);
+
+typedef struct {
+    const char *name;
+    boot_stage_fn_t fn;
+    uint32_t deps;          // BOOT_STAGE_DEP() of the stages that must finish first
+    uint32_t stack_size;    // 0 for BOOT_STAGE_STACK_DEFAULT
+
+    // Filled in by boot_stages_run(), relative to its start
+    uint8_t id;
+    int64_t start_us;
+    int64_t end_us;
+} boot_stage_t;
+
+/*
+ * Board bring-up scheduler.
+ * Every stage whose dependencies are done is started at once, each in its own
+ * task, so independent stages overlap (e.g. LVGL setup runs during the panel
+ * reset delays). With `parallel` false, or on a host build, stages run one by
+ * one in dependency order. Returns false if some stage could never run.
+ */
+bool boot_stages_run(boot_stage_t *stages, size_t count, bool parallel);
+
+// Longest chain of dependent stages by measured duration, as a stage bitmask
+uint32_t boot_stages_critical_path(const boot_stage_t *stages, size_t count, int64_t *length_us);
+
+void boot_stages_report(const boot_stage_t *stages, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
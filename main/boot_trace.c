@@ -0,0 +1,200 @@
+/**
+ * @file      boot_trace.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "boot_trace.h"
+
+#if !defined(ESP_PLATFORM) || CONFIG_LILYGO_BOOT_TRACE
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+static portMUX_TYPE trace_lock = portMUX_INITIALIZER_UNLOCKED;
+#define TRACE_LOCK()        taskENTER_CRITICAL(&trace_lock)
+#define TRACE_UNLOCK()      taskEXIT_CRITICAL(&trace_lock)
+#else
+#include <time.h>
+#define TRACE_LOCK()
+#define TRACE_UNLOCK()
+#endif
+
+#define THREAD_NAME_LEN     16
+
+typedef struct {
+    uintptr_t handle;
+    char name[THREAD_NAME_LEN];
+    uint8_t depth;
+} trace_thread_t;
+
+static boot_trace_span_t spans[BOOT_TRACE_MAX_SPANS];
+static size_t span_count;
+static trace_thread_t threads[BOOT_TRACE_MAX_THREADS];
+static size_t thread_count;
+static uint32_t dropped;
+
+static int64_t trace_now_us(void)
+{
+#ifdef ESP_PLATFORM
+    return esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+/*
+ * Called with the lock held. A stage task that exits frees its handle for
+ * the next one, so a thread is the handle together with the task name the
+ * caller had at begin time.
+ */
+static int trace_thread(uintptr_t handle, const char *name)
+{
+    for (size_t i = 0; i < thread_count; i++) {
+        if (threads[i].handle == handle && strncmp(threads[i].name, name, THREAD_NAME_LEN - 1) == 0) {
+            return i;
+        }
+    }
+    if (thread_count == BOOT_TRACE_MAX_THREADS) {
+        return -1;
+    }
+    trace_thread_t *t = &threads[thread_count];
+    t->handle = handle;
+    t->depth = 0;
+    strncpy(t->name, name, THREAD_NAME_LEN - 1);
+    t->name[THREAD_NAME_LEN - 1] = '\0';
+    return thread_count++;
+}
+
+int boot_trace_begin(const char *name)
+{
+    int64_t now = trace_now_us();
+#ifdef ESP_PLATFORM
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    uintptr_t handle = (uintptr_t)task;
+    const char *thread_name = pcTaskGetName(task);
+#else
+    uintptr_t handle = 0;
+    const char *thread_name = "main";
+#endif
+    int id = -1;
+    TRACE_LOCK();
+    int thread = trace_thread(handle, thread_name);
+    if (thread >= 0 && span_count < BOOT_TRACE_MAX_SPANS) {
+        id = span_count++;
+        boot_trace_span_t *s = &spans[id];
+        s->name = name;
+        s->start_us = now;
+        s->end_us = -1;
+        s->thread = thread;
+        s->depth = threads[thread].depth++;
+    } else {
+        dropped++;
+    }
+    TRACE_UNLOCK();
+    return id;
+}
+
+void boot_trace_end(int span)
+{
+    int64_t now = trace_now_us();
+    if (span < 0 || (size_t)span >= span_count) {
+        return;
+    }
+    TRACE_LOCK();
+    boot_trace_span_t *s = &spans[span];
+    if (s->end_us < 0) {
+        s->end_us = now;
+        if (threads[s->thread].depth) {
+            threads[s->thread].depth--;
+        }
+    }
+    TRACE_UNLOCK();
+}
+
+size_t boot_trace_spans(const boot_trace_span_t **out)
+{
+    *out = spans;
+    return span_count;
+}
+
+const char *boot_trace_thread_name(uint8_t thread)
+{
+    return thread < thread_count ? threads[thread].name : "";
+}
+
+void boot_trace_reset(void)
+{
+    TRACE_LOCK();
+    span_count = 0;
+    thread_count = 0;
+    dropped = 0;
+    TRACE_UNLOCK();
+}
+
+void boot_trace_report(void)
+{
+    // Spans are allocated at begin, so the table is already in start order
+    printf("  %-28s %-12s %10s %10s\n", "span", "task", "start(ms)", "time(ms)");
+    for (size_t i = 0; i < span_count; i++) {
+        const boot_trace_span_t *s = &spans[i];
+        char name[29];
+        snprintf(name, sizeof(name), "%*s%s", s->depth * 2, "", s->name);
+        if (s->end_us < 0) {
+            printf("  %-28s %-12s %10.1f %10s\n", name, threads[s->thread].name, s->start_us / 1000.0, "open");
+        } else {
+            printf("  %-28s %-12s %10.1f %10.1f\n", name, threads[s->thread].name, s->start_us / 1000.0,
+                   (s->end_us - s->start_us) / 1000.0);
+        }
+    }
+    if (dropped) {
+        printf("  %lu spans dropped, raise BOOT_TRACE_MAX_SPANS\n", (unsigned long)dropped);
+    }
+}
+
+static void trace_json_string(FILE *out, const char *str)
+{
+    fputc('"', out);
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\') {
+            fputc('\\', out);
+        }
+        if ((unsigned char)*str >= 0x20) {
+            fputc(*str, out);
+        }
+    }
+    fputc('"', out);
+}
+
+void boot_trace_export_json(FILE *out)
+{
+    const char *sep = "";
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", out);
+    for (size_t i = 0; i < thread_count; i++) {
+        fprintf(out, "%s\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                sep, (unsigned)i + 1);
+        trace_json_string(out, threads[i].name);
+        fputs("}}", out);
+        sep = ",";
+    }
+    for (size_t i = 0; i < span_count; i++) {
+        const boot_trace_span_t *s = &spans[i];
+        if (s->end_us < 0) {
+            continue;
+        }
+        fprintf(out, "%s\n{\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%lld,\"dur\":%lld,\"name\":", sep,
+                (unsigned)s->thread + 1, (long long)s->start_us, (long long)(s->end_us - s->start_us));
+        trace_json_string(out, s->name);
+        fputc('}', out);
+        sep = ",";
+    }
+    fputs("\n]}\n", out);
+}
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * @file      boot_trace.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BOOT_TRACE_MAX_SPANS    64
+#define BOOT_TRACE_MAX_THREADS  8
+
+typedef struct {
+    const char *name;       // must outlive the trace, string literals
+    int64_t start_us;       // esp_timer time
+    int64_t end_us;         // -1 while open
+    uint8_t thread;
+    uint8_t depth;
+} boot_trace_span_t;
+
+#if !defined(ESP_PLATFORM) || CONFIG_LILYGO_BOOT_TRACE
+
+/*
+ * Named spans in a static table, no heap. Spans nest per task, begin
+ * returns an id for end() or -1 once the table is full.
+ */
+int boot_trace_begin(const char *name);
+void boot_trace_end(int span);
+
+size_t boot_trace_spans(const boot_trace_span_t **spans);
+const char *boot_trace_thread_name(uint8_t thread);
+
+// Table of all spans in start order, indented by nesting
+void boot_trace_report(void);
+
+// Chrome trace event JSON, loads in chrome://tracing and Perfetto
+void boot_trace_export_json(FILE *out);
+
+void boot_trace_reset(void);
+
+#else
+
+static inline int boot_trace_begin(const char *name)
+{
+    return -1;
+}
+static inline void boot_trace_end(int span) {}
+static inline size_t boot_trace_spans(const boot_trace_span_t **spans)
+{
+    *spans = NULL;
+    return 0;
+}
+static inline const char *boot_trace_thread_name(uint8_t thread)
+{
+    return "";
+}
+static inline void boot_trace_report(void) {}
+static inline void boot_trace_export_json(FILE *out) {}
+static inline void boot_trace_reset(void) {}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
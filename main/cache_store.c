@@ -0,0 +1,274 @@
+/**
+ * @file      cache_store.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cache_store.h"
+
+#ifdef ESP_PLATFORM
+#define cache_alloc(size, caps)     heap_caps_malloc(size, caps)
+#define cache_free(ptr)             heap_caps_free(ptr)
+#else
+#define cache_alloc(size, caps)     malloc(size)
+#define cache_free(ptr)             free(ptr)
+#endif
+
+static uint32_t cache_key_hash(const cache_key_t *key)
+{
+    // FNV-1a over the key words
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < CACHE_KEY_WORDS; i++) {
+        uint32_t w = key->w[i];
+        for (int b = 0; b < 4; b++) {
+            h ^= (w >> (b * 8)) & 0xFF;
+            h *= 16777619u;
+        }
+    }
+    return h;
+}
+
+static cache_entry_t *cache_find(cache_store_t *store, const cache_key_t *key, uint32_t hash)
+{
+    for (uint16_t i = 0; i < store->max_entries; i++) {
+        cache_entry_t *e = &store->entries[i];
+        if (e->used && e->hash == hash && memcmp(&e->key, key, sizeof(cache_key_t)) == 0) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static void cache_release(cache_store_t *store, cache_entry_t *e)
+{
+    cache_free(e->data);
+    store->stats.bytes_used -= e->size;
+    store->stats.entries--;
+    if (e->pins) {
+        store->stats.pinned--;
+    }
+    memset(e, 0, sizeof(*e));
+}
+
+static bool cache_evict_one(cache_store_t *store)
+{
+    // Two sweeps: the first one may only clear reference bits
+    for (uint32_t n = 0; n < 2u * store->max_entries; n++) {
+        cache_entry_t *e = &store->entries[store->hand];
+        store->hand = (store->hand + 1) % store->max_entries;
+        if (!e->used || e->pins) {
+            continue;
+        }
+        if (e->ref) {
+            e->ref = 0;
+            continue;
+        }
+        cache_release(store, e);
+        store->stats.evictions++;
+        return true;
+    }
+    return false;
+}
+
+static cache_entry_t *cache_free_slot(cache_store_t *store)
+{
+    for (uint16_t i = 0; i < store->max_entries; i++) {
+        if (!store->entries[i].used) {
+            return &store->entries[i];
+        }
+    }
+    return NULL;
+}
+
+bool cache_store_init(cache_store_t *store, const char *name, size_t capacity, uint16_t max_entries, uint32_t caps)
+{
+    memset(store, 0, sizeof(*store));
+    store->entries = (cache_entry_t *)calloc(max_entries, sizeof(cache_entry_t));
+    if (!store->entries) {
+        return false;
+    }
+    store->name = name;
+    store->max_entries = max_entries;
+    store->capacity = capacity;
+    store->caps = caps;
+    return true;
+}
+
+void cache_store_deinit(cache_store_t *store)
+{
+    if (!store->entries) {
+        return;
+    }
+    cache_store_unpin_all(store);
+    cache_store_clear(store);
+    free(store->entries);
+    store->entries = NULL;
+}
+
+void *cache_store_lookup(cache_store_t *store, const cache_key_t *key, size_t *size)
+{
+    cache_entry_t *e = cache_find(store, key, cache_key_hash(key));
+    if (!e) {
+        store->stats.misses++;
+        return NULL;
+    }
+    store->stats.hits++;
+    e->ref = 1;
+    if (size) {
+        *size = e->size;
+    }
+    return e->data;
+}
+
+void *cache_store_insert(cache_store_t *store, const cache_key_t *key, size_t size)
+{
+    uint32_t hash = cache_key_hash(key);
+    cache_entry_t *e = cache_find(store, key, hash);
+    if (e) {
+        if (e->pins || e->size == size) {
+            return e->pins ? NULL : e->data;
+        }
+        cache_release(store, e);
+    }
+
+    if (size == 0 || size > store->capacity) {
+        store->stats.rejects++;
+        return NULL;
+    }
+
+    while (store->stats.bytes_used + size > store->capacity || !cache_free_slot(store)) {
+        if (!cache_evict_one(store)) {
+            store->stats.rejects++;
+            return NULL;
+        }
+    }
+
+    void *data = cache_alloc(size, store->caps);
+    while (!data) {
+        // Heap fragmentation, give back more memory and retry
+        if (!cache_evict_one(store)) {
+            store->stats.rejects++;
+            return NULL;
+        }
+        data = cache_alloc(size, store->caps);
+    }
+
+    e = cache_free_slot(store);
+    e->key = *key;
+    e->hash = hash;
+    e->data = data;
+    e->size = size;
+    e->ref = 1;
+    e->used = 1;
+    store->stats.entries++;
+    store->stats.bytes_used += size;
+    if (store->stats.bytes_used > store->stats.bytes_peak) {
+        store->stats.bytes_peak = store->stats.bytes_used;
+    }
+    return data;
+}
+
+void *cache_store_get(cache_store_t *store, const cache_key_t *key, size_t size, cache_fill_cb_t fill, void *user_data)
+{
+    void *data = cache_store_lookup(store, key, NULL);
+    if (data) {
+        return data;
+    }
+    data = cache_store_insert(store, key, size);
+    if (!data) {
+        return NULL;
+    }
+    if (!fill(data, size, user_data)) {
+        cache_store_remove(store, key);
+        return NULL;
+    }
+    return data;
+}
+
+bool cache_store_pin(cache_store_t *store, const cache_key_t *key)
+{
+    cache_entry_t *e = cache_find(store, key, cache_key_hash(key));
+    if (!e) {
+        return false;
+    }
+    if (e->pins++ == 0) {
+        store->stats.pinned++;
+    }
+    return true;
+}
+
+bool cache_store_unpin(cache_store_t *store, const cache_key_t *key)
+{
+    cache_entry_t *e = cache_find(store, key, cache_key_hash(key));
+    if (!e || !e->pins) {
+        return false;
+    }
+    if (--e->pins == 0) {
+        store->stats.pinned--;
+    }
+    return true;
+}
+
+bool cache_store_unpin_data(cache_store_t *store, const void *data)
+{
+    for (uint16_t i = 0; i < store->max_entries; i++) {
+        cache_entry_t *e = &store->entries[i];
+        if (e->used && e->data == data) {
+            if (e->pins && --e->pins == 0) {
+                store->stats.pinned--;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void cache_store_unpin_all(cache_store_t *store)
+{
+    for (uint16_t i = 0; i < store->max_entries; i++) {
+        store->entries[i].pins = 0;
+    }
+    store->stats.pinned = 0;
+}
+
+void cache_store_remove(cache_store_t *store, const cache_key_t *key)
+{
+    cache_entry_t *e = cache_find(store, key, cache_key_hash(key));
+    if (e) {
+        cache_release(store, e);
+    }
+}
+
+void cache_store_clear(cache_store_t *store)
+{
+    for (uint16_t i = 0; i < store->max_entries; i++) {
+        cache_entry_t *e = &store->entries[i];
+        if (e->used && !e->pins) {
+            cache_release(store, e);
+        }
+    }
+}
+
+void cache_store_get_stats(const cache_store_t *store, cache_stats_t *stats)
+{
+    *stats = store->stats;
+}
+
+void cache_store_dump(const cache_store_t *store)
+{
+    const cache_stats_t *s = &store->stats;
+    uint32_t lookups = s->hits + s->misses;
+    printf("%s cache: %u/%u entries, %u pinned, %u/%u bytes (peak %u)\n",
+           store->name ? store->name : "?",
+           s->entries, store->max_entries, s->pinned,
+           (unsigned)s->bytes_used, (unsigned)store->capacity, (unsigned)s->bytes_peak);
+    printf("  hits:%lu misses:%lu hit-rate:%lu%% evictions:%lu rejects:%lu\n",
+           (unsigned long)s->hits, (unsigned long)s->misses,
+           (unsigned long)(lookups ? (s->hits * 100ULL) / lookups : 0),
+           (unsigned long)s->evictions, (unsigned long)s->rejects);
+}
@@ -0,0 +1,101 @@
+/**
+ * @file      cache_store.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#define CACHE_STORE_CAPS_PSRAM      (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#define CACHE_STORE_CAPS_INTERNAL   (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#else
+#define CACHE_STORE_CAPS_PSRAM      (0)
+#define CACHE_STORE_CAPS_INTERNAL   (0)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CACHE_KEY_WORDS     8
+
+/*
+ * Byte-bounded cache with CLOCK (second chance) eviction.
+ * Entries are identified by a fixed size key, the payload lives in a heap
+ * chosen by `caps`. Pinned entries are never evicted.
+ * The store is not thread-safe, callers serialize access (e.g. LVGL lock).
+ */
+typedef struct {
+    uint32_t w[CACHE_KEY_WORDS];
+} cache_key_t;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t rejects;
+    size_t   bytes_used;
+    size_t   bytes_peak;
+    uint16_t entries;
+    uint16_t pinned;
+} cache_stats_t;
+
+typedef struct {
+    cache_key_t key;
+    uint32_t hash;
+    void *data;
+    size_t size;
+    uint16_t pins;
+    uint8_t ref;
+    uint8_t used;
+} cache_entry_t;
+
+typedef struct {
+    const char *name;
+    cache_entry_t *entries;
+    uint16_t max_entries;
+    uint16_t hand;
+    size_t capacity;
+    uint32_t caps;
+    cache_stats_t stats;
+} cache_store_t;
+
+typedef bool (*cache_fill_cb_t)(void *buf, size_t size, void *user_data);
+
+bool cache_store_init(cache_store_t *store, const char *name, size_t capacity, uint16_t max_entries, uint32_t caps);
+
+void cache_store_deinit(cache_store_t *store);
+
+void *cache_store_lookup(cache_store_t *store, const cache_key_t *key, size_t *size);
+
+void *cache_store_insert(cache_store_t *store, const cache_key_t *key, size_t size);
+
+void *cache_store_get(cache_store_t *store, const cache_key_t *key, size_t size, cache_fill_cb_t fill, void *user_data);
+
+bool cache_store_pin(cache_store_t *store, const cache_key_t *key);
+
+bool cache_store_unpin(cache_store_t *store, const cache_key_t *key);
+
+bool cache_store_unpin_data(cache_store_t *store, const void *data);
+
+void cache_store_unpin_all(cache_store_t *store);
+
+void cache_store_remove(cache_store_t *store, const cache_key_t *key);
+
+void cache_store_clear(cache_store_t *store);
+
+void cache_store_get_stats(const cache_store_t *store, cache_stats_t *stats);
+
+void cache_store_dump(const cache_store_t *store);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,267 @@
+/**
+ * @file      digit_label.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "digit_label.h"
+
+#define MY_CLASS            &digit_label_class
+#define DIGIT_LABEL_SLOTS   (DIGIT_LABEL_MAX_DIGITS + 1)
+
+typedef struct {
+    lv_obj_t obj;
+    int32_t value;
+    const char *suffix;
+    uint8_t int_digits;
+    uint8_t frac_digits;
+    uint8_t slots;
+    char text[DIGIT_LABEL_SLOTS];
+    lv_coord_t slot_x[DIGIT_LABEL_SLOTS + 1];
+    lv_coord_t line_h;
+    lv_coord_t suffix_w;
+} digit_label_t;
+
+static void digit_label_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void digit_label_event(const lv_obj_class_t *class_p, lv_event_t *e);
+
+const lv_obj_class_t digit_label_class = {
+    .base_class = &lv_obj_class,
+    .constructor_cb = digit_label_constructor,
+    .event_cb = digit_label_event,
+    .width_def = LV_SIZE_CONTENT,
+    .height_def = LV_SIZE_CONTENT,
+    .instance_size = sizeof(digit_label_t),
+};
+
+static void digit_label_layout(lv_obj_t *obj)
+{
+    digit_label_t *dl = (digit_label_t *)obj;
+    const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+
+    lv_coord_t digit_w = lv_font_get_glyph_width(font, '-', 0);
+    for (char c = '0'; c <= '9'; c++) {
+        digit_w = LV_MAX(digit_w, lv_font_get_glyph_width(font, c, 0));
+    }
+    lv_coord_t dot_w = lv_font_get_glyph_width(font, '.', 0);
+
+    lv_coord_t x = 0;
+    for (uint8_t i = 0; i < dl->slots; i++) {
+        dl->slot_x[i] = x;
+        x += (dl->frac_digits && i == dl->int_digits) ? dot_w : digit_w;
+    }
+    dl->slot_x[dl->slots] = x;
+    dl->line_h = lv_font_get_line_height(font);
+    dl->suffix_w = 0;
+    if (dl->suffix) {
+        dl->suffix_w = lv_txt_get_width(dl->suffix, strlen(dl->suffix), font,
+                                        lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN),
+                                        LV_TEXT_FLAG_NONE);
+    }
+}
+
+static void digit_label_render(const digit_label_t *dl, int32_t value, char *out)
+{
+    uint8_t digits = dl->int_digits + dl->frac_digits;
+    bool negative = value < 0;
+    uint32_t mag = negative ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+
+    // Clamp to what fits, a negative value needs a slot for the sign
+    uint32_t max = 1;
+    for (uint8_t i = 0; i < digits - (negative ? 1 : 0); i++) {
+        max *= 10;
+    }
+    if (negative && dl->int_digits < 2) {
+        negative = false;
+        mag = 0;
+    }
+    if (mag > max - 1) {
+        mag = max - 1;
+    }
+
+    int i = dl->slots - 1;
+    for (uint8_t f = 0; f < dl->frac_digits; f++) {
+        out[i--] = '0' + mag % 10;
+        mag /= 10;
+    }
+    if (dl->frac_digits) {
+        out[i--] = '.';
+    }
+    do {
+        out[i--] = '0' + mag % 10;
+        mag /= 10;
+    } while (mag && i >= 0);
+    if (negative && i >= 0) {
+        out[i--] = '-';
+    }
+    while (i >= 0) {
+        out[i--] = ' ';
+    }
+}
+
+static void digit_label_invalidate_slots(lv_obj_t *obj, uint8_t first, uint8_t last)
+{
+    digit_label_t *dl = (digit_label_t *)obj;
+    lv_area_t area;
+    area.x1 = obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + dl->slot_x[first];
+    area.x2 = obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + dl->slot_x[last + 1] - 1;
+    area.y1 = obj->coords.y1 + lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    area.y2 = area.y1 + dl->line_h - 1;
+    lv_obj_invalidate_area(obj, &area);
+}
+
+static void digit_label_refresh(lv_obj_t *obj)
+{
+    digit_label_t *dl = (digit_label_t *)obj;
+    digit_label_layout(obj);
+    digit_label_render(dl, dl->value, dl->text);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+}
+
+static void digit_label_draw(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_target(e);
+    digit_label_t *dl = (digit_label_t *)obj;
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &dsc);
+    if (dsc.opa <= LV_OPA_MIN) {
+        return;
+    }
+
+    lv_coord_t x0 = obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    lv_coord_t y0 = obj->coords.y1 + lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+
+    for (uint8_t i = 0; i < dl->slots; i++) {
+        if (dl->text[i] == ' ') {
+            continue;
+        }
+        lv_area_t slot = {
+            x0 + dl->slot_x[i], y0,
+            x0 + dl->slot_x[i + 1] - 1, y0 + dl->line_h - 1
+        };
+        if (!_lv_area_is_on(&slot, draw_ctx->clip_area)) {
+            continue;
+        }
+        // Centre the glyph in its slot so narrow digits like '1' do not shift the others
+        lv_coord_t gw = lv_font_get_glyph_width(dsc.font, dl->text[i], 0);
+        lv_point_t pos = {slot.x1 + (lv_area_get_width(&slot) - gw) / 2, y0};
+        lv_draw_letter(draw_ctx, &dsc, &pos, dl->text[i]);
+    }
+
+    if (dl->suffix) {
+        lv_area_t area = {
+            x0 + dl->slot_x[dl->slots], y0,
+            x0 + dl->slot_x[dl->slots] + dl->suffix_w - 1, y0 + dl->line_h - 1
+        };
+        lv_draw_label(draw_ctx, &dsc, &area, dl->suffix, NULL);
+    }
+}
+
+static void digit_label_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj)
+{
+    LV_UNUSED(class_p);
+    digit_label_t *dl = (digit_label_t *)obj;
+    dl->value = 0;
+    dl->suffix = NULL;
+    dl->int_digits = 1;
+    dl->frac_digits = 0;
+    dl->slots = 1;
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    digit_label_layout(obj);
+    digit_label_render(dl, dl->value, dl->text);
+}
+
+static void digit_label_event(const lv_obj_class_t *class_p, lv_event_t *e)
+{
+    LV_UNUSED(class_p);
+
+    if (lv_obj_event_base(MY_CLASS, e) != LV_RES_OK) {
+        return;
+    }
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+    digit_label_t *dl = (digit_label_t *)obj;
+
+    if (code == LV_EVENT_STYLE_CHANGED) {
+        digit_label_refresh(obj);
+    } else if (code == LV_EVENT_GET_SELF_SIZE) {
+        lv_point_t *p = (lv_point_t *)lv_event_get_param(e);
+        p->x = LV_MAX(p->x, dl->slot_x[dl->slots] + dl->suffix_w);
+        p->y = LV_MAX(p->y, dl->line_h);
+    } else if (code == LV_EVENT_DRAW_MAIN) {
+        digit_label_draw(e);
+    }
+}
+
+lv_obj_t *digit_label_create(lv_obj_t *parent)
+{
+    lv_obj_t *obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+void digit_label_set_format(lv_obj_t *obj, uint8_t int_digits, uint8_t frac_digits)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    digit_label_t *dl = (digit_label_t *)obj;
+
+    if (int_digits < 1) {
+        int_digits = 1;
+    }
+    if (int_digits + frac_digits > DIGIT_LABEL_MAX_DIGITS) {
+        frac_digits = int_digits < DIGIT_LABEL_MAX_DIGITS ? DIGIT_LABEL_MAX_DIGITS - int_digits : 0;
+        int_digits = LV_MIN(int_digits, DIGIT_LABEL_MAX_DIGITS);
+    }
+    if (dl->int_digits == int_digits && dl->frac_digits == frac_digits) {
+        return;
+    }
+    dl->int_digits = int_digits;
+    dl->frac_digits = frac_digits;
+    dl->slots = int_digits + frac_digits + (frac_digits ? 1 : 0);
+    digit_label_refresh(obj);
+}
+
+void digit_label_set_value(lv_obj_t *obj, int32_t value)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    digit_label_t *dl = (digit_label_t *)obj;
+
+    char text[DIGIT_LABEL_SLOTS];
+    digit_label_render(dl, value, text);
+    dl->value = value;
+
+    // Invalidate runs of changed slots, the rest of the label is left alone
+    int first = -1;
+    for (uint8_t i = 0; i <= dl->slots; i++) {
+        bool changed = i < dl->slots && text[i] != dl->text[i];
+        if (changed && first < 0) {
+            first = i;
+        } else if (!changed && first >= 0) {
+            digit_label_invalidate_slots(obj, first, i - 1);
+            first = -1;
+        }
+    }
+    memcpy(dl->text, text, dl->slots);
+}
+
+int32_t digit_label_get_value(lv_obj_t *obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    return ((digit_label_t *)obj)->value;
+}
+
+void digit_label_set_suffix(lv_obj_t *obj, const char *suffix)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    digit_label_t *dl = (digit_label_t *)obj;
+    dl->suffix = suffix;
+    digit_label_refresh(obj);
+}
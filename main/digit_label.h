@@ -0,0 +1,44 @@
+/**
+ * @file      digit_label.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DIGIT_LABEL_MAX_DIGITS  9
+
+/*
+ * Numeric label with fixed-width digit slots.
+ * Every digit gets a slot as wide as the widest digit of the font, so the
+ * layout never moves and a value change only invalidates the slots whose
+ * character changed. No text buffer is allocated.
+ */
+extern const lv_obj_class_t digit_label_class;
+
+lv_obj_t *digit_label_create(lv_obj_t *parent);
+
+// Number of integer and fractional digit slots, e.g. (2, 1) shows "89.5".
+// At most DIGIT_LABEL_MAX_DIGITS digits in total.
+void digit_label_set_format(lv_obj_t *obj, uint8_t int_digits, uint8_t frac_digits);
+
+// Fixed-point value scaled by 10^frac_digits, e.g. 895 shows "89.5"
+void digit_label_set_value(lv_obj_t *obj, int32_t value);
+
+int32_t digit_label_get_value(lv_obj_t *obj);
+
+// Text drawn after the digits, the string is not copied and must stay valid
+void digit_label_set_suffix(lv_obj_t *obj, const char *suffix);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,16 +7,26 @@
  *
  */
 
+#include <stdlib.h>
 #include <sdkconfig.h>
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_vendor.h"
 #include "esp_dma_utils.h"
+#include "esp_heap_caps.h"
 #include "driver/gpio.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "product_pins.h"
+#include "boot_splash.h"
+#include "trace_ring.h"
+#include "latency_probe.h"
+#include "display_pm.h"
+#include "touch_calib.h"
+#include "nvs_store.h"
 
 #if CONFIG_LILYGO_T_HMI
 
@@ -26,11 +36,26 @@
 #include "lvgl.h"
 #define EXAMPLE_LCD_PIXEL_CLOCK_HZ     (10 * 1000 * 1000)
 
+#define TOUCH_CALIB_NS          "touch"
+#define TOUCH_CALIB_KEY         "calib"
+#define TOUCH_CALIB_SKIP_KEY    "calib_skip"
+#define TOUCH_MAX_DEV           8           // px a single read may stray from the burst median
+#define TOUCH_CALIB_FIRST_MS    5000        // nobody at the panel, boot on uncalibrated
+#define TOUCH_CALIB_TIMEOUT_MS  15000
+#define TOUCH_CALIB_POLL_MS     20
+#define TOUCH_CALIB_HOLD        3           // matching reads that make a tap
+#define TOUCH_CALIB_CROSS       15
+#define TOUCH_CALIB_BAND_ROWS   8
+
 static const char *TAG = "HMI";
 
 static esp_lcd_panel_io_handle_t io_handle = NULL;
 static esp_lcd_panel_handle_t panel_handle = NULL;
 static esp_lcd_touch_handle_t tp = NULL;
+static SemaphoreHandle_t tp_lock = NULL;
+static touch_calib_t calib = TOUCH_CALIB_IDENTITY();
+static bool calib_valid = false;
+static volatile bool calibrating = false;
 
 extern lv_disp_drv_t disp_drv;
 
@@ -42,6 +67,12 @@ void display_push_colors(uint16_t x, uint16_t y, uint16_t width, uint16_t hight,
 
 bool display_notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
+    // The calibration screen is drawn before LVGL owns the panel
+    if (boot_splash_flush_ready() || calibrating) {
+        return false;
+    }
+    trace_flush_end();
+    latency_probe_flush_done(esp_timer_get_time());
     lv_disp_flush_ready(&disp_drv);
     return false;
 }
@@ -116,6 +147,7 @@ void display_init()
     };
     ESP_ERROR_CHECK(gpio_config(&bk_gpio_config));
     gpio_set_level(BOARD_TFT_BL, 1);
+    display_pm_attach_panel(panel_handle, io_handle);
 }
 
 
@@ -155,21 +187,190 @@ void board_hmi_touch_init()
     esp_lcd_touch_set_mirror_x(tp, true);
     esp_lcd_touch_set_mirror_y(tp, true);
 
-    ESP_LOGW(TAG, "Touch controller XPT2046 coordinates not calibrated");
+    tp_lock = xSemaphoreCreateMutex();
+    calib_valid = nvs_store_load(TOUCH_CALIB_NS, TOUCH_CALIB_KEY, &calib, sizeof(calib));
+    if (!calib_valid) {
+        ESP_LOGW(TAG, "Touch controller XPT2046 coordinates not calibrated");
+    }
 
 }
 
 
 
+// One oversampled point in the uncalibrated frame, lifted reads count against the burst
+static bool board_hmi_read_raw(uint16_t *x, uint16_t *y)
+{
+    touch_raw_sample_t samples[CONFIG_LILYGO_HMI_TOUCH_SAMPLES] = {0};
+    xSemaphoreTake(tp_lock, portMAX_DELAY);
+    for (int i = 0; i < CONFIG_LILYGO_HMI_TOUCH_SAMPLES; i++) {
+        uint16_t px, py, z;
+        uint8_t cnt = 0;
+        esp_lcd_touch_read_data(tp);
+        if (esp_lcd_touch_get_coordinates(tp, &px, &py, &z, &cnt, 1) && cnt) {
+            samples[i].x = px;
+            samples[i].y = AMOLED_HEIGHT - py;
+            samples[i].z = z ? z : 1;
+        }
+    }
+    xSemaphoreGive(tp_lock);
+    return touch_oversample(samples, CONFIG_LILYGO_HMI_TOUCH_SAMPLES, TOUCH_MAX_DEV, x, y);
+}
+
 uint8_t board_hmi_get_point(uint16_t *x, uint16_t *y)
 {
-    uint8_t touchpad_cnt = 0;
-    esp_lcd_touch_read_data(tp);
-    esp_lcd_touch_get_coordinates(tp, x, y, NULL, &touchpad_cnt, 1);
-    if (touchpad_cnt) {
-        *y = AMOLED_HEIGHT - *y;
+    uint16_t rx, ry;
+    if (calibrating || !board_hmi_read_raw(&rx, &ry)) {
+        return 0;
+    }
+    int16_t cx, cy;
+    touch_calib_apply(&calib, rx, ry, &cx, &cy);
+    // LVGL runs the panel in landscape
+    *x = cx < 0 ? 0 : cx >= AMOLED_HEIGHT ? AMOLED_HEIGHT - 1 : cx;
+    *y = cy < 0 ? 0 : cy >= AMOLED_WIDTH ? AMOLED_WIDTH - 1 : cy;
+    return 1;
+}
+
+bool board_hmi_touch_calibrated(void)
+{
+    return calib_valid;
+}
+
+bool board_hmi_touch_calib_wanted(void)
+{
+    uint16_t x, y;
+    uint8_t skipped;
+    // Holding the panel through boot asks for it again
+    if (board_hmi_read_raw(&x, &y)) {
+        return true;
+    }
+    return !calib_valid && !nvs_store_load(TOUCH_CALIB_NS, TOUCH_CALIB_SKIP_KEY, &skipped, sizeof(skipped));
+}
+
+esp_err_t board_hmi_touch_calib_erase(void)
+{
+    nvs_store_erase(TOUCH_CALIB_NS, TOUCH_CALIB_SKIP_KEY);
+    return nvs_store_erase(TOUCH_CALIB_NS, TOUCH_CALIB_KEY);
+}
+
+// The i80 DMA reads these after draw_bitmap returns, so they live in internal RAM
+static uint16_t *calib_black = NULL;
+static uint16_t *calib_white = NULL;
+
+static void calib_draw(int x, int y, int w, int h, const uint16_t *color)
+{
+    esp_lcd_panel_draw_bitmap(panel_handle, x, y, x + w, y + h, color);
+}
+
+static void calib_cross(touch_calib_point_t p, bool show)
+{
+    int half = TOUCH_CALIB_CROSS / 2;
+    if (show) {
+        calib_draw(p.x - half, p.y, TOUCH_CALIB_CROSS, 1, calib_white);
+        calib_draw(p.x, p.y - half, 1, TOUCH_CALIB_CROSS, calib_white);
+    } else {
+        calib_draw(p.x - half, p.y - half, TOUCH_CALIB_CROSS, TOUCH_CALIB_CROSS, calib_black);
+    }
+}
+
+// Wait for a steady press, then for the finger to lift
+static bool calib_tap(touch_calib_point_t *raw, int timeout_ms)
+{
+    uint16_t x, y, px = 0, py = 0;
+    int hold = 0;
+    uint32_t sx = 0, sy = 0;
+    for (int t = 0; t < timeout_ms; t += TOUCH_CALIB_POLL_MS) {
+        vTaskDelay(pdMS_TO_TICKS(TOUCH_CALIB_POLL_MS));
+        if (!board_hmi_read_raw(&x, &y)) {
+            hold = 0;
+            continue;
+        }
+        if (hold && (abs(x - px) > TOUCH_MAX_DEV || abs(y - py) > TOUCH_MAX_DEV)) {
+            hold = 0;
+        }
+        if (!hold) {
+            sx = sy = 0;
+        }
+        px = x;
+        py = y;
+        sx += x;
+        sy += y;
+        if (++hold == TOUCH_CALIB_HOLD) {
+            raw->x = sx / TOUCH_CALIB_HOLD;
+            raw->y = sy / TOUCH_CALIB_HOLD;
+            for (; t < timeout_ms && board_hmi_read_raw(&x, &y); t += TOUCH_CALIB_POLL_MS) {
+                vTaskDelay(pdMS_TO_TICKS(TOUCH_CALIB_POLL_MS));
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+esp_err_t board_hmi_touch_calibrate(void)
+{
+    const int w = AMOLED_HEIGHT;
+    const int h = AMOLED_WIDTH;
+    const touch_calib_point_t target[TOUCH_CALIB_POINTS] = {
+        {w / 10, h / 10}, {w * 9 / 10, h / 2}, {w / 2, h * 9 / 10},
+    };
+    touch_calib_point_t raw[TOUCH_CALIB_POINTS];
+    touch_calib_t cal;
+    esp_err_t ret = ESP_OK;
+    uint8_t skipped = 1;
+    bool first_untouched = false;
+
+    calib_black = heap_caps_calloc(w * TOUCH_CALIB_BAND_ROWS, sizeof(uint16_t), MALLOC_CAP_DMA);
+    calib_white = heap_caps_malloc(TOUCH_CALIB_CROSS * sizeof(uint16_t), MALLOC_CAP_DMA);
+    if (!calib_black || !calib_white) {
+        heap_caps_free(calib_black);
+        heap_caps_free(calib_white);
+        calib_black = calib_white = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    for (int i = 0; i < TOUCH_CALIB_CROSS; i++) {
+        calib_white[i] = 0xFFFF;
+    }
+
+    ESP_LOGI(TAG, "Touch calibration, tap the three crosses");
+    calibrating = true;
+    for (int y = 0; y < h; y += TOUCH_CALIB_BAND_ROWS) {
+        calib_draw(0, y, w, TOUCH_CALIB_BAND_ROWS, calib_black);
+    }
+    for (int i = 0; i < TOUCH_CALIB_POINTS && ret == ESP_OK; i++) {
+        calib_cross(target[i], true);
+        if (!calib_tap(&raw[i], i ? TOUCH_CALIB_TIMEOUT_MS : TOUCH_CALIB_FIRST_MS)) {
+            first_untouched = i == 0;
+            ret = ESP_ERR_TIMEOUT;
+        }
+        calib_cross(target[i], false);
+    }
+    // An untouched first cross is a skip, later boots no longer wait for it. A user
+    // who gave up on a later cross started calibrating and gets asked again.
+    if (first_untouched && !calib_valid) {
+        nvs_store_save(TOUCH_CALIB_NS, TOUCH_CALIB_SKIP_KEY, &skipped, sizeof(skipped));
+    }
+    if (ret == ESP_OK && !touch_calib_solve(raw, target, &cal)) {
+        ret = ESP_ERR_INVALID_RESPONSE;
+    }
+    if (ret == ESP_OK) {
+        calib = cal;
+        calib_valid = true;
+        ret = nvs_store_save(TOUCH_CALIB_NS, TOUCH_CALIB_KEY, &calib, sizeof(calib));
+    }
+    // Let the queued draws finish before flush callbacks go to LVGL again
+    vTaskDelay(pdMS_TO_TICKS(TOUCH_CALIB_POLL_MS));
+    calibrating = false;
+    heap_caps_free(calib_black);
+    heap_caps_free(calib_white);
+    calib_black = calib_white = NULL;
+
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Touch calibrated: %ld %ld %ld / %ld %ld %ld (Q16)", (long)calib.m[0], (long)calib.m[1],
+                 (long)calib.m[2], (long)calib.m[3], (long)calib.m[4], (long)calib.m[5]);
+    } else {
+        ESP_LOGW(TAG, "Touch calibration failed: %s", esp_err_to_name(ret));
     }
-    return touchpad_cnt;
+    return ret;
 }
 #endif
 
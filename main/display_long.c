@@ -7,6 +7,8 @@
  *
  */
 #include <sdkconfig.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include <driver/spi_master.h>
 #include <sys/cdefs.h>
 #include "driver/gpio.h"
@@ -15,6 +17,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include "esp_lcd_panel_vendor.h"
+#include "esp_lcd_panel_commands.h"
+#include "display_pm.h"
 
 #if CONFIG_LILYGO_T_DISPLAY_LONG
 
@@ -24,6 +28,9 @@
 static const char *TAG = "LONG";
 static spi_device_handle_t spi = NULL;
 static void amoled_write_cmd(uint32_t cmd, uint8_t *pdat, uint32_t lenght);
+static void init_write_cmd(void *user, uint8_t cmd, const uint8_t *param, uint8_t len);
+static void panel_idle(bool on);
+static void panel_sleep(bool on);
 
 
 #define delay(ms)   vTaskDelay(ms / portTICK_PERIOD_MS)
@@ -42,13 +49,6 @@ static void amoled_write_cmd(uint32_t cmd, uint8_t *pdat, uint32_t lenght);
 
 
 
-static const lcd_cmd_t vendor_config[] = {
-    {0x28, {0x00}, 0x40},
-    {0x10, {0x00}, 0x20},
-    {0x11, {0x00}, 0x80},
-    {0x29, {0x00}, 0x00},
-};
-
 static void pinMode(uint32_t gpio, uint8_t mode)
 {
     gpio_config_t config = {0};
@@ -139,24 +139,38 @@ bool display_init()
         return false;
     }
 
-    int i = 1;
-    while (i--) {
-        const lcd_cmd_t *lcd_init = vendor_config;
-        for (int i = 0; i < sizeof(vendor_config) / sizeof(lcd_cmd_t); i++) {
-            amoled_write_cmd(lcd_init[i].addr,
-                             lcd_init[i].param,
-                             lcd_init[i].len & 0x3f);
-            if (lcd_init[i].len & 0x80)
-                delay(200);
-            if (lcd_init[i].len & 0x40)
-                delay(20);
-        }
-    }
+    init_stream_ops_t ops = {
+        .write = init_write_cmd,
+    };
+    init_stream_run(&axs15231b_init, &ops);
+    display_pm_attach_commands(panel_idle, panel_sleep);
 
     digitalWrite(BOARD_DISP_BL, HIGH);
     return true;
 }
 
+// Display power management runs these from the LVGL task, between flushes
+static void panel_idle(bool on)
+{
+    amoled_write_cmd(on ? LCD_CMD_IDMON : LCD_CMD_IDMOFF, NULL, 0);
+}
+
+static void panel_sleep(bool on)
+{
+    if (on) {
+        amoled_write_cmd(LCD_CMD_SLPIN, NULL, 0);
+    } else {
+        amoled_write_cmd(LCD_CMD_SLPOUT, NULL, 0);
+        vTaskDelay(pdMS_TO_TICKS(DISPLAY_PM_SLPOUT_SETTLE_MS));
+        amoled_write_cmd(LCD_CMD_DISPON, NULL, 0);
+    }
+}
+
+static void init_write_cmd(void *user, uint8_t cmd, const uint8_t *param, uint8_t len)
+{
+    amoled_write_cmd(cmd, (uint8_t *)param, len);
+}
+
 static void amoled_write_cmd(uint32_t cmd, uint8_t *pdat, uint32_t lenght)
 {
     setCS();
@@ -0,0 +1,357 @@
+/**
+ * @file      display_pm.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "display_pm.h"
+
+static void pm_brightness(display_pm_t *pm, uint8_t level)
+{
+    if (level != pm->level && pm->ops.brightness) {
+        pm->ops.brightness(pm->ops.user, level);
+    }
+    pm->level = level;
+}
+
+void display_pm_init(display_pm_t *pm, const display_pm_ops_t *ops, const display_pm_config_t *cfg, int64_t now_us)
+{
+    memset(pm, 0, sizeof(*pm));
+    pm->ops = *ops;
+    pm->cfg = *cfg;
+    pm->state = DISPLAY_PM_ACTIVE;
+    pm->input_us = now_us;
+    pm->level = cfg->bright;
+    if (pm->ops.brightness) {
+        pm->ops.brightness(pm->ops.user, cfg->bright);
+    }
+}
+
+bool display_pm_input(display_pm_t *pm, int64_t now_us)
+{
+    display_pm_state_t was = pm->state;
+    pm->input_us = now_us;
+    if (was == DISPLAY_PM_ACTIVE) {
+        return false;
+    }
+    if (was == DISPLAY_PM_SLEEP && pm->ops.sleep) {
+        pm->ops.sleep(pm->ops.user, false);
+    }
+    if (was >= DISPLAY_PM_IDLE && pm->ops.idle) {
+        pm->ops.idle(pm->ops.user, false);
+    }
+    pm->state = DISPLAY_PM_ACTIVE;
+    pm_brightness(pm, pm->cfg.bright);
+    return was == DISPLAY_PM_SLEEP;
+}
+
+static uint32_t pm_until(uint32_t stage_ms, int64_t quiet_ms, uint32_t next)
+{
+    if (!stage_ms || stage_ms <= quiet_ms) {
+        return next;
+    }
+    uint32_t left = (uint32_t)(stage_ms - quiet_ms);
+    return left < next ? left : next;
+}
+
+uint32_t display_pm_tick(display_pm_t *pm, int64_t now_us)
+{
+    const display_pm_config_t *c = &pm->cfg;
+    int64_t quiet_ms = (now_us - pm->input_us) / 1000;
+
+    if (pm->state == DISPLAY_PM_ACTIVE && c->dim_ms && quiet_ms >= c->dim_ms) {
+        pm->state = DISPLAY_PM_DIMMED;
+        pm->fade_us = now_us;
+        pm->fade_from = pm->level;
+    }
+    int64_t fade_ms = (now_us - pm->fade_us) / 1000;
+    if (pm->state == DISPLAY_PM_DIMMED) {
+        if (fade_ms >= c->fade_ms) {
+            pm_brightness(pm, c->dim);
+        } else {
+            pm_brightness(pm, pm->fade_from + ((int)c->dim - pm->fade_from) * fade_ms / (int64_t)c->fade_ms);
+        }
+    }
+    if (pm->state < DISPLAY_PM_IDLE && c->idle_ms && quiet_ms >= c->idle_ms) {
+        // A late tick may skip the rest of the fade
+        if (pm->state == DISPLAY_PM_DIMMED) {
+            pm_brightness(pm, c->dim);
+        }
+        if (pm->ops.idle) {
+            pm->ops.idle(pm->ops.user, true);
+        }
+        pm->state = DISPLAY_PM_IDLE;
+    }
+    if (pm->state < DISPLAY_PM_SLEEP && c->sleep_ms && quiet_ms >= c->sleep_ms) {
+        pm_brightness(pm, 0);
+        if (pm->ops.sleep) {
+            pm->ops.sleep(pm->ops.user, true);
+        }
+        pm->state = DISPLAY_PM_SLEEP;
+    }
+
+    if (pm->state == DISPLAY_PM_DIMMED && fade_ms < c->fade_ms) {
+        return DISPLAY_PM_FADE_STEP_MS;
+    }
+    uint32_t next = UINT32_MAX;
+    if (pm->state < DISPLAY_PM_DIMMED) {
+        next = pm_until(c->dim_ms, quiet_ms, next);
+    }
+    if (pm->state < DISPLAY_PM_IDLE) {
+        next = pm_until(c->idle_ms, quiet_ms, next);
+    }
+    if (pm->state < DISPLAY_PM_SLEEP) {
+        next = pm_until(c->sleep_ms, quiet_ms, next);
+    }
+    return next;
+}
+
+void display_pm_set_bright(display_pm_t *pm, uint8_t level)
+{
+    pm->cfg.bright = level;
+    if (pm->state == DISPLAY_PM_ACTIVE) {
+        pm_brightness(pm, level);
+    }
+}
+
+const char *display_pm_state_name(display_pm_state_t state)
+{
+    switch (state) {
+    case DISPLAY_PM_ACTIVE:
+        return "active";
+    case DISPLAY_PM_DIMMED:
+        return "dimmed";
+    case DISPLAY_PM_IDLE:
+        return "idle";
+    default:
+        return "sleep";
+    }
+}
+
+#if defined(ESP_PLATFORM) && CONFIG_LILYGO_DISPLAY_PM
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "esp_lcd_panel_commands.h"
+#include "driver/ledc.h"
+#include "product_pins.h"
+#include "lvgl.h"
+
+#if defined(CONFIG_LILYGO_T_AMOLED_LITE_147) || \
+    defined(CONFIG_LILYGO_T_DISPLAY_S3_AMOLED) || \
+    defined(CONFIG_LILYGO_T_DISPLAY_S3_AMOLED_TOUCH) || \
+    defined(CONFIG_LILYGO_T4_S3_241)
+#include "amoled_driver.h"
+#define PM_AMOLED               1
+#define PM_BRIGHT               AMOLED_DEFAULT_BRIGHTNESS
+#else
+#define PM_AMOLED               0
+#define PM_BRIGHT               255
+#if defined(BOARD_TFT_BL)
+#define PM_BACKLIGHT_PIN        BOARD_TFT_BL
+#elif defined(BOARD_DISP_BL)
+#define PM_BACKLIGHT_PIN        BOARD_DISP_BL
+#endif
+#endif
+
+// Backlights lit with the pin low
+#if CONFIG_LILYGO_T_QT_S3 || CONFIG_LILYGO_T_QT_C6 || CONFIG_LILYGO_T_DONGLE_S3
+#define PM_BACKLIGHT_INVERT     1
+#else
+#define PM_BACKLIGHT_INVERT     0
+#endif
+
+#define PM_LEDC_MODE            LEDC_LOW_SPEED_MODE
+#define PM_LEDC_TIMER           LEDC_TIMER_0
+#define PM_LEDC_CHANNEL         LEDC_CHANNEL_0
+#define PM_LEDC_FREQ_HZ         20000       // above hearing, some backlight inductors sing
+#define PM_IDLE_PERIOD_MS       1000
+
+static const char *TAG = "display_pm";
+
+// What the console sees, pm itself is only touched from the LVGL task
+typedef struct {
+    bool running;
+    display_pm_state_t state;
+    uint8_t level;
+    int64_t input_us;
+} pm_view_t;
+
+static display_pm_t pm;
+static bool running = false;
+static pm_view_t view;
+static portMUX_TYPE view_lock = portMUX_INITIALIZER_UNLOCKED;
+static esp_lcd_panel_handle_t pm_panel = NULL;
+static esp_lcd_panel_io_handle_t pm_io = NULL;
+static void (*pm_cmd_idle)(bool on) = NULL;
+static void (*pm_cmd_sleep)(bool on) = NULL;
+
+void display_pm_attach_panel(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io)
+{
+    pm_panel = panel;
+    pm_io = io;
+}
+
+void display_pm_attach_commands(void (*idle)(bool on), void (*sleep)(bool on))
+{
+    pm_cmd_idle = idle;
+    pm_cmd_sleep = sleep;
+}
+
+#ifdef PM_BACKLIGHT_PIN
+static esp_err_t backlight_init(uint8_t level)
+{
+    ledc_timer_config_t timer = {
+        .speed_mode = PM_LEDC_MODE,
+        .duty_resolution = LEDC_TIMER_8_BIT,
+        .timer_num = PM_LEDC_TIMER,
+        .freq_hz = PM_LEDC_FREQ_HZ,
+        .clk_cfg = LEDC_AUTO_CLK,
+    };
+    esp_err_t ret = ledc_timer_config(&timer);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // Takes the pin over from the GPIO the backend lit it with
+    ledc_channel_config_t channel = {
+        .gpio_num = PM_BACKLIGHT_PIN,
+        .speed_mode = PM_LEDC_MODE,
+        .channel = PM_LEDC_CHANNEL,
+        .timer_sel = PM_LEDC_TIMER,
+        .duty = level == 255 ? 256 : level,
+        .flags.output_invert = PM_BACKLIGHT_INVERT,
+    };
+    return ledc_channel_config(&channel);
+}
+
+static void backlight_set(uint8_t level)
+{
+    // 256 keeps the output high the whole period
+    ledc_set_duty(PM_LEDC_MODE, PM_LEDC_CHANNEL, level == 255 ? 256 : level);
+    ledc_update_duty(PM_LEDC_MODE, PM_LEDC_CHANNEL);
+}
+#endif
+
+static void panel_brightness(void *user, uint8_t level)
+{
+#if PM_AMOLED
+    amoled_set_brightness(level);
+#elif defined(PM_BACKLIGHT_PIN)
+    backlight_set(level);
+#endif
+}
+
+static void panel_idle(void *user, bool on)
+{
+#if PM_AMOLED
+    amoled_set_idle(on);
+#else
+    if (pm_cmd_idle) {
+        pm_cmd_idle(on);
+    } else if (pm_io) {
+        esp_lcd_panel_io_tx_param(pm_io, on ? LCD_CMD_IDMON : LCD_CMD_IDMOFF, NULL, 0);
+    }
+#endif
+}
+
+static void panel_sleep(void *user, bool on)
+{
+#if PM_AMOLED
+    amoled_sleep(on);
+#else
+    if (pm_cmd_sleep) {
+        pm_cmd_sleep(on);
+    } else if (pm_panel) {
+        esp_lcd_panel_disp_sleep(pm_panel, on);
+    }
+#endif
+}
+
+static void view_publish(void)
+{
+    taskENTER_CRITICAL(&view_lock);
+    view.running = running;
+    view.state = pm.state;
+    view.level = pm.level;
+    view.input_us = pm.input_us;
+    taskEXIT_CRITICAL(&view_lock);
+}
+
+static void display_pm_timer_cb(lv_timer_t *timer)
+{
+    uint32_t next = display_pm_tick(&pm, esp_timer_get_time());
+    view_publish();
+    if (next == UINT32_MAX) {
+        next = PM_IDLE_PERIOD_MS;
+    }
+    lv_timer_set_period(timer, next < DISPLAY_PM_FADE_STEP_MS ? DISPLAY_PM_FADE_STEP_MS : next);
+}
+
+esp_err_t display_pm_start(void)
+{
+#if !BOARD_HAS_TOUCH
+    ESP_LOGW(TAG, "no touch to wake the display, power management stays off");
+    return ESP_ERR_NOT_SUPPORTED;
+#else
+    if (running) {
+        return ESP_OK;
+    }
+#ifdef PM_BACKLIGHT_PIN
+    esp_err_t ret = backlight_init(PM_BRIGHT);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "backlight PWM: %s", esp_err_to_name(ret));
+        return ret;
+    }
+#endif
+    const display_pm_config_t cfg = {
+        .dim_ms = CONFIG_LILYGO_DISPLAY_PM_DIM_S * 1000,
+        .idle_ms = CONFIG_LILYGO_DISPLAY_PM_IDLE_S * 1000,
+        .sleep_ms = CONFIG_LILYGO_DISPLAY_PM_SLEEP_S * 1000,
+        .fade_ms = CONFIG_LILYGO_DISPLAY_PM_FADE_MS,
+        .bright = PM_BRIGHT,
+        .dim = PM_BRIGHT * CONFIG_LILYGO_DISPLAY_PM_DIM_PERCENT / 100,
+    };
+    const display_pm_ops_t ops = {
+        .brightness = panel_brightness,
+        .idle = panel_idle,
+        .sleep = panel_sleep,
+    };
+    display_pm_init(&pm, &ops, &cfg, esp_timer_get_time());
+    if (!lv_timer_create(display_pm_timer_cb, DISPLAY_PM_FADE_STEP_MS, NULL)) {
+        return ESP_ERR_NO_MEM;
+    }
+    running = true;
+    view_publish();
+    ESP_LOGI(TAG, "dim %us, idle %us, sleep %us", CONFIG_LILYGO_DISPLAY_PM_DIM_S,
+             CONFIG_LILYGO_DISPLAY_PM_IDLE_S, CONFIG_LILYGO_DISPLAY_PM_SLEEP_S);
+    return ESP_OK;
+#endif
+}
+
+bool display_pm_touch(void)
+{
+    if (!running) {
+        return false;
+    }
+    bool woke = display_pm_input(&pm, esp_timer_get_time());
+    view_publish();
+    return woke;
+}
+
+void display_pm_print(FILE *out)
+{
+    taskENTER_CRITICAL(&view_lock);
+    pm_view_t v = view;
+    taskEXIT_CRITICAL(&view_lock);
+    if (!v.running) {
+        fputs("display power management not running\n", out);
+        return;
+    }
+    fprintf(out, "display %s, level %u, %lld ms since the last touch\n", display_pm_state_name(v.state),
+            v.level, (long long)((esp_timer_get_time() - v.input_us) / 1000));
+}
+
+#endif
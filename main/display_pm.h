@@ -0,0 +1,119 @@
+/**
+ * @file      display_pm.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISPLAY_PM_FADE_STEP_MS     20
+
+typedef enum {
+    DISPLAY_PM_ACTIVE,
+    DISPLAY_PM_DIMMED,          // fading or faded to the dim level
+    DISPLAY_PM_IDLE,            // controller idle / low colour mode
+    DISPLAY_PM_SLEEP,           // SLPIN, backlight off
+} display_pm_state_t;
+
+// Stage timeouts count from the last input, 0 skips the stage
+typedef struct {
+    uint32_t dim_ms;
+    uint32_t idle_ms;
+    uint32_t sleep_ms;
+    uint32_t fade_ms;
+    uint8_t bright;
+    uint8_t dim;
+} display_pm_config_t;
+
+// Panel controls, any of them may be NULL
+typedef struct {
+    void (*brightness)(void *user, uint8_t level);
+    void (*idle)(void *user, bool on);
+    void (*sleep)(void *user, bool on);
+    void *user;
+} display_pm_ops_t;
+
+typedef struct {
+    display_pm_ops_t ops;
+    display_pm_config_t cfg;
+    display_pm_state_t state;
+    int64_t input_us;
+    int64_t fade_us;
+    uint8_t fade_from;
+    uint8_t level;
+} display_pm_t;
+
+/*
+ * Idle state machine: ACTIVE fades to the dim level, then enters the
+ * controller idle mode, then sleeps the panel. Any input goes straight back
+ * to ACTIVE at full brightness. Times are passed in so the transitions run
+ * on host against a fake clock.
+ */
+void display_pm_init(display_pm_t *pm, const display_pm_ops_t *ops, const display_pm_config_t *cfg, int64_t now_us);
+
+// True when the display was asleep, the input only woke it
+bool display_pm_input(display_pm_t *pm, int64_t now_us);
+
+// Advance the stages, returns ms until the next call is due, UINT32_MAX for none
+uint32_t display_pm_tick(display_pm_t *pm, int64_t now_us);
+
+// New full brightness, applied now unless the display is dimmed or off
+void display_pm_set_bright(display_pm_t *pm, uint8_t level);
+
+const char *display_pm_state_name(display_pm_state_t state);
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+
+#define DISPLAY_PM_SLPOUT_SETTLE_MS 120
+
+#if CONFIG_LILYGO_DISPLAY_PM
+
+// TFT backends hand over their panel for SLPIN and idle mode, the backlight is found by pin
+void display_pm_attach_panel(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io);
+
+// Backends without an esp_lcd command channel hand over their own idle and sleep commands instead
+void display_pm_attach_commands(void (*idle)(bool on), void (*sleep)(bool on));
+
+/*
+ * Runs the board display from an LVGL timer, call with the LVGL lock
+ * held. display_pm_touch() is for the touch read callback, it returns
+ * true when the press only woke the display and should not reach the UI.
+ */
+esp_err_t display_pm_start(void);
+bool display_pm_touch(void);
+void display_pm_print(FILE *out);
+
+#else
+
+static inline void display_pm_attach_panel(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io) {}
+static inline void display_pm_attach_commands(void (*idle)(bool on), void (*sleep)(bool on)) {}
+static inline esp_err_t display_pm_start(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+static inline bool display_pm_touch(void)
+{
+    return false;
+}
+static inline void display_pm_print(FILE *out) {}
+
+#endif
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -18,10 +18,17 @@
 #include "esp_log.h"
 #include "product_pins.h"
 #include "i2c_driver.h"
+#include "boot_splash.h"
+#include "trace_ring.h"
+#include "latency_probe.h"
+#include "nvs_store.h"
+#include "xl9555.h"
+#include "display_pm.h"
+#include "esp_lcd_panel_commands.h"
+#include "esp_timer.h"
 
 #if CONFIG_LILYGO_T_RGB
 
-#include "ExtensionIOXL9555.hpp"
 #include "TouchDrvGT911.hpp"
 #include "TouchDrvFT6X36.hpp"
 #include "TouchDrvCSTXXX.hpp"
@@ -36,69 +43,108 @@ static esp_lcd_panel_handle_t panel_handle = NULL;
 
 extern lv_disp_drv_t disp_drv;
 
-const lcd_cmd_t *init_cmd = st7701_2_1_inches;
+const init_stream_t *init_stream = &st7701_2_1_init;
 extern i2c_master_bus_handle_t bus_handle;
 TouchDrvInterface *touchDrv;
 void *buf1 = NULL;
 void *buf2 = NULL;
 
-ExtensionIOXL9555 extension;
-ExtensionIOXL9555::ExtensionGPIO cs = ExtensionIOXL9555::IO3;
-ExtensionIOXL9555::ExtensionGPIO mosi = ExtensionIOXL9555::IO4;
-ExtensionIOXL9555::ExtensionGPIO sclk = ExtensionIOXL9555::IO5;
-ExtensionIOXL9555::ExtensionGPIO reset = ExtensionIOXL9555::IO6;
-ExtensionIOXL9555::ExtensionGPIO power_enable = ExtensionIOXL9555::IO2;
-ExtensionIOXL9555::ExtensionGPIO sdmmc_cs = ExtensionIOXL9555::IO7;
-ExtensionIOXL9555::ExtensionGPIO tp_reset = ExtensionIOXL9555::IO1;
+// XL9555 pins
+enum {
+    EXPANDER_TP_RESET = 1,
+    EXPANDER_POWER_EN = 2,
+    EXPANDER_LCD_CS = 3,
+    EXPANDER_LCD_MOSI = 4,
+    EXPANDER_LCD_SCLK = 5,
+    EXPANDER_LCD_RESET = 6,
+    EXPANDER_SDMMC_CS = 7,
+};
+
+// Touch callbacks take expander pins with this flag set
+#define EXPANDER_PIN_FLAG   0x80
+
+static xl9555_t expander;
+static bool expander_online = false;
+static const xl9555_spi9_t panel_spi = {
+    .cs = EXPANDER_LCD_CS,
+    .sclk = EXPANDER_LCD_SCLK,
+    .mosi = EXPANDER_LCD_MOSI,
+};
+
+static bool expander_begin()
+{
+    if (!expander_online) {
+        expander_online = xl9555_init_i2c(&expander, XL9555_ADDR_DEFAULT) == 0;
+    }
+    return expander_online;
+}
 
 
 extern "C" void display_push_colors(uint16_t x, uint16_t y, uint16_t width, uint16_t hight, uint16_t *data)
 {
     esp_lcd_panel_draw_bitmap(panel_handle, x, y, width, hight, data);
-    lv_disp_flush_ready(&disp_drv);
+    if (!boot_splash_flush_ready()) {
+        trace_flush_end();
+        latency_probe_flush_done(esp_timer_get_time());
+        lv_disp_flush_ready(&disp_drv);
+    }
+}
+
+// One 9-bit word per byte sent, the data/command flag is bit 8
+static void initWriteCmd(void *user, uint8_t cmd, const uint8_t *param, uint8_t len)
+{
+    uint16_t words[1 + INIT_STREAM_MAX_PARAMS];
+    words[0] = cmd;
+    for (int i = 0; i < len; i++) {
+        words[1 + i] = param[i] | 1 << 8;
+    }
+    xl9555_spi9_write(&expander, &panel_spi, words, 1 + len);
 }
 
-static void writeCommand(const uint8_t cmd)
+// The RGB timing keeps running, the controller takes these over the expander SPI
+static void panelIdle(bool on)
 {
-    uint16_t data = cmd;
-    extension.transfer9(data);
+    initWriteCmd(NULL, on ? LCD_CMD_IDMON : LCD_CMD_IDMOFF, NULL, 0);
 }
 
-static void writeData(const uint8_t *data, int len)
+static void panelSleep(bool on)
 {
-    uint32_t i = 0;
-    if (len == 0)
-        return; // no need to send anything
-    do {
-        uint16_t pdat = (*(data + i)) | 1 << 8;
-        extension.transfer9(pdat);
-        i++;
-    } while (len--);
+    if (on) {
+        initWriteCmd(NULL, LCD_CMD_SLPIN, NULL, 0);
+    } else {
+        initWriteCmd(NULL, LCD_CMD_SLPOUT, NULL, 0);
+        vTaskDelay(pdMS_TO_TICKS(DISPLAY_PM_SLPOUT_SETTLE_MS));
+        initWriteCmd(NULL, LCD_CMD_DISPON, NULL, 0);
+    }
 }
 
 extern "C" void display_init()
 {
-    assert(init_cmd);
+    assert(init_stream);
 
     ESP_LOGI(TAG, "============T-RGB==============");
 
-    extension.pinMode(reset, OUTPUT);
-    extension.digitalWrite(reset, LOW);
-    delay(20);
-    extension.digitalWrite(reset, HIGH);
-    delay(10);
-
-    ESP_LOGI(TAG, "Extension BEGIN SPI SUCCESS !");
-    extension.beginSPI(mosi, -1, sclk, cs);
-
-    int i = 0;
-    while (init_cmd[i].len != 0xff) {
-        writeCommand(init_cmd[i].addr);
-        writeData(init_cmd[i].param, init_cmd[i].len & 0x1F);
-        if (init_cmd[i].len & 0x80) {
-            delay(100);
-        }
-        i++;
+    if (expander_begin()) {
+        // Reset low and the SPI idle levels go out together
+        xl9555_batch_begin(&expander);
+        xl9555_write(&expander, EXPANDER_LCD_RESET, false);
+        xl9555_pin_mode(&expander, EXPANDER_LCD_RESET, true);
+        xl9555_spi9_begin(&expander, &panel_spi);
+        xl9555_batch_end(&expander);
+        delay(20);
+        xl9555_write(&expander, EXPANDER_LCD_RESET, true);
+        delay(10);
+
+        int64_t start = esp_timer_get_time();
+        init_stream_ops_t ops = {
+            .write = initWriteCmd,
+        };
+        uint32_t cmds = init_stream_run(init_stream, &ops);
+        ESP_LOGI(TAG, "Panel init, %u commands in %lld ms", (unsigned)cmds,
+                 (long long)((esp_timer_get_time() - start) / 1000));
+        display_pm_attach_commands(panelIdle, panelSleep);
+    } else {
+        ESP_LOGE(TAG, "ERROR : XL9555 NO ON LINE!!!");
     }
 
     esp_lcd_rgb_panel_config_t panel_config = {
@@ -190,8 +236,8 @@ extern "C" void display_init()
 
 void TouchDrvDigitalWrite(uint32_t gpio, uint8_t level)
 {
-    if (gpio & 0x80) {
-        extension.digitalWrite(gpio & 0x7F, level);
+    if (gpio & EXPANDER_PIN_FLAG) {
+        xl9555_write(&expander, gpio & ~EXPANDER_PIN_FLAG, level);
     } else {
         digitalWrite(gpio, level);
     }
@@ -199,8 +245,8 @@ void TouchDrvDigitalWrite(uint32_t gpio, uint8_t level)
 
 int TouchDrvDigitalRead(uint32_t gpio)
 {
-    if (gpio & 0x80) {
-        return extension.digitalRead(gpio & 0x7F);
+    if (gpio & EXPANDER_PIN_FLAG) {
+        return xl9555_read(&expander, gpio & ~EXPANDER_PIN_FLAG);
     } else {
         return digitalRead(gpio);
     }
@@ -208,71 +254,146 @@ int TouchDrvDigitalRead(uint32_t gpio)
 
 void TouchDrvPinMode(uint32_t gpio, uint8_t mode)
 {
-    if (gpio & 0x80) {
-        extension.pinMode(gpio & 0x7F, mode);
+    if (gpio & EXPANDER_PIN_FLAG) {
+        xl9555_pin_mode(&expander, gpio & ~EXPANDER_PIN_FLAG, mode == OUTPUT);
     } else {
         pinMode(gpio, mode);
     }
 }
 
+typedef enum {
+    TOUCH_MODEL_CST8XX,
+    TOUCH_MODEL_FT6X36,
+    TOUCH_MODEL_GT911,
+    TOUCH_MODEL_MAX,
+} rgb_touch_model_t;
+
+enum {
+    PANEL_2_1_INCHES,
+    PANEL_2_8_INCHES,
+};
+
+typedef struct {
+    const char *name;
+    uint8_t address;
+    uint8_t panel_variant;
+    const init_stream_t *panel;
+} rgb_touch_probe_t;
+
+// Probe order of the first boot, the touch controller tells the panel variant apart
+static const rgb_touch_probe_t touch_probes[TOUCH_MODEL_MAX] = {
+    {"CST8XX", CST816_SLAVE_ADDRESS, PANEL_2_1_INCHES, &st7701_2_1_init},
+    {"FT6X36", FT3267_SLAVE_ADDRESS, PANEL_2_1_INCHES, &st7701_2_1_init},
+    {"GT911", GT911_SLAVE_ADDRESS_L, PANEL_2_8_INCHES, &st7701_2_8_init},
+};
+
+#define TOUCH_CACHE_NS          "board"
+#define TOUCH_CACHE_KEY         "rgb_touch"
+#define TOUCH_CACHE_VERSION     1
+
+typedef struct {
+    uint8_t version;
+    uint8_t model;
+    uint8_t panel_variant;
+} rgb_touch_cache_t;
+
+static bool touch_probe(rgb_touch_model_t model, uint8_t reset_pin, uint8_t irq_pin)
+{
+    const rgb_touch_probe_t *probe = &touch_probes[model];
+    int64_t start = esp_timer_get_time();
+
+    switch (model) {
+    case TOUCH_MODEL_CST8XX:
+        touchDrv = new TouchDrvCSTXXX();
+        break;
+    case TOUCH_MODEL_FT6X36:
+        touchDrv = new TouchDrvFT6X36();
+        break;
+    default:
+        touchDrv = new TouchDrvGT911();
+        break;
+    }
+    touchDrv->setGpioCallback(TouchDrvPinMode, TouchDrvDigitalWrite, TouchDrvDigitalRead);
+    touchDrv->setPins(reset_pin, irq_pin);
+    bool result = touchDrv->begin(bus_handle, probe->address);
+
+    ESP_LOGI(TAG, "probe %-6s @0x%02x: %s in %lld ms", probe->name, probe->address,
+             result ? "found" : "absent", (long long)((esp_timer_get_time() - start) / 1000));
+
+    if (!result) {
+        delete touchDrv;
+        touchDrv = NULL;
+        return false;
+    }
+    if (model == TOUCH_MODEL_CST8XX) {
+        static_cast<TouchDrvCSTXXX *>(touchDrv)->disableAutoSleep();
+    }
+    return true;
+}
+
 extern "C"  bool board_rgb_touch_init()
 {
 
-    const uint8_t touch_reset_pin = tp_reset | 0x80;
+    const uint8_t touch_reset_pin = EXPANDER_TP_RESET | EXPANDER_PIN_FLAG;
     const uint8_t touch_irq_pin = BOARD_TOUCH_IRQ;
 
     ESP_LOGI(TAG, "=================setupTouchDrv====================");
 
-    bool result = false;
-
-    if (!extension.begin(bus_handle,  XL9555_SLAVE_ADDRESS0)) {
+    if (!expander_begin()) {
         ESP_LOGE(TAG, "ERROR : XL9555 NO ON LINE!!!");
         return false;
     }
 
-    extension.pinMode(power_enable, OUTPUT);
-    extension.digitalWrite(power_enable, HIGH);
-
-    extension.pinMode(sdmmc_cs, OUTPUT);
-    extension.digitalWrite(sdmmc_cs, HIGH);
-
-    touchDrv = new TouchDrvCSTXXX();
-    touchDrv->setGpioCallback(TouchDrvPinMode, TouchDrvDigitalWrite, TouchDrvDigitalRead);
-    touchDrv->setPins(touch_reset_pin, touch_irq_pin);
-    result = touchDrv->begin(bus_handle, CST816_SLAVE_ADDRESS);
-    if (result) {
-        init_cmd = st7701_2_1_inches;
-        const char *model = touchDrv->getModelName();
-        TouchDrvCSTXXX *drv = static_cast<TouchDrvCSTXXX *>(touchDrv);
-        drv->disableAutoSleep();
-        ESP_LOGI(TAG, "Successfully initialized %s, using %s Driver!", model, model);
-        return true;
-    }
-
-    delete touchDrv;
-
-    touchDrv = new TouchDrvFT6X36();
-    touchDrv->setGpioCallback(TouchDrvPinMode, TouchDrvDigitalWrite, TouchDrvDigitalRead);
-    touchDrv->setPins(touch_reset_pin, touch_irq_pin);
-    result = touchDrv->begin(bus_handle, FT3267_SLAVE_ADDRESS);
-    if (result) {
-        init_cmd = st7701_2_1_inches;
-        ESP_LOGI(TAG, "Successfully initialized FT63X6, using FT63X6 Driver!");
-        return true;
+    // One write per register pair instead of a read-modify-write per call
+    xl9555_batch_begin(&expander);
+    xl9555_write(&expander, EXPANDER_POWER_EN, true);
+    xl9555_pin_mode(&expander, EXPANDER_POWER_EN, true);
+    xl9555_write(&expander, EXPANDER_SDMMC_CS, true);
+    xl9555_pin_mode(&expander, EXPANDER_SDMMC_CS, true);
+    xl9555_batch_end(&expander);
+
+    int64_t start = esp_timer_get_time();
+    rgb_touch_cache_t cache;
+    bool cached = nvs_store_load(TOUCH_CACHE_NS, TOUCH_CACHE_KEY, &cache, sizeof(cache)) &&
+                  cache.version == TOUCH_CACHE_VERSION && cache.model < TOUCH_MODEL_MAX &&
+                  cache.panel_variant == touch_probes[cache.model].panel_variant;
+
+    // Verify the controller found last time first, a full probe only runs on a miss
+    int found = -1;
+    if (cached && touch_probe((rgb_touch_model_t)cache.model, touch_reset_pin, touch_irq_pin)) {
+        found = cache.model;
+    } else {
+        // Controllers the bus map has seen go first, the rest may only answer after their reset
+        bool seen[TOUCH_MODEL_MAX];
+        for (int i = 0; i < TOUCH_MODEL_MAX; i++) {
+            seen[i] = i2c_drv_probe(touch_probes[i].address);
+        }
+        for (int pass = 0; pass < 2 && found < 0; pass++) {
+            for (int i = 0; i < TOUCH_MODEL_MAX; i++) {
+                if ((cached && i == cache.model) || seen[i] != (pass == 0)) {
+                    continue;
+                }
+                if (touch_probe((rgb_touch_model_t)i, touch_reset_pin, touch_irq_pin)) {
+                    found = i;
+                    break;
+                }
+            }
+        }
     }
 
-    delete touchDrv;
-
-    touchDrv = new TouchDrvGT911();
-    touchDrv->setGpioCallback(TouchDrvPinMode, TouchDrvDigitalWrite, TouchDrvDigitalRead);
-    touchDrv->setPins(touch_reset_pin, touch_irq_pin);
-    result = touchDrv->begin(bus_handle, GT911_SLAVE_ADDRESS_L);
-    if (result) {
-        init_cmd = st7701_2_8_inches;
-        ESP_LOGI(TAG, "Successfully initialized GT911, using GT911 Driver!");
+    ESP_LOGI(TAG, "touch probe %s, %lld ms total",
+             found < 0 ? "failed" : (cached && found == cache.model) ? "hit the cache" : "ran in full",
+             (long long)((esp_timer_get_time() - start) / 1000));
+
+    if (found >= 0) {
+        const rgb_touch_probe_t *probe = &touch_probes[found];
+        init_stream = probe->panel;
+        rgb_touch_cache_t record = {TOUCH_CACHE_VERSION, (uint8_t)found, probe->panel_variant};
+        nvs_store_save(TOUCH_CACHE_NS, TOUCH_CACHE_KEY, &record, sizeof(record));
+        ESP_LOGI(TAG, "Successfully initialized %s, using the %s panel", probe->name,
+                 probe->panel_variant == PANEL_2_8_INCHES ? "2.8 inch" : "2.1 inch");
         return true;
     }
-    delete touchDrv;
 
     touchDrv = NULL;
 
@@ -283,16 +404,13 @@ extern "C"  bool board_rgb_touch_init()
 
 
 
-extern "C" uint8_t board_rgb_get_point(uint16_t *x, uint16_t *y)
+extern "C" uint8_t board_rgb_get_point(int16_t *x, int16_t *y, uint8_t point_num)
 {
     uint8_t touchpad_cnt = 0;
-    static int16_t lastX = 0, lastY = 0;
     if (touchDrv) {
-        touchpad_cnt =  (touchDrv->getPoint(&lastX, &lastY, 1));
+        touchpad_cnt = touchDrv->getPoint(x, y, point_num);
         if (touchpad_cnt) {
-            ESP_LOGI(TAG, "X: %d Y:%d", lastX, lastY);
-            *x = lastX;
-            *y = lastY;
+            trace_touch(x[0], y[0], touchpad_cnt, 0);
         }
     }
     return touchpad_cnt;
@@ -12,7 +12,12 @@
 #include "esp_lcd_panel_vendor.h"
 #include "driver/gpio.h"
 #include "product_pins.h"
+#include "boot_splash.h"
+#include "trace_ring.h"
+#include "latency_probe.h"
+#include "display_pm.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "esp_idf_version.h"
 #include "driver/spi_master.h"
 
@@ -37,6 +42,11 @@ void display_push_colors(uint16_t x, uint16_t y, uint16_t width, uint16_t hight,
 
 bool display_notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
+    if (boot_splash_flush_ready()) {
+        return false;
+    }
+    trace_flush_end();
+    latency_probe_flush_done(esp_timer_get_time());
     lv_disp_flush_ready(&disp_drv);
     return false;
 }
@@ -91,6 +101,7 @@ void display_init()
     };
     ESP_ERROR_CHECK(gpio_config(&bk_gpio_config));
     gpio_set_level(BOARD_TFT_BL, 1);
+    display_pm_attach_panel(panel_handle, io_handle);
 }
 #endif
 
@@ -0,0 +1,233 @@
+/**
+ * @file      font_pack.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <sdkconfig.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "font_pack.h"
+#include "font_rle.h"
+
+#if CONFIG_LILYGO_FONT_PACK
+
+#define FONT_PACK_MAGIC         "LFPK"
+#define FONT_PACK_VERSION       1
+#define FONT_PACK_NAME_LEN      20
+
+enum {
+    FONT_PACK_UNLOADED = 0,
+    FONT_PACK_LOADED,
+    FONT_PACK_MISSING,
+};
+
+enum {
+    FONT_PACK_KERN_NONE = 0,
+    FONT_PACK_KERN_CLASSES,
+    FONT_PACK_KERN_PAIRS_8,
+    FONT_PACK_KERN_PAIRS_16,
+};
+
+// On-flash layout, see tools/font_pack.py
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint16_t font_count;
+    uint8_t reserved[8];
+} font_pack_header_t;
+
+typedef struct {
+    char name[FONT_PACK_NAME_LEN];
+    uint32_t offset;
+    uint32_t size;
+    uint32_t reserved;
+} font_pack_entry_t;
+
+typedef struct {
+    uint16_t glyph_count;
+    uint16_t cmap_count;
+    uint8_t bpp;
+    uint8_t bitmap_format;
+    uint8_t kern_left_cnt;
+    uint8_t kern_right_cnt;
+    uint16_t kern_scale;
+    uint16_t kern_type;
+    uint32_t glyph_dsc_ofs;
+    uint32_t cmap_ofs;
+    uint32_t kern_ofs;
+    uint32_t bitmap_ofs;
+    uint32_t kern_pair_cnt;
+} font_pack_font_header_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t list_length;
+    uint8_t type;
+    uint8_t reserved;
+    uint32_t unicode_list_ofs;
+    uint32_t glyph_id_ofs_list_ofs;
+} font_pack_cmap_t;
+
+_Static_assert(sizeof(lv_font_fmt_txt_glyph_dsc_t) == 8, "font pack needs LV_FONT_FMT_TXT_LARGE 0");
+
+static const char *TAG = "FONT_PACK";
+static const uint8_t *pack_base = NULL;
+static size_t pack_size = 0;
+static esp_partition_mmap_handle_t pack_handle;
+
+bool font_pack_mount()
+{
+    if (pack_base) {
+        return true;
+    }
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "fonts");
+    if (!part) {
+        ESP_LOGE(TAG, "No fonts partition");
+        return false;
+    }
+
+    const void *ptr = NULL;
+    esp_err_t ret = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &ptr, &pack_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "mmap failed: %s", esp_err_to_name(ret));
+        return false;
+    }
+
+    const font_pack_header_t *hdr = (const font_pack_header_t *)ptr;
+    if (memcmp(hdr->magic, FONT_PACK_MAGIC, 4) != 0 || hdr->version != FONT_PACK_VERSION) {
+        ESP_LOGE(TAG, "Font pack missing or wrong version, flash it with 'idf.py flash'");
+        esp_partition_munmap(pack_handle);
+        return false;
+    }
+
+    pack_base = (const uint8_t *)ptr;
+    pack_size = part->size;
+    ESP_LOGI(TAG, "Mapped %u fonts at 0x%lx", hdr->font_count, (unsigned long)part->address);
+    return true;
+}
+
+static const font_pack_entry_t *font_pack_find(const char *name)
+{
+    const font_pack_header_t *hdr = (const font_pack_header_t *)pack_base;
+    const font_pack_entry_t *table = (const font_pack_entry_t *)(pack_base + sizeof(font_pack_header_t));
+    for (uint16_t i = 0; i < hdr->font_count; i++) {
+        if (strncmp(table[i].name, name, FONT_PACK_NAME_LEN) == 0) {
+            if (table[i].offset + table[i].size > pack_size) {
+                return NULL;
+            }
+            return &table[i];
+        }
+    }
+    return NULL;
+}
+
+static bool font_pack_load(const lv_font_t *font)
+{
+    font_pack_font_t *pf = (font_pack_font_t *)font->dsc;
+    if (pf->state == FONT_PACK_LOADED) {
+        return true;
+    }
+    if (pf->state == FONT_PACK_MISSING) {
+        return false;
+    }
+    // Only try once, a missing font then simply draws nothing
+    pf->state = FONT_PACK_MISSING;
+
+    if (!font_pack_mount()) {
+        return false;
+    }
+    const font_pack_entry_t *entry = font_pack_find(pf->name);
+    if (!entry) {
+        ESP_LOGE(TAG, "Font %s not in pack", pf->name);
+        return false;
+    }
+
+    const uint8_t *base = pack_base + entry->offset;
+    const font_pack_font_header_t *fh = (const font_pack_font_header_t *)base;
+    if (fh->bitmap_format != 2 || fh->bpp != 1) {
+        ESP_LOGE(TAG, "Font %s has an unsupported bitmap format", pf->name);
+        return false;
+    }
+
+    pf->cmaps = (lv_font_fmt_txt_cmap_t *)calloc(fh->cmap_count, sizeof(lv_font_fmt_txt_cmap_t));
+    if (!pf->cmaps) {
+        return false;
+    }
+    const font_pack_cmap_t *cmaps = (const font_pack_cmap_t *)(base + fh->cmap_ofs);
+    for (uint16_t i = 0; i < fh->cmap_count; i++) {
+        lv_font_fmt_txt_cmap_t *c = &pf->cmaps[i];
+        c->range_start = cmaps[i].range_start;
+        c->range_length = cmaps[i].range_length;
+        c->glyph_id_start = cmaps[i].glyph_id_start;
+        c->list_length = cmaps[i].list_length;
+        c->type = (lv_font_fmt_txt_cmap_type_t)cmaps[i].type;
+        c->unicode_list = cmaps[i].unicode_list_ofs ? (const uint16_t *)(base + cmaps[i].unicode_list_ofs) : NULL;
+        c->glyph_id_ofs_list = cmaps[i].glyph_id_ofs_list_ofs ? base + cmaps[i].glyph_id_ofs_list_ofs : NULL;
+    }
+
+    const uint8_t *kern = base + fh->kern_ofs;
+    pf->fmt.kern_dsc = NULL;
+    pf->fmt.kern_classes = 0;
+    switch (fh->kern_type) {
+    case FONT_PACK_KERN_CLASSES:
+        pf->kern.classes.left_class_mapping = kern;
+        pf->kern.classes.right_class_mapping = kern + fh->glyph_count;
+        pf->kern.classes.class_pair_values = (const int8_t *)(kern + 2 * fh->glyph_count);
+        pf->kern.classes.left_class_cnt = fh->kern_left_cnt;
+        pf->kern.classes.right_class_cnt = fh->kern_right_cnt;
+        pf->fmt.kern_dsc = &pf->kern.classes;
+        pf->fmt.kern_classes = 1;
+        break;
+    case FONT_PACK_KERN_PAIRS_8:
+    case FONT_PACK_KERN_PAIRS_16: {
+        uint8_t id_size = fh->kern_type == FONT_PACK_KERN_PAIRS_16 ? 2 : 1;
+        pf->kern.pairs.glyph_ids = kern;
+        pf->kern.pairs.values = (const int8_t *)(kern + 2 * id_size * fh->kern_pair_cnt);
+        pf->kern.pairs.pair_cnt = fh->kern_pair_cnt;
+        pf->kern.pairs.glyph_ids_size = id_size - 1;
+        pf->fmt.kern_dsc = &pf->kern.pairs;
+        break;
+    }
+    default:
+        break;
+    }
+
+    pf->fmt.glyph_bitmap = base + fh->bitmap_ofs;
+    pf->fmt.glyph_dsc = (const lv_font_fmt_txt_glyph_dsc_t *)(base + fh->glyph_dsc_ofs);
+    pf->fmt.cmaps = pf->cmaps;
+    pf->fmt.cmap_num = fh->cmap_count;
+    pf->fmt.bpp = fh->bpp;
+    pf->fmt.kern_scale = fh->kern_scale;
+    pf->fmt.bitmap_format = LV_FONT_FMT_TXT_PLAIN;
+    pf->fmt.cache = &pf->cache;
+    pf->state = FONT_PACK_LOADED;
+    ESP_LOGI(TAG, "Loaded %s, %u glyphs", pf->name, fh->glyph_count);
+    return true;
+}
+
+bool font_pack_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter, uint32_t letter_next)
+{
+    if (!font_pack_load(font)) {
+        return false;
+    }
+    return lv_font_get_glyph_dsc_fmt_txt(font, dsc_out, letter, letter_next);
+}
+
+const uint8_t *font_pack_get_glyph_bitmap(const lv_font_t *font, uint32_t letter)
+{
+    if (!font_pack_load(font)) {
+        return NULL;
+    }
+    // Pack bitmaps keep the run-length format of tools/font_rle.py
+    return font_rle_get_glyph_bitmap(font, letter);
+}
+
+#endif
@@ -0,0 +1,48 @@
+/**
+ * @file      font_pack.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Fonts stored in the "fonts" flash partition.
+ * tools/font_pack.py packs the font sources into the partition image and
+ * generates the lv_font_t objects. The partition is memory mapped on first
+ * use and each font is resolved the first time one of its glyphs is needed,
+ * so fonts that are never shown cost neither RAM nor boot time.
+ */
+typedef struct {
+    lv_font_fmt_txt_dsc_t fmt;          // Must be first, LVGL casts font->dsc to it
+    union {
+        lv_font_fmt_txt_kern_classes_t classes;
+        lv_font_fmt_txt_kern_pair_t pairs;
+    } kern;
+    lv_font_fmt_txt_glyph_cache_t cache;
+    lv_font_fmt_txt_cmap_t *cmaps;
+    const char *name;
+    uint8_t state;
+} font_pack_font_t;
+
+#define FONT_PACK_FONT_INIT(font_name)  { .name = (font_name) }
+
+bool font_pack_mount();
+
+bool font_pack_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter, uint32_t letter_next);
+
+const uint8_t *font_pack_get_glyph_bitmap(const lv_font_t *font, uint32_t letter);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,193 @@
+/**
+ * @file      font_rle.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "font_rle.h"
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#ifndef CONFIG_LILYGO_FONT_RLE_CACHE_SIZE_KB
+#define CONFIG_LILYGO_FONT_RLE_CACHE_SIZE_KB    16
+#endif
+
+#define FONT_RLE_MAX_ENTRIES    48
+
+typedef struct {
+    const uint8_t *src;
+    uint32_t pixels;
+} font_rle_job_t;
+
+static cache_store_t rle_store;
+static bool rle_ready = false;
+static uint8_t *rle_scratch = NULL;
+static size_t rle_scratch_size = 0;
+
+static void font_rle_set_bits(uint8_t *out, uint32_t pos, uint32_t len)
+{
+    // Partial first byte, whole bytes, partial last byte
+    while (len && (pos & 7)) {
+        out[pos >> 3] |= 0x80 >> (pos & 7);
+        pos++;
+        len--;
+    }
+    if (len >= 8) {
+        memset(&out[pos >> 3], 0xFF, len >> 3);
+        pos += len & ~7u;
+        len &= 7;
+    }
+    while (len) {
+        out[pos >> 3] |= 0x80 >> (pos & 7);
+        pos++;
+        len--;
+    }
+}
+
+void font_rle_decode(const uint8_t *in, uint8_t *out, uint32_t pixels)
+{
+    memset(out, 0, (pixels + 7) / 8);
+    uint32_t pos = 0;
+    uint8_t fg = 0;
+    while (pos < pixels) {
+        uint32_t run = 0;
+        uint8_t b;
+        do {
+            b = *in++;
+            run += b;
+        } while (b == 255);
+        if (run > pixels - pos) {
+            run = pixels - pos;
+        }
+        if (fg) {
+            font_rle_set_bits(out, pos, run);
+        }
+        pos += run;
+        fg ^= 1;
+    }
+}
+
+static int font_rle_cmp_u16(const void *a, const void *b)
+{
+    return (int)(*(const uint16_t *)a) - (int)(*(const uint16_t *)b);
+}
+
+static uint32_t font_rle_glyph_id(const lv_font_fmt_txt_dsc_t *fdsc, uint32_t letter)
+{
+    // LVGL resolves the same letter in get_glyph_dsc() right before asking for the bitmap
+    if (fdsc->cache && fdsc->cache->last_letter == letter && fdsc->cache->last_glyph_id) {
+        return fdsc->cache->last_glyph_id;
+    }
+
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if (rcp >= cmap->range_length) {
+            continue;
+        }
+        uint32_t gid = 0;
+        switch (cmap->type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            gid = cmap->glyph_id_start + rcp;
+            break;
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+            gid = cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[rcp];
+            break;
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: {
+            uint16_t key = (uint16_t)rcp;
+            const uint16_t *p = (const uint16_t *)bsearch(&key, cmap->unicode_list, cmap->list_length,
+                                sizeof(uint16_t), font_rle_cmp_u16);
+            if (p) {
+                uint32_t ofs = p - cmap->unicode_list;
+                gid = cmap->glyph_id_start;
+                gid += cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY ? ofs :
+                       ((const uint16_t *)cmap->glyph_id_ofs_list)[ofs];
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        if (gid) {
+            return gid;
+        }
+    }
+    return 0;
+}
+
+static bool font_rle_fill(void *buf, size_t size, void *user_data)
+{
+    font_rle_job_t *job = (font_rle_job_t *)user_data;
+    font_rle_decode(job->src, (uint8_t *)buf, job->pixels);
+    return true;
+}
+
+const uint8_t *font_rle_get_glyph_bitmap(const lv_font_t *font, uint32_t letter)
+{
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = font_rle_glyph_id(fdsc, letter);
+    if (!gid) {
+        return NULL;
+    }
+    const lv_font_fmt_txt_glyph_dsc_t *gdsc = &fdsc->glyph_dsc[gid];
+    font_rle_job_t job = {
+        &fdsc->glyph_bitmap[gdsc->bitmap_index],
+        (uint32_t)gdsc->box_w * gdsc->box_h
+    };
+    size_t size = (job.pixels + 7) / 8;
+    if (size == 0) {
+        return NULL;
+    }
+
+    if (!rle_ready && CONFIG_LILYGO_FONT_RLE_CACHE_SIZE_KB > 0) {
+        rle_ready = cache_store_init(&rle_store, "font", CONFIG_LILYGO_FONT_RLE_CACHE_SIZE_KB * 1024,
+                                     FONT_RLE_MAX_ENTRIES, CACHE_STORE_CAPS_INTERNAL);
+    }
+    if (rle_ready) {
+        cache_key_t key;
+        memset(&key, 0, sizeof(key));
+        uint64_t p = (uintptr_t)font;
+        key.w[0] = (uint32_t)p;
+        key.w[1] = (uint32_t)(p >> 32);
+        key.w[2] = gid;
+        const uint8_t *data = (const uint8_t *)cache_store_get(&rle_store, &key, size, font_rle_fill, &job);
+        if (data) {
+            return data;
+        }
+    }
+
+    // Not cacheable, decode into a scratch buffer like LVGL does for compressed fonts
+    if (rle_scratch_size < size) {
+        uint8_t *tmp = (uint8_t *)lv_mem_realloc(rle_scratch, size);
+        if (!tmp) {
+            return NULL;
+        }
+        rle_scratch = tmp;
+        rle_scratch_size = size;
+    }
+    font_rle_decode(job.src, rle_scratch, job.pixels);
+    return rle_scratch;
+}
+
+void font_rle_get_stats(cache_stats_t *stats)
+{
+    if (rle_ready) {
+        cache_store_get_stats(&rle_store, stats);
+    } else {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+void font_rle_dump()
+{
+    if (rle_ready) {
+        cache_store_dump(&rle_store);
+    }
+}
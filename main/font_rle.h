@@ -0,0 +1,37 @@
+/**
+ * @file      font_rle.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "lvgl.h"
+#include "cache_store.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Run-length encoded glyph bitmaps for 1 bpp fmt_txt fonts.
+ * Fonts converted with tools/font_rle.py use font_rle_get_glyph_bitmap() as
+ * their get_glyph_bitmap callback. Decoded glyphs are kept in a small cache
+ * in internal SRAM, so a glyph is only decoded again after it was evicted.
+ */
+const uint8_t *font_rle_get_glyph_bitmap(const lv_font_t *font, uint32_t letter);
+
+// Decode `pixels` 1 bpp pixels into `out`, which must hold (pixels + 7) / 8 bytes
+void font_rle_decode(const uint8_t *in, uint8_t *out, uint32_t pixels);
+
+void font_rle_get_stats(cache_stats_t *stats);
+
+void font_rle_dump();
+
+#ifdef __cplusplus
+}
+#endif
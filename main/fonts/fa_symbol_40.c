@@ -2,9 +2,11 @@
  * Size: 40 px
  * Bpp: 1
  * Opts: --bpp 1 --size 40 --no-compress --font FontAwesome5-Solid+Brands+Regular.woff --range 61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,61478,61479,61480,61502,61512,61515,61516,61517,61521,61522,61523,61524,61543,61544,61550,61552,61553,61556,61559,61560,61561,61563,61587,61589,61636,61637,61639,61671,61674,61683,61724,61732,61787,61931,62016,62017,62018,62019,62020,62087,62099,62212,62189,62810,63426,63650 --format lvgl -o fa_symbol_40.c
+ * Post-processed with tools/font_rle.py (run-length glyph bitmaps)
  ******************************************************************************/
 
 #include "lvgl.h"
+#include "font_rle.h"
 
 #ifndef FA_SYMBOL_40
 #define FA_SYMBOL_40 1
@@ -19,1280 +21,800 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+F001 "" */
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xff, 0x9f, 0x0, 0x3f, 0xff, 0xf8,
-    0x1f, 0x0, 0x3f, 0xff, 0xc0, 0x1f, 0x0, 0x3f,
-    0xfe, 0x0, 0x1f, 0x0, 0x3f, 0xe0, 0x0, 0x1f,
-    0x0, 0x3f, 0x0, 0x0, 0x1f, 0x0, 0x3e, 0x0,
-    0x0, 0x1f, 0x0, 0x3e, 0x0, 0x0, 0x1f, 0x0,
-    0x3e, 0x0, 0x0, 0x1f, 0x0, 0x3e, 0x0, 0x0,
-    0x1f, 0x0, 0x3e, 0x0, 0x0, 0x1f, 0x0, 0x3e,
-    0x0, 0x0, 0x1f, 0x0, 0x3e, 0x0, 0x0, 0x1f,
-    0x0, 0x3e, 0x0, 0x0, 0x1f, 0x0, 0x3e, 0x0,
-    0x7, 0xff, 0x0, 0x3e, 0x0, 0x1f, 0xff, 0x0,
-    0x3e, 0x0, 0x3f, 0xff, 0x0, 0x3e, 0x0, 0x7f,
-    0xff, 0x0, 0x3e, 0x0, 0x7f, 0xff, 0xf, 0xfe,
-    0x0, 0x7f, 0xff, 0x3f, 0xfe, 0x0, 0x7f, 0xff,
-    0x7f, 0xfe, 0x0, 0x3f, 0xfe, 0xff, 0xfe, 0x0,
-    0x1f, 0xfc, 0xff, 0xfe, 0x0, 0x7, 0xf0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0,
+    0x24, 0x3, 0x21, 0x8, 0x1d, 0xb, 0x19, 0xf,
+    0x16, 0x12, 0x13, 0x15, 0xf, 0x19, 0xc, 0x1c,
+    0xa, 0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa, 0x17,
+    0x2, 0x5, 0xa, 0x13, 0x6, 0x5, 0xa, 0x10,
+    0x9, 0x5, 0xa, 0xd, 0xc, 0x5, 0xa, 0x9,
+    0x10, 0x5, 0xa, 0x6, 0x13, 0x5, 0xa, 0x5,
+    0x14, 0x5, 0xa, 0x5, 0x14, 0x5, 0xa, 0x5,
+    0x14, 0x5, 0xa, 0x5, 0x14, 0x5, 0xa, 0x5,
+    0x14, 0x5, 0xa, 0x5, 0x14, 0x5, 0xa, 0x5,
+    0x14, 0x5, 0xa, 0x5, 0x14, 0x5, 0xa, 0x5,
+    0xe, 0xb, 0xa, 0x5, 0xc, 0xd, 0xa, 0x5,
+    0xb, 0xe, 0xa, 0x5, 0xa, 0xf, 0xa, 0x5,
+    0xa, 0xf, 0x4, 0xb, 0xa, 0xf, 0x2, 0xd,
+    0xa, 0xf, 0x1, 0xe, 0xb, 0xd, 0x1, 0xf,
+    0xc, 0xb, 0x2, 0xf, 0xe, 0x7, 0x4, 0xf,
+    0x19, 0xf, 0x1a, 0xd, 0x1c, 0xb, 0x1f, 0x7,
+    0x1d,
 
     /* U+F008 "" */
-    0x60, 0xff, 0xff, 0xff, 0x86, 0xe0, 0xff, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7,
-    0xff, 0xe0, 0xf0, 0x0, 0x7, 0x87, 0xe0, 0xf0,
-    0x0, 0x7, 0x87, 0xe0, 0xf0, 0x0, 0x7, 0x87,
-    0xe0, 0xf0, 0x0, 0x7, 0x87, 0xe0, 0xf0, 0x0,
-    0x7, 0x87, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x7,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0x87, 0xe0, 0xff,
-    0xff, 0xff, 0x87, 0xe0, 0xff, 0xff, 0xff, 0x87,
-    0xe0, 0xff, 0xff, 0xff, 0x87, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x7, 0xff, 0xe0, 0xf0, 0x0, 0x7,
-    0x87, 0xe0, 0xf0, 0x0, 0x7, 0x87, 0xe0, 0xf0,
-    0x0, 0x7, 0x87, 0xe0, 0xf0, 0x0, 0x7, 0x87,
-    0xe0, 0xf0, 0x0, 0x7, 0x87, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
-    0x87, 0x60, 0xff, 0xff, 0xff, 0x86,
+    0x1, 0x2, 0x5, 0x19, 0x4, 0x2, 0x1, 0x3,
+    0x5, 0x19, 0x4, 0x5f, 0x11, 0xe, 0x5, 0x4,
+    0x11, 0x4, 0x4, 0x6, 0x5, 0x4, 0x11, 0x4,
+    0x4, 0x6, 0x5, 0x4, 0x11, 0x4, 0x4, 0x6,
+    0x5, 0x4, 0x11, 0x4, 0x4, 0x6, 0x5, 0x4,
+    0x11, 0x4, 0x4, 0xf, 0x11, 0x17, 0x11, 0x17,
+    0x11, 0xe, 0x5, 0x19, 0x4, 0x6, 0x5, 0x19,
+    0x4, 0x6, 0x5, 0x19, 0x4, 0x6, 0x5, 0x19,
+    0x4, 0xf, 0x11, 0x17, 0x11, 0x17, 0x11, 0xe,
+    0x5, 0x4, 0x11, 0x4, 0x4, 0x6, 0x5, 0x4,
+    0x11, 0x4, 0x4, 0x6, 0x5, 0x4, 0x11, 0x4,
+    0x4, 0x6, 0x5, 0x4, 0x11, 0x4, 0x4, 0x6,
+    0x5, 0x4, 0x11, 0x4, 0x4, 0xf, 0x11, 0x5e,
+    0x5, 0x19, 0x4, 0x3, 0x1, 0x2, 0x5, 0x19,
+    0x4, 0x2, 0x1,
 
     /* U+F00B "" */
-    0x7f, 0xe1, 0xff, 0xff, 0xfe, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0x7f, 0xe1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0xff, 0xff,
-    0xfe, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0x7f, 0xe1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0xff,
-    0xff, 0xfe, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0x7f, 0xe1, 0xff, 0xff, 0xfe,
+    0x1, 0xa, 0x4, 0x18, 0x1, 0xc, 0x2, 0x26,
+    0x2, 0x26, 0x2, 0x26, 0x2, 0x26, 0x2, 0x26,
+    0x2, 0x26, 0x2, 0x26, 0x2, 0x1a, 0x1, 0xa,
+    0x4, 0x18, 0x52, 0xa, 0x4, 0x18, 0x1, 0xc,
+    0x2, 0x26, 0x2, 0x26, 0x2, 0x26, 0x2, 0x26,
+    0x2, 0x26, 0x2, 0x26, 0x2, 0x26, 0x2, 0x1a,
+    0x1, 0xa, 0x4, 0x18, 0x7a, 0xa, 0x4, 0x18,
+    0x1, 0xc, 0x2, 0x26, 0x2, 0x26, 0x2, 0x26,
+    0x2, 0x26, 0x2, 0x26, 0x2, 0x26, 0x2, 0x26,
+    0x2, 0x1a, 0x1, 0xa, 0x4, 0x18, 0x1,
 
     /* U+F00C "" */
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0xc, 0x0, 0x0, 0xff, 0xe0, 0x1e,
-    0x0, 0x1, 0xff, 0xc0, 0x3f, 0x0, 0x3, 0xff,
-    0x80, 0x7f, 0x80, 0x7, 0xff, 0x0, 0xff, 0xc0,
-    0xf, 0xfe, 0x0, 0xff, 0xe0, 0x1f, 0xfc, 0x0,
-    0x7f, 0xf0, 0x3f, 0xf8, 0x0, 0x3f, 0xf8, 0x7f,
-    0xf0, 0x0, 0x1f, 0xfc, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0x3, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x22, 0x2, 0x25, 0x4, 0x23, 0x6, 0x21, 0x8,
+    0x1f, 0xa, 0x1d, 0xb, 0x1c, 0xb, 0x1c, 0xb,
+    0x1c, 0xb, 0x1c, 0xb, 0x8, 0x2, 0x12, 0xb,
+    0x8, 0x4, 0x10, 0xb, 0x8, 0x6, 0xe, 0xb,
+    0x8, 0x8, 0xc, 0xb, 0x8, 0xa, 0xa, 0xb,
+    0x9, 0xb, 0x8, 0xb, 0xb, 0xb, 0x6, 0xb,
+    0xd, 0xb, 0x4, 0xb, 0xf, 0xb, 0x2, 0xb,
+    0x11, 0x16, 0x13, 0x14, 0x15, 0x12, 0x17, 0x10,
+    0x19, 0xe, 0x1b, 0xc, 0x1d, 0xa, 0x1f, 0x8,
+    0x21, 0x6, 0x23, 0x4, 0x25, 0x2, 0x18,
 
     /* U+F00D "" */
-    0x1c, 0x0, 0x3, 0x83, 0xe0, 0x0, 0x7c, 0x7f,
-    0x0, 0xf, 0xef, 0xf8, 0x1, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xfe, 0x7, 0xff, 0x7f, 0xf0, 0xff,
-    0xe3, 0xff, 0x9f, 0xfc, 0x1f, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xf0, 0x3, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0xff, 0xf8, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xc0,
-    0x3, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xf0, 0x1f,
-    0xff, 0xff, 0x83, 0xff, 0x9f, 0xfc, 0x7f, 0xf0,
-    0xff, 0xef, 0xfe, 0x7, 0xff, 0xff, 0xc0, 0x3f,
-    0xff, 0xf8, 0x1, 0xff, 0x7f, 0x0, 0xf, 0xe3,
-    0xe0, 0x0, 0x7c, 0x1c, 0x0, 0x3, 0x80,
+    0x3, 0x3, 0x10, 0x3, 0x5, 0x5, 0xe, 0x5,
+    0x3, 0x7, 0xc, 0x7, 0x1, 0x9, 0xa, 0x13,
+    0x8, 0x15, 0x6, 0xb, 0x1, 0xb, 0x4, 0xb,
+    0x3, 0xb, 0x2, 0xb, 0x5, 0x16, 0x8, 0x13,
+    0xa, 0x11, 0xc, 0xf, 0xe, 0xd, 0x10, 0xa,
+    0x11, 0xd, 0xe, 0xf, 0xc, 0x11, 0xa, 0x13,
+    0x7, 0x16, 0x5, 0xb, 0x2, 0xb, 0x3, 0xb,
+    0x4, 0xb, 0x1, 0xb, 0x6, 0x15, 0x8, 0x13,
+    0xa, 0x9, 0x1, 0x7, 0xc, 0x7, 0x3, 0x5,
+    0xe, 0x5, 0x5, 0x3, 0x10, 0x3, 0x3,
 
     /* U+F011 "" */
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0x0, 0x0, 0x1, 0xc0, 0xfc, 0xe, 0x0,
-    0xf, 0x83, 0xf0, 0x7c, 0x0, 0x7f, 0xf, 0xc3,
-    0xf8, 0x3, 0xfc, 0x3f, 0xf, 0xf0, 0xf, 0xf0,
-    0xfc, 0x3f, 0xc0, 0x7f, 0x83, 0xf0, 0x7f, 0x83,
-    0xfc, 0xf, 0xc0, 0xff, 0xf, 0xe0, 0x3f, 0x1,
-    0xfc, 0x7f, 0x0, 0xfc, 0x3, 0xf9, 0xfc, 0x3,
-    0xf0, 0xf, 0xe7, 0xe0, 0xf, 0xc0, 0x1f, 0xbf,
-    0x80, 0x3f, 0x0, 0x7f, 0xfc, 0x0, 0xfc, 0x0,
-    0xff, 0xf0, 0x3, 0xf0, 0x3, 0xff, 0xc0, 0xf,
-    0xc0, 0xf, 0xff, 0x0, 0x3f, 0x0, 0x3f, 0xfc,
-    0x0, 0xfc, 0x0, 0xff, 0xf0, 0x1, 0xe0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x7f, 0x7e, 0x0, 0x0, 0x1, 0xf9, 0xf8,
-    0x0, 0x0, 0x7, 0xe7, 0xf0, 0x0, 0x0, 0x3f,
-    0x9f, 0xc0, 0x0, 0x0, 0xfe, 0x3f, 0x80, 0x0,
-    0x7, 0xf0, 0xff, 0x0, 0x0, 0x3f, 0x81, 0xfe,
-    0x0, 0x1, 0xfe, 0x3, 0xfe, 0x0, 0x1f, 0xf0,
-    0x7, 0xfe, 0x1, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xfc, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0,
+    0x11, 0x4, 0x21, 0x6, 0x20, 0x6, 0x20, 0x6,
+    0x17, 0x3, 0x6, 0x6, 0x6, 0x3, 0xd, 0x5,
+    0x5, 0x6, 0x5, 0x5, 0xb, 0x7, 0x4, 0x6,
+    0x4, 0x7, 0x9, 0x8, 0x4, 0x6, 0x4, 0x8,
+    0x8, 0x8, 0x4, 0x6, 0x4, 0x8, 0x7, 0x8,
+    0x5, 0x6, 0x5, 0x8, 0x5, 0x8, 0x6, 0x6,
+    0x6, 0x8, 0x4, 0x7, 0x7, 0x6, 0x7, 0x7,
+    0x3, 0x7, 0x8, 0x6, 0x8, 0x7, 0x2, 0x7,
+    0x8, 0x6, 0x8, 0x7, 0x2, 0x6, 0x9, 0x6,
+    0x9, 0x6, 0x1, 0x7, 0x9, 0x6, 0x9, 0xd,
+    0xa, 0x6, 0xa, 0xc, 0xa, 0x6, 0xa, 0xc,
+    0xa, 0x6, 0xa, 0xc, 0xa, 0x6, 0xa, 0xc,
+    0xa, 0x6, 0xa, 0xc, 0xb, 0x4, 0xb, 0xc,
+    0x1a, 0xc, 0x19, 0x7, 0x1, 0x6, 0x18, 0x6,
+    0x2, 0x6, 0x18, 0x6, 0x2, 0x7, 0x16, 0x7,
+    0x2, 0x7, 0x16, 0x7, 0x3, 0x7, 0x14, 0x7,
+    0x4, 0x8, 0x12, 0x7, 0x6, 0x8, 0x10, 0x8,
+    0x7, 0x9, 0xc, 0x9, 0x9, 0xa, 0x8, 0xa,
+    0xb, 0x1a, 0xd, 0x18, 0xf, 0x16, 0x11, 0x13,
+    0x15, 0x10, 0x1a, 0x8, 0xf,
 
     /* U+F013 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0x0, 0x3, 0x87, 0xff, 0xf8, 0x70, 0x1f, 0xff,
-    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xf0, 0x3f, 0xff, 0xdf,
-    0xff, 0x80, 0x7f, 0xfe, 0x1f, 0xfc, 0x0, 0xff,
-    0xe0, 0x3f, 0xe0, 0x1, 0xff, 0x0, 0xff, 0x80,
-    0x7, 0xfc, 0x3, 0xfe, 0x0, 0x1f, 0xf0, 0xf,
-    0xf8, 0x0, 0x7f, 0xc0, 0x3f, 0xe0, 0x1, 0xff,
-    0x0, 0xff, 0x80, 0x7, 0xfc, 0x7, 0xff, 0x0,
-    0x3f, 0xf8, 0x7f, 0xfe, 0x1, 0xff, 0xfb, 0xff,
-    0xfc, 0xf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0x1f, 0xff, 0xe1, 0xc0, 0x0, 0x3f, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x34, 0xa, 0x1c, 0xa, 0x1c, 0xa, 0x1c, 0xa,
+    0x1c, 0xa, 0x1b, 0xd, 0x10, 0x3, 0x4, 0x10,
+    0x4, 0x3, 0x7, 0x20, 0x6, 0x20, 0x5, 0x22,
+    0x4, 0x22, 0x3, 0x24, 0x2, 0x24, 0x1, 0x10,
+    0x6, 0x10, 0x1, 0xe, 0x8, 0xe, 0x4, 0xb,
+    0xa, 0xb, 0x7, 0x9, 0xc, 0x9, 0x8, 0x9,
+    0xc, 0x9, 0x8, 0x9, 0xc, 0x9, 0x8, 0x9,
+    0xc, 0x9, 0x8, 0x9, 0xc, 0x9, 0x8, 0x9,
+    0xc, 0x9, 0x7, 0xb, 0xa, 0xb, 0x4, 0xe,
+    0x8, 0xe, 0x1, 0x10, 0x6, 0x10, 0x1, 0x24,
+    0x2, 0x24, 0x3, 0x22, 0x4, 0x22, 0x5, 0x20,
+    0x6, 0x20, 0x7, 0x4, 0x3, 0x10, 0x4, 0x3,
+    0x10, 0xe, 0x1a, 0xa, 0x1c, 0xa, 0x1c, 0xa,
+    0x1c, 0xa, 0x1c, 0xa, 0x34,
 
     /* U+F015 "" */
-    0x0, 0x0, 0x7, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0xfe, 0x7, 0xe0, 0x0, 0x0, 0xf, 0xf8, 0x3f,
-    0x0, 0x0, 0x0, 0xff, 0xe1, 0xf8, 0x0, 0x0,
-    0xf, 0xff, 0x8f, 0xc0, 0x0, 0x1, 0xff, 0xfe,
-    0x7e, 0x0, 0x0, 0x1f, 0xe3, 0xff, 0xf0, 0x0,
-    0x1, 0xfe, 0xf, 0xff, 0x80, 0x0, 0x1f, 0xe0,
-    0x3f, 0xfc, 0x0, 0x1, 0xfc, 0x38, 0x7f, 0xe0,
-    0x0, 0x3f, 0xc3, 0xe1, 0xff, 0x0, 0x3, 0xfc,
-    0x3f, 0x87, 0xf8, 0x0, 0x3f, 0xc3, 0xfe, 0x1f,
-    0xe0, 0x3, 0xfc, 0x7f, 0xfc, 0x7f, 0x80, 0x7f,
-    0x87, 0xff, 0xf0, 0xfe, 0x7, 0xf8, 0x7f, 0xff,
-    0xc3, 0xfc, 0x7f, 0x87, 0xff, 0xff, 0xf, 0xf7,
-    0xf8, 0x7f, 0xff, 0xfc, 0x3f, 0xff, 0x8f, 0xff,
-    0xff, 0xf8, 0xfe, 0xf0, 0xff, 0xff, 0xff, 0xe1,
-    0xe3, 0xf, 0xff, 0xff, 0xff, 0x86, 0x0, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x1,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0x1,
-    0xff, 0xe0, 0x0, 0x7f, 0xf8, 0xf, 0xff, 0x0,
-    0x3, 0xff, 0xc0, 0x7f, 0xf8, 0x0, 0x1f, 0xfe,
-    0x3, 0xff, 0xc0, 0x0, 0xff, 0xf0, 0x1f, 0xfe,
-    0x0, 0x7, 0xff, 0x80, 0xff, 0xf0, 0x0, 0x3f,
-    0xfc, 0x7, 0xff, 0x80, 0x1, 0xff, 0xe0, 0x3f,
-    0xfc, 0x0, 0xf, 0xff, 0x1, 0xff, 0xe0, 0x0,
-    0x3f, 0xf0, 0x7, 0xfe, 0x0,
+    0x15, 0x3, 0x8, 0x6, 0x1a, 0x7, 0x6, 0x6,
+    0x19, 0x9, 0x5, 0x6, 0x18, 0xb, 0x4, 0x6,
+    0x17, 0xd, 0x3, 0x6, 0x15, 0x10, 0x2, 0x6,
+    0x14, 0x8, 0x3, 0xe, 0x13, 0x8, 0x5, 0xd,
+    0x12, 0x8, 0x7, 0xc, 0x11, 0x7, 0x4, 0x3,
+    0x4, 0xa, 0xf, 0x8, 0x4, 0x5, 0x4, 0x9,
+    0xe, 0x8, 0x4, 0x7, 0x4, 0x8, 0xd, 0x8,
+    0x4, 0x9, 0x4, 0x8, 0xb, 0x8, 0x3, 0xd,
+    0x3, 0x8, 0x8, 0x8, 0x4, 0xf, 0x4, 0x7,
+    0x6, 0x8, 0x4, 0x11, 0x4, 0x8, 0x3, 0x8,
+    0x4, 0x13, 0x4, 0x8, 0x1, 0x8, 0x4, 0x15,
+    0x4, 0xf, 0x3, 0x19, 0x3, 0x7, 0x1, 0x4,
+    0x4, 0x1b, 0x4, 0x4, 0x3, 0x2, 0x4, 0x1d,
+    0x4, 0x2, 0x9, 0x1f, 0xe, 0x1f, 0xe, 0x1f,
+    0xe, 0x1f, 0xe, 0xc, 0x7, 0xc, 0xe, 0xc,
+    0x7, 0xc, 0xe, 0xc, 0x7, 0xc, 0xe, 0xc,
+    0x7, 0xc, 0xe, 0xc, 0x7, 0xc, 0xe, 0xc,
+    0x7, 0xc, 0xe, 0xc, 0x7, 0xc, 0xe, 0xc,
+    0x7, 0xc, 0xe, 0xc, 0x7, 0xc, 0xf, 0xa,
+    0x9, 0xa, 0x8,
 
     /* U+F019 "" */
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0x80,
-    0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0x80,
-    0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x80, 0x1, 0xff, 0xff,
-    0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff, 0xfc,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x7f, 0xfc, 0x7c, 0x3f,
-    0xfe, 0xff, 0xfe, 0x38, 0x7f, 0xff, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0x1f, 0xff, 0xff, 0xff, 0xe3,
-    0x1f, 0xff, 0xff, 0xff, 0xe3, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe,
+    0x11, 0x6, 0x20, 0xa, 0x1e, 0xa, 0x1e, 0xa,
+    0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa,
+    0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa,
+    0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa, 0x17, 0x18,
+    0xf, 0x1a, 0xe, 0x1a, 0xe, 0x19, 0x10, 0x17,
+    0x12, 0x15, 0x14, 0x13, 0x16, 0x11, 0x18, 0xf,
+    0x1a, 0xd, 0x1c, 0xb, 0x1e, 0x9, 0x20, 0x7,
+    0x12, 0xd, 0x3, 0x5, 0x4, 0xd, 0x1, 0xf,
+    0x3, 0x3, 0x4, 0x1f, 0x8, 0x21, 0x6, 0x24,
+    0x2, 0x7e, 0x3, 0x2, 0x3, 0x20, 0x3, 0x2,
+    0x3, 0x20, 0x3, 0x2, 0x3, 0x2d, 0x1, 0x26,
+    0x1,
 
     /* U+F01C "" */
-    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xc0, 0x1, 0xf8, 0x0, 0x0,
-    0x3f, 0x0, 0xf, 0xc0, 0x0, 0x1, 0xf8, 0x0,
-    0xfc, 0x0, 0x0, 0x7, 0xe0, 0xf, 0xc0, 0x0,
-    0x0, 0x1f, 0x80, 0x7e, 0x0, 0x0, 0x0, 0xfc,
-    0x7, 0xe0, 0x0, 0x0, 0x3, 0xf0, 0x7e, 0x0,
-    0x0, 0x0, 0xf, 0xc3, 0xf0, 0x0, 0x0, 0x0,
-    0x7e, 0x3f, 0x0, 0x0, 0x0, 0x1, 0xfb, 0xf0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xf0,
+    0xa, 0x19, 0x13, 0x1b, 0x11, 0x1d, 0x10, 0x1d,
+    0xf, 0x1f, 0xd, 0x6, 0x15, 0x6, 0xc, 0x6,
+    0x15, 0x6, 0xb, 0x6, 0x17, 0x6, 0x9, 0x6,
+    0x19, 0x6, 0x8, 0x6, 0x19, 0x6, 0x7, 0x6,
+    0x1b, 0x6, 0x5, 0x6, 0x1d, 0x6, 0x4, 0x6,
+    0x1d, 0x6, 0x3, 0x6, 0x1f, 0x6, 0x1, 0x6,
+    0x21, 0x16, 0xd, 0x20, 0xd, 0x21, 0xb, 0x22,
+    0xb, 0x23, 0x9, 0xff, 0x7b, 0x1, 0x2b, 0x3,
+    0x29, 0x2,
 
     /* U+F021 "" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0xff,
-    0x0, 0x1f, 0x0, 0xf, 0xff, 0xe0, 0x1f, 0x0,
-    0x3f, 0xff, 0xfc, 0x1f, 0x0, 0x7f, 0xff, 0xff,
-    0x1f, 0x1, 0xff, 0xff, 0xff, 0x9f, 0x3, 0xff,
-    0x81, 0xff, 0xdf, 0x7, 0xfc, 0x0, 0x3f, 0xff,
-    0xf, 0xf0, 0x0, 0xf, 0xff, 0xf, 0xe0, 0x0,
-    0x7, 0xff, 0x1f, 0xc0, 0x0, 0x3, 0xff, 0x3f,
-    0x80, 0x0, 0x1, 0xff, 0x3f, 0x0, 0x1, 0xff,
-    0xff, 0x3f, 0x0, 0x1, 0xff, 0xff, 0x7e, 0x0,
-    0x1, 0xff, 0xff, 0x7e, 0x0, 0x1, 0xff, 0xff,
-    0x7e, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x7e,
-    0xff, 0xff, 0x80, 0x0, 0x7e, 0xff, 0xff, 0x80,
-    0x0, 0x7e, 0xff, 0xff, 0x80, 0x0, 0xfc, 0xff,
-    0xff, 0x80, 0x0, 0xfc, 0xff, 0x80, 0x0, 0x1,
-    0xfc, 0xff, 0x80, 0x0, 0x3, 0xf8, 0xff, 0xe0,
-    0x0, 0x7, 0xf0, 0xff, 0xf0, 0x0, 0xf, 0xf0,
-    0xff, 0xfc, 0x0, 0x3f, 0xe0, 0xfb, 0xff, 0x1,
-    0xff, 0xc0, 0xf9, 0xff, 0xff, 0xff, 0x80, 0xf8,
-    0xff, 0xff, 0xfe, 0x0, 0xf8, 0x3f, 0xff, 0xfc,
-    0x0, 0xf8, 0xf, 0xff, 0xf0, 0x0, 0xf8, 0x0,
-    0xff, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x5, 0x10, 0x8, 0xb, 0x5, 0xc, 0xf,
+    0x8, 0x5, 0xa, 0x14, 0x5, 0x5, 0x9, 0x17,
+    0x3, 0x5, 0x7, 0x1a, 0x2, 0x5, 0x6, 0xb,
+    0x6, 0xb, 0x1, 0x5, 0x5, 0x9, 0xc, 0xe,
+    0x4, 0x8, 0x10, 0xc, 0x4, 0x7, 0x12, 0xb,
+    0x3, 0x7, 0x14, 0xa, 0x2, 0x7, 0x16, 0x9,
+    0x2, 0x6, 0xf, 0x11, 0x2, 0x6, 0xf, 0x11,
+    0x1, 0x6, 0x10, 0x11, 0x1, 0x6, 0x10, 0x11,
+    0x1, 0x6, 0x10, 0x11, 0xf0, 0x11, 0x10, 0x6,
+    0x1, 0x11, 0x10, 0x6, 0x1, 0x11, 0x10, 0x6,
+    0x1, 0x11, 0xf, 0x6, 0x2, 0x11, 0xf, 0x6,
+    0x2, 0x9, 0x16, 0x7, 0x2, 0x9, 0x15, 0x7,
+    0x3, 0xb, 0x12, 0x7, 0x4, 0xc, 0x10, 0x8,
+    0x4, 0xe, 0xc, 0x9, 0x5, 0x5, 0x1, 0xa,
+    0x7, 0xb, 0x6, 0x5, 0x2, 0x1a, 0x7, 0x5,
+    0x3, 0x17, 0x9, 0x5, 0x5, 0x14, 0xa, 0x5,
+    0x7, 0x10, 0xc, 0x5, 0xb, 0x8, 0x10, 0x5,
+    0x23,
 
     /* U+F026 "" */
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x1, 0xf0,
-    0x0, 0x3f, 0x0, 0x7, 0xf0, 0x0, 0xff, 0x0,
-    0x1f, 0xf0, 0x3, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
-    0xff, 0xf0, 0x3, 0xff, 0x0, 0x1f, 0xf0, 0x0,
-    0xff, 0x0, 0x7, 0xf0, 0x0, 0x3f, 0x0, 0x1,
-    0xf0, 0x0, 0xf, 0x0, 0x0, 0x0,
+    0x24, 0x4, 0xf, 0x5, 0xe, 0x6, 0xd, 0x7,
+    0xc, 0x8, 0xb, 0x9, 0xa, 0xa, 0x1, 0xff,
+    0x18, 0x1, 0x13, 0xa, 0xa, 0xb, 0x9, 0xc,
+    0x8, 0xd, 0x7, 0xe, 0x6, 0xf, 0x5, 0x10,
+    0x4, 0x14,
 
     /* U+F027 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x1f, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x7f, 0xff,
-    0xf0, 0x3, 0xff, 0xff, 0xc3, 0x8f, 0xff, 0xff,
-    0x1f, 0x3f, 0xff, 0xfc, 0x3e, 0xff, 0xff, 0xf0,
-    0x7b, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x3,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xf, 0xbf,
-    0xff, 0xfc, 0x7c, 0xff, 0xff, 0xf0, 0xe3, 0xff,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0x0, 0x0, 0xf,
-    0xfc, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0x4, 0x19, 0x5, 0x18, 0x6, 0x17, 0x7,
+    0x16, 0x8, 0x15, 0x9, 0x14, 0xa, 0xb, 0x13,
+    0xa, 0x14, 0x4, 0x3, 0x3, 0x14, 0x3, 0x5,
+    0x2, 0x14, 0x4, 0x5, 0x1, 0x14, 0x5, 0x4,
+    0x1, 0x14, 0x6, 0x18, 0x6, 0x18, 0x6, 0x18,
+    0x6, 0x18, 0x5, 0x19, 0x4, 0x5, 0x1, 0x14,
+    0x3, 0x5, 0x2, 0x14, 0x4, 0x3, 0x3, 0x14,
+    0xb, 0x13, 0x14, 0xa, 0x15, 0x9, 0x16, 0x8,
+    0x17, 0x7, 0x18, 0x6, 0x19, 0x5, 0x1a, 0x4,
+    0x28,
 
     /* U+F028 "" */
-    0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x78, 0x0,
-    0xf, 0x80, 0x0, 0x7, 0xc0, 0x0, 0x3e, 0x0,
-    0x0, 0x7e, 0x1, 0xe0, 0xf8, 0x0, 0x7, 0xf0,
-    0xf, 0x83, 0xc0, 0x0, 0x7f, 0x80, 0x3e, 0x1f,
-    0x0, 0x7, 0xfc, 0x0, 0xf8, 0x78, 0x0, 0x7f,
-    0xe0, 0x3, 0xe3, 0xe7, 0xff, 0xff, 0x0, 0xf,
-    0xf, 0x7f, 0xff, 0xf8, 0x70, 0x7c, 0x7b, 0xff,
-    0xff, 0xc7, 0xc1, 0xe3, 0xff, 0xff, 0xfe, 0x1f,
-    0xf, 0x8f, 0xff, 0xff, 0xf0, 0x78, 0x3c, 0x7f,
-    0xff, 0xff, 0x81, 0xe1, 0xe3, 0xff, 0xff, 0xfc,
-    0xf, 0xf, 0x1f, 0xff, 0xff, 0xe0, 0x78, 0x78,
-    0xff, 0xff, 0xff, 0x3, 0xc3, 0xc7, 0xff, 0xff,
-    0xf8, 0x3c, 0x1e, 0x3f, 0xff, 0xff, 0xc3, 0xe1,
-    0xf1, 0xff, 0xff, 0xfe, 0x3e, 0xf, 0x1f, 0xff,
-    0xff, 0xf0, 0xe0, 0xf8, 0xf7, 0xff, 0xff, 0x80,
-    0x7, 0x87, 0x9f, 0xff, 0xfc, 0x0, 0x7c, 0x7c,
-    0x0, 0x7f, 0xe0, 0x7, 0xc3, 0xc0, 0x1, 0xff,
-    0x0, 0x7c, 0x3e, 0x0, 0x7, 0xf8, 0x7, 0xc1,
-    0xe0, 0x0, 0x1f, 0xc0, 0x3c, 0x1f, 0x0, 0x0,
-    0x7e, 0x0, 0x1, 0xf0, 0x0, 0x1, 0xf0, 0x0,
-    0x1f, 0x0, 0x0, 0x7, 0x80, 0x1, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x21, 0x2, 0x2a, 0x4, 0x29, 0x5, 0x28, 0x6,
+    0x29, 0x5, 0x16, 0x4, 0xf, 0x5, 0x14, 0x5,
+    0x10, 0x5, 0x12, 0x6, 0x8, 0x4, 0x5, 0x5,
+    0x10, 0x7, 0x8, 0x5, 0x5, 0x4, 0xf, 0x8,
+    0x9, 0x5, 0x4, 0x5, 0xd, 0x9, 0xa, 0x5,
+    0x4, 0x4, 0xc, 0xa, 0xb, 0x5, 0x3, 0x5,
+    0x2, 0x13, 0xc, 0x4, 0x4, 0x4, 0x1, 0x14,
+    0x4, 0x3, 0x5, 0x5, 0x3, 0x4, 0x1, 0x14,
+    0x3, 0x5, 0x5, 0x4, 0x3, 0x19, 0x4, 0x5,
+    0x4, 0x5, 0x3, 0x18, 0x5, 0x4, 0x5, 0x4,
+    0x3, 0x18, 0x6, 0x4, 0x4, 0x4, 0x3, 0x18,
+    0x6, 0x4, 0x4, 0x4, 0x3, 0x18, 0x6, 0x4,
+    0x4, 0x4, 0x3, 0x18, 0x6, 0x4, 0x4, 0x4,
+    0x3, 0x18, 0x5, 0x4, 0x5, 0x4, 0x3, 0x18,
+    0x4, 0x5, 0x4, 0x5, 0x3, 0x18, 0x3, 0x5,
+    0x5, 0x4, 0x3, 0x19, 0x4, 0x3, 0x5, 0x5,
+    0x3, 0x4, 0x1, 0x14, 0xc, 0x4, 0x4, 0x4,
+    0x2, 0x13, 0xb, 0x5, 0x3, 0x5, 0xb, 0xa,
+    0xa, 0x5, 0x4, 0x4, 0xd, 0x9, 0x9, 0x5,
+    0x4, 0x5, 0xe, 0x8, 0x8, 0x5, 0x5, 0x4,
+    0x10, 0x7, 0x8, 0x4, 0x5, 0x5, 0x11, 0x6,
+    0x10, 0x5, 0x13, 0x5, 0xf, 0x5, 0x15, 0x4,
+    0xe, 0x5, 0x26, 0x6, 0x27, 0x5, 0x28, 0x4,
+    0x2a, 0x2, 0xa,
 
     /* U+F03E "" */
-    0x3f, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff,
-    0xf0, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x7, 0xff,
-    0xef, 0xff, 0xf0, 0xf, 0xff, 0xc7, 0xff, 0xf8,
-    0xf, 0xff, 0x83, 0xff, 0xfc, 0x1f, 0xff, 0x1,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x3f,
-    0xff, 0x8f, 0xf0, 0x0, 0x1f, 0xff, 0x7, 0xe0,
-    0x0, 0x1f, 0xfe, 0x3, 0xc0, 0x0, 0x1f, 0xfc,
-    0x0, 0x80, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0,
-    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
+    0x2, 0x24, 0x3, 0x26, 0x1, 0x56, 0x4, 0x23,
+    0x7, 0x21, 0x7, 0x20, 0x9, 0x1f, 0x9, 0x1f,
+    0x9, 0xe, 0x1, 0x10, 0x8, 0xe, 0x3, 0x10,
+    0x7, 0xd, 0x5, 0x10, 0x5, 0xd, 0x7, 0x20,
+    0x9, 0x1e, 0xb, 0x1c, 0xd, 0xf, 0x3, 0x8,
+    0xf, 0xd, 0x5, 0x6, 0x10, 0xc, 0x7, 0x4,
+    0x11, 0xb, 0xa, 0x1, 0x12, 0xa, 0x1e, 0xa,
+    0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa, 0x1e, 0x7d,
+    0x1, 0x26, 0x3, 0x24, 0x2,
 
     /* U+F048 "" */
-    0xfc, 0x0, 0x7, 0x7e, 0x0, 0x7, 0xff, 0x0,
-    0x7, 0xff, 0x80, 0x7, 0xff, 0xc0, 0x7, 0xff,
-    0xe0, 0x7, 0xff, 0xf0, 0x7, 0xff, 0xf8, 0x7,
-    0xff, 0xfc, 0x7, 0xff, 0xfe, 0x7, 0xff, 0xff,
-    0x7, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xfe, 0x7,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0x80, 0x7f, 0xff,
-    0xc0, 0x1f, 0xff, 0xe0, 0x7, 0xff, 0xf0, 0x1,
-    0xff, 0xf8, 0x0, 0x7f, 0xfc, 0x0, 0x1f, 0xfe,
-    0x0, 0x7, 0xff, 0x0, 0x1, 0xc0,
+    0x0, 0x6, 0xf, 0x3, 0x1, 0x6, 0xe, 0xb,
+    0xd, 0xc, 0xc, 0xd, 0xb, 0xe, 0xa, 0xf,
+    0x9, 0x10, 0x8, 0x11, 0x7, 0x12, 0x6, 0x13,
+    0x5, 0x14, 0x3, 0x16, 0x2, 0x17, 0x1, 0xc7,
+    0x1, 0x18, 0x2, 0x17, 0x3, 0x16, 0x4, 0x15,
+    0x6, 0x13, 0x7, 0x12, 0x8, 0x11, 0x9, 0x10,
+    0xa, 0xf, 0xb, 0xe, 0xc, 0xd, 0xd, 0xc,
+    0xe, 0xb, 0xf, 0x3, 0x1,
 
     /* U+F04B "" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0xf8, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff,
-    0xfc, 0x7, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xfc, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x7,
-    0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xe0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xfe, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0x4, 0x1e, 0x6, 0x1c, 0x9, 0x1a, 0xb,
+    0x18, 0xc, 0x17, 0xe, 0x15, 0x10, 0x13, 0x11,
+    0x12, 0x13, 0x10, 0x15, 0xe, 0x16, 0xd, 0x18,
+    0xb, 0x1a, 0x9, 0x1c, 0x7, 0x1d, 0x6, 0x1f,
+    0x4, 0x21, 0x2, 0x22, 0x1, 0xae, 0x1, 0x21,
+    0x2, 0x1f, 0x4, 0x1d, 0x6, 0x1c, 0x7, 0x1a,
+    0x9, 0x18, 0xb, 0x16, 0xd, 0x15, 0xe, 0x13,
+    0x10, 0x11, 0x12, 0x10, 0x13, 0xe, 0x15, 0xc,
+    0x17, 0xb, 0x18, 0x9, 0x1b, 0x6, 0x1e, 0x4,
+    0x40,
 
     /* U+F04C "" */
-    0x3f, 0xf8, 0x3, 0xff, 0x8f, 0xff, 0x80, 0xff,
-    0xfb, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0x7, 0xff, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xfe,
-    0xf, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xfe, 0xf, 0xff,
-    0xef, 0xff, 0x80, 0xff, 0xf8, 0xff, 0xe0, 0xf,
-    0xfe, 0x0,
+    0x2, 0xb, 0x9, 0xb, 0x3, 0xd, 0x7, 0xd,
+    0x1, 0xf, 0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e,
+    0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e,
+    0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e,
+    0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e,
+    0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e,
+    0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e,
+    0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e,
+    0x5, 0x1e, 0x5, 0x1e, 0x5, 0x1e, 0x5, 0xf,
+    0x1, 0xd, 0x7, 0xd, 0x3, 0xb, 0x9, 0xb,
+    0x2,
 
     /* U+F04D "" */
-    0x3f, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xfe, 0x0,
+    0x2, 0x1f, 0x3, 0x21, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0x41, 0x1, 0x21, 0x3, 0x1f, 0x2,
 
     /* U+F051 "" */
-    0x70, 0x0, 0x1f, 0xfc, 0x0, 0xf, 0xff, 0x0,
-    0x7, 0xff, 0xc0, 0x3, 0xff, 0xf0, 0x1, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xc0,
-    0x3f, 0xff, 0xf0, 0x1f, 0xff, 0xfc, 0xf, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xfe, 0x3f, 0xff, 0xfc, 0x1f, 0xff, 0xfc,
-    0xf, 0xff, 0xfc, 0x7, 0xff, 0xfc, 0x3, 0xff,
-    0xfc, 0x1, 0xff, 0xfc, 0x0, 0xff, 0xfc, 0x0,
-    0x7f, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x1f, 0xfc,
-    0x0, 0xf, 0xdc, 0x0, 0x7, 0xe0,
+    0x1, 0x3, 0xf, 0xb, 0xe, 0xc, 0xd, 0xd,
+    0xc, 0xe, 0xb, 0xf, 0xa, 0x10, 0x9, 0x11,
+    0x8, 0x12, 0x7, 0x13, 0x6, 0x15, 0x4, 0x16,
+    0x3, 0x17, 0x2, 0x18, 0x1, 0xc7, 0x1, 0x17,
+    0x2, 0x16, 0x3, 0x14, 0x5, 0x13, 0x6, 0x12,
+    0x7, 0x11, 0x8, 0x10, 0x9, 0xf, 0xa, 0xe,
+    0xb, 0xd, 0xc, 0xc, 0xd, 0xb, 0xe, 0x6,
+    0x1, 0x3, 0xf, 0x6,
 
     /* U+F052 "" */
-    0x0, 0x0, 0x70, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x7, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
-    0x7f, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff,
-    0xc0, 0x7f, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xf8,
+    0x11, 0x3, 0x20, 0x7, 0x1e, 0x7, 0x1d, 0x9,
+    0x1b, 0xb, 0x19, 0xd, 0x17, 0xf, 0x15, 0x11,
+    0x13, 0x13, 0x11, 0x15, 0xf, 0x17, 0xd, 0x19,
+    0xb, 0x1b, 0x9, 0x1d, 0x7, 0x1f, 0x5, 0x21,
+    0x4, 0x21, 0x3, 0x23, 0x2, 0x23, 0x2, 0x23,
+    0x3, 0x21, 0x5, 0x1f, 0x74, 0x21, 0x3, 0x23,
+    0x2, 0x23, 0x2, 0x23, 0x2, 0x23, 0x2, 0x23,
+    0x2, 0x23, 0x2, 0x23, 0x2, 0x23, 0x3, 0x21,
+    0x2,
 
     /* U+F053 "" */
-    0x0, 0x0, 0xe0, 0x0, 0xf, 0x80, 0x0, 0xfc,
-    0x0, 0xf, 0xf0, 0x0, 0xff, 0x80, 0xf, 0xf8,
-    0x0, 0xff, 0x80, 0xf, 0xf8, 0x0, 0xff, 0x80,
-    0xf, 0xf8, 0x0, 0xff, 0x80, 0xf, 0xf8, 0x0,
-    0xff, 0x80, 0xf, 0xf8, 0x0, 0xff, 0x80, 0xf,
-    0xf8, 0x0, 0xff, 0x80, 0x7, 0xfc, 0x0, 0x1f,
-    0xf0, 0x0, 0x7f, 0xc0, 0x1, 0xff, 0x0, 0x7,
-    0xfc, 0x0, 0x1f, 0xf0, 0x0, 0x7f, 0xc0, 0x1,
-    0xff, 0x0, 0x7, 0xfc, 0x0, 0x1f, 0xf0, 0x0,
-    0x7f, 0xc0, 0x1, 0xff, 0x0, 0x7, 0xfc, 0x0,
-    0x1f, 0xe0, 0x0, 0x7e, 0x0, 0x1, 0xf0, 0x0,
-    0x6, 0x0,
+    0x10, 0x3, 0x11, 0x5, 0xf, 0x6, 0xe, 0x8,
+    0xc, 0x9, 0xb, 0x9, 0xb, 0x9, 0xb, 0x9,
+    0xb, 0x9, 0xb, 0x9, 0xb, 0x9, 0xb, 0x9,
+    0xb, 0x9, 0xb, 0x9, 0xb, 0x9, 0xb, 0x9,
+    0xb, 0x9, 0xc, 0x9, 0xd, 0x9, 0xd, 0x9,
+    0xd, 0x9, 0xd, 0x9, 0xd, 0x9, 0xd, 0x9,
+    0xd, 0x9, 0xd, 0x9, 0xd, 0x9, 0xd, 0x9,
+    0xd, 0x9, 0xd, 0x9, 0xd, 0x8, 0xe, 0x6,
+    0x10, 0x5, 0x11, 0x2, 0x3,
 
     /* U+F054 "" */
-    0x38, 0x0, 0x3, 0xe0, 0x0, 0x3f, 0x80, 0x1,
-    0xfe, 0x0, 0xf, 0xf8, 0x0, 0x3f, 0xe0, 0x0,
-    0xff, 0x80, 0x3, 0xfe, 0x0, 0xf, 0xf8, 0x0,
-    0x3f, 0xe0, 0x0, 0xff, 0x80, 0x3, 0xfe, 0x0,
-    0xf, 0xf8, 0x0, 0x3f, 0xe0, 0x0, 0xff, 0x80,
-    0x3, 0xfe, 0x0, 0xf, 0xf8, 0x0, 0x7f, 0xc0,
-    0x7, 0xfc, 0x0, 0x7f, 0xc0, 0x7, 0xfc, 0x0,
-    0x7f, 0xc0, 0x7, 0xfc, 0x0, 0x7f, 0xc0, 0x7,
-    0xfc, 0x0, 0x7f, 0xc0, 0x7, 0xfc, 0x0, 0x7f,
-    0xc0, 0x7, 0xfc, 0x0, 0x7f, 0xc0, 0x3, 0xfc,
-    0x0, 0x1f, 0xc0, 0x0, 0x7c, 0x0, 0x1, 0xc0,
-    0x0, 0x0,
+    0x2, 0x3, 0x11, 0x5, 0xf, 0x7, 0xe, 0x8,
+    0xd, 0x9, 0xd, 0x9, 0xd, 0x9, 0xd, 0x9,
+    0xd, 0x9, 0xd, 0x9, 0xd, 0x9, 0xd, 0x9,
+    0xd, 0x9, 0xd, 0x9, 0xd, 0x9, 0xd, 0x9,
+    0xd, 0x9, 0xc, 0x9, 0xb, 0x9, 0xb, 0x9,
+    0xb, 0x9, 0xb, 0x9, 0xb, 0x9, 0xb, 0x9,
+    0xb, 0x9, 0xb, 0x9, 0xb, 0x9, 0xb, 0x9,
+    0xb, 0x9, 0xb, 0x9, 0xc, 0x8, 0xd, 0x7,
+    0xf, 0x5, 0x11, 0x3, 0x10,
 
     /* U+F067 "" */
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x1, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x1,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x7, 0xc0,
-    0x0, 0x0,
+    0xf, 0x5, 0x1d, 0x7, 0x1c, 0x7, 0x1c, 0x7,
+    0x1c, 0x7, 0x1c, 0x7, 0x1c, 0x7, 0x1c, 0x7,
+    0x1c, 0x7, 0x1c, 0x7, 0x1c, 0x7, 0x1c, 0x7,
+    0x1c, 0x7, 0x1c, 0x7, 0xf, 0x21, 0x1, 0xaf,
+    0x1, 0x21, 0xf, 0x7, 0x1c, 0x7, 0x1c, 0x7,
+    0x1c, 0x7, 0x1c, 0x7, 0x1c, 0x7, 0x1c, 0x7,
+    0x1c, 0x7, 0x1c, 0x7, 0x1c, 0x7, 0x1c, 0x7,
+    0x1c, 0x7, 0x1c, 0x7, 0x1d, 0x5, 0xf,
 
     /* U+F068 "" */
-    0x7f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf0,
+    0x1, 0x21, 0x1, 0xaf, 0x1, 0x21, 0x1,
 
     /* U+F06E "" */
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0xf,
-    0xfe, 0x3, 0xff, 0x80, 0x0, 0xff, 0xc0, 0x7,
-    0xfe, 0x0, 0xf, 0xf8, 0x0, 0xf, 0xf8, 0x0,
-    0xff, 0x80, 0x0, 0x3f, 0xe0, 0xf, 0xf8, 0x7,
-    0x80, 0xff, 0x80, 0xff, 0x80, 0x3f, 0x7, 0xfe,
-    0xf, 0xfc, 0x1, 0xfc, 0x1f, 0xf8, 0x7f, 0xe0,
-    0xf, 0xf0, 0xff, 0xc7, 0xfe, 0x0, 0x7f, 0x83,
-    0xff, 0x7f, 0xf0, 0x7, 0xfe, 0x1f, 0xff, 0xff,
-    0x87, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0x87, 0xff, 0xff, 0xe1, 0xff, 0xfc, 0x3f, 0xfb,
-    0xff, 0xf, 0xff, 0xe1, 0xff, 0x8f, 0xfc, 0x3f,
-    0xfe, 0x1f, 0xf8, 0x7f, 0xe1, 0xff, 0xf0, 0xff,
-    0xc1, 0xff, 0x7, 0xff, 0xf, 0xfc, 0x7, 0xfc,
-    0x1f, 0xf0, 0x7f, 0xc0, 0x1f, 0xf0, 0x3e, 0x7,
-    0xfc, 0x0, 0x7f, 0xc0, 0x0, 0x7f, 0xc0, 0x1,
-    0xff, 0x80, 0xf, 0xfc, 0x0, 0x7, 0xff, 0x1,
-    0xff, 0xc0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0,
+    0x12, 0xa, 0x1f, 0x11, 0x1a, 0x15, 0x16, 0x19,
+    0x12, 0xb, 0x7, 0xb, 0xf, 0xa, 0xb, 0xa,
+    0xd, 0x9, 0xf, 0x9, 0xb, 0x9, 0x11, 0x9,
+    0x9, 0x9, 0x8, 0x4, 0x7, 0x9, 0x7, 0x9,
+    0x9, 0x6, 0x5, 0xa, 0x5, 0xa, 0x9, 0x7,
+    0x5, 0xa, 0x4, 0xa, 0x9, 0x8, 0x4, 0xa,
+    0x3, 0xa, 0xa, 0x8, 0x5, 0xa, 0x1, 0xb,
+    0x9, 0xa, 0x4, 0x16, 0x4, 0xf, 0x4, 0x16,
+    0x4, 0xf, 0x4, 0x16, 0x4, 0xf, 0x4, 0xb,
+    0x1, 0xa, 0x4, 0xf, 0x4, 0xa, 0x3, 0xa,
+    0x4, 0xd, 0x4, 0xa, 0x4, 0xa, 0x4, 0xd,
+    0x4, 0xa, 0x5, 0x9, 0x5, 0xb, 0x4, 0xa,
+    0x7, 0x9, 0x5, 0x9, 0x5, 0x9, 0x9, 0x9,
+    0x6, 0x5, 0x6, 0x9, 0xb, 0x9, 0xf, 0x9,
+    0xd, 0xa, 0xb, 0xa, 0xf, 0xb, 0x7, 0xb,
+    0x12, 0x19, 0x16, 0x15, 0x1a, 0x11, 0x20, 0x9,
+    0x12,
 
     /* U+F070 "" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0xf, 0xfc, 0x0, 0x0, 0x3, 0xfc,
-    0xf, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xcf, 0xff,
-    0xff, 0x80, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0xff, 0xe0, 0x0,
-    0x1, 0xff, 0xc0, 0x7, 0xfe, 0x0, 0x0, 0x1f,
-    0xe0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0xff, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0xf, 0xf1, 0xf0, 0x3f,
-    0xe0, 0x0, 0x0, 0xff, 0x3f, 0x7, 0xfe, 0x0,
-    0x30, 0x7, 0xff, 0xf0, 0x7f, 0xe0, 0x7, 0x80,
-    0x7f, 0xff, 0xf, 0xfc, 0x1, 0xf8, 0x7, 0xff,
-    0xf0, 0xff, 0xc0, 0x7f, 0x80, 0x7f, 0xfe, 0x1f,
-    0xfc, 0xf, 0xfc, 0x3, 0xff, 0xc3, 0xff, 0x81,
-    0xff, 0xc0, 0x3f, 0xf8, 0x7f, 0xf0, 0x3f, 0xf8,
-    0x3, 0xff, 0xf, 0xfe, 0x3, 0xff, 0x80, 0x1f,
-    0xe1, 0xff, 0x80, 0x3f, 0xf0, 0x1, 0xfe, 0x7f,
-    0xe0, 0x7, 0xfe, 0x0, 0x1f, 0xff, 0xfc, 0x0,
-    0x7f, 0xe0, 0x1, 0xff, 0xff, 0x0, 0x7, 0xfc,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x7f, 0xc0, 0x0,
-    0xff, 0xf0, 0x0, 0x7, 0xfc, 0x0, 0xf, 0xfc,
-    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x7f, 0x80, 0x0,
-    0x7, 0xff, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x7f, 0xc0, 0x0, 0x1, 0xff, 0xfc,
-    0x3, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x3f,
-    0xc0, 0x0, 0x0, 0x3f, 0xf0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x2, 0x2, 0x30, 0x5, 0x2e, 0x6, 0x2d, 0x7,
+    0x2c, 0x8, 0x2d, 0x8, 0xa, 0xa, 0x18, 0x8,
+    0x6, 0x10, 0x16, 0x8, 0x2, 0x15, 0x15, 0x20,
+    0x15, 0xf, 0x6, 0xb, 0x14, 0xb, 0xb, 0xa,
+    0x14, 0x8, 0xf, 0x9, 0x15, 0x8, 0xe, 0x9,
+    0x15, 0x8, 0x3, 0x5, 0x6, 0x9, 0x15, 0x8,
+    0x2, 0x6, 0x5, 0xa, 0xb, 0x2, 0x9, 0xf,
+    0x5, 0xa, 0xa, 0x4, 0x8, 0xf, 0x4, 0xa,
+    0x9, 0x6, 0x8, 0xf, 0x4, 0xa, 0x7, 0x8,
+    0x8, 0xe, 0x4, 0xb, 0x6, 0xa, 0x8, 0xc,
+    0x4, 0xb, 0x6, 0xb, 0x8, 0xb, 0x4, 0xb,
+    0x6, 0xb, 0x9, 0xa, 0x4, 0xb, 0x7, 0xb,
+    0xa, 0x8, 0x4, 0xa, 0x9, 0xa, 0xb, 0x8,
+    0x2, 0xa, 0xa, 0xa, 0xc, 0x13, 0xb, 0xa,
+    0xc, 0x11, 0xd, 0x9, 0xe, 0xe, 0xf, 0x9,
+    0xe, 0xc, 0x11, 0x9, 0xe, 0xa, 0x13, 0xa,
+    0xe, 0x8, 0x14, 0xb, 0xd, 0x8, 0x15, 0xf,
+    0x8, 0x9, 0x15, 0xf, 0x8, 0x8, 0x16, 0xe,
+    0x8, 0x8, 0x18, 0xa, 0xa, 0x9, 0x2b, 0x9,
+    0x2c, 0x7, 0x2d, 0x6, 0x2e, 0x5, 0x30, 0x2,
+    0x2,
 
     /* U+F071 "" */
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x1, 0xfc, 0x7, 0xf0, 0x0,
-    0x0, 0x7, 0xf8, 0xf, 0xf0, 0x0, 0x0, 0xf,
-    0xf0, 0x1f, 0xe0, 0x0, 0x0, 0x3f, 0xe0, 0x3f,
-    0xe0, 0x0, 0x0, 0x7f, 0xc0, 0x7f, 0xc0, 0x0,
-    0x1, 0xff, 0x80, 0xff, 0xc0, 0x0, 0x7, 0xff,
-    0x1, 0xff, 0xc0, 0x0, 0xf, 0xfe, 0x3, 0xff,
-    0x80, 0x0, 0x3f, 0xfc, 0x7, 0xff, 0x80, 0x0,
-    0x7f, 0xf8, 0xf, 0xff, 0x0, 0x1, 0xff, 0xf0,
-    0x1f, 0xff, 0x0, 0x3, 0xff, 0xe0, 0x3f, 0xfe,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0xe3, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0x83,
-    0xff, 0xfc, 0x1, 0xff, 0xfe, 0x3, 0xff, 0xfc,
-    0x3, 0xff, 0xfc, 0x7, 0xff, 0xf8, 0xf, 0xff,
-    0xf8, 0xf, 0xff, 0xf8, 0x1f, 0xff, 0xf0, 0x1f,
-    0xff, 0xf0, 0x7f, 0xff, 0xf0, 0x7f, 0xff, 0xf1,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf8,
+    0x16, 0x3, 0x2a, 0x7, 0x28, 0x7, 0x27, 0x9,
+    0x26, 0x9, 0x25, 0xb, 0x24, 0xb, 0x23, 0xd,
+    0x21, 0xf, 0x20, 0xf, 0x1f, 0x11, 0x1e, 0x11,
+    0x1d, 0x13, 0x1b, 0x14, 0x1b, 0x7, 0x7, 0x7,
+    0x19, 0x8, 0x7, 0x8, 0x18, 0x8, 0x7, 0x8,
+    0x17, 0x9, 0x7, 0x9, 0x16, 0x9, 0x7, 0x9,
+    0x15, 0xa, 0x7, 0xa, 0x13, 0xb, 0x7, 0xb,
+    0x12, 0xb, 0x7, 0xb, 0x11, 0xc, 0x7, 0xc,
+    0x10, 0xc, 0x7, 0xc, 0xf, 0xd, 0x7, 0xd,
+    0xe, 0xd, 0x7, 0xd, 0xd, 0x23, 0xb, 0x11,
+    0x3, 0x11, 0xa, 0x10, 0x5, 0x10, 0x9, 0x10,
+    0x7, 0x10, 0x8, 0x10, 0x7, 0x10, 0x7, 0x11,
+    0x7, 0x11, 0x6, 0x11, 0x7, 0x11, 0x5, 0x13,
+    0x5, 0x13, 0x3, 0x15, 0x3, 0x15, 0x2, 0x2d,
+    0x2, 0x2d, 0x2, 0x2d, 0x3, 0x2b, 0x5, 0x29,
+    0x3,
 
     /* U+F074 "" */
-    0x0, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0xff, 0xe0, 0x0, 0xff, 0xfc, 0xff, 0xf0,
-    0x0, 0xff, 0xfe, 0xff, 0xf0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xfc, 0x7,
-    0xff, 0xfe, 0xff, 0xfe, 0xf, 0xff, 0xfc, 0x0,
-    0xfe, 0x1f, 0xe3, 0xf8, 0x0, 0x7c, 0x3f, 0xc3,
-    0xf0, 0x0, 0x38, 0x7f, 0x83, 0xe0, 0x0, 0x10,
-    0xff, 0x3, 0xc0, 0x0, 0x1, 0xfe, 0x1, 0x80,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x1, 0x80, 0x0,
-    0x1f, 0xe1, 0x3, 0xc0, 0x0, 0x3f, 0xc3, 0x83,
-    0xe0, 0x0, 0x7f, 0x87, 0xc3, 0xf0, 0x0, 0xff,
-    0xf, 0xe3, 0xf8, 0xff, 0xfe, 0xf, 0xff, 0xfc,
-    0xff, 0xfc, 0x7, 0xff, 0xfe, 0xff, 0xf8, 0x3,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xfe, 0xff, 0xe0, 0x0, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x1, 0x80,
+    0x1f, 0x2, 0x25, 0x4, 0x24, 0x5, 0x23, 0x6,
+    0x22, 0x7, 0x3, 0xb, 0xd, 0xe, 0x2, 0xc,
+    0xc, 0xf, 0x1, 0xc, 0xb, 0x1e, 0x9, 0x20,
+    0x7, 0x12, 0x1, 0xf, 0x5, 0x12, 0xa, 0x7,
+    0x4, 0x8, 0x3, 0x7, 0xc, 0x5, 0x4, 0x8,
+    0x4, 0x6, 0xe, 0x3, 0x4, 0x8, 0x5, 0x5,
+    0x10, 0x1, 0x4, 0x8, 0x6, 0x4, 0x15, 0x8,
+    0x8, 0x2, 0x15, 0x8, 0x1f, 0x8, 0x1f, 0x8,
+    0xb, 0x2, 0x12, 0x8, 0x4, 0x1, 0x6, 0x4,
+    0x10, 0x8, 0x4, 0x3, 0x5, 0x5, 0xe, 0x8,
+    0x4, 0x5, 0x4, 0x6, 0xc, 0x8, 0x4, 0x7,
+    0x3, 0x7, 0x3, 0xf, 0x5, 0x12, 0x2, 0xe,
+    0x7, 0x12, 0x1, 0xd, 0x9, 0x1e, 0xb, 0x1c,
+    0xc, 0x10, 0x1, 0xb, 0xd, 0xe, 0x20, 0x7,
+    0x21, 0x6, 0x22, 0x5, 0x23, 0x4, 0x25, 0x2,
+    0x7,
 
     /* U+F077 "" */
-    0x0, 0x1, 0xe0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0xf, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0xf8, 0x0, 0x3, 0xff,
-    0xff, 0x0, 0x1, 0xff, 0x3f, 0xe0, 0x0, 0xff,
-    0x87, 0xfc, 0x0, 0x7f, 0xc0, 0xff, 0x80, 0x3f,
-    0xe0, 0x1f, 0xf0, 0x1f, 0xf0, 0x3, 0xfe, 0xf,
-    0xf8, 0x0, 0x7f, 0xc7, 0xfc, 0x0, 0xf, 0xfb,
-    0xfe, 0x0, 0x1, 0xfe, 0xff, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x7, 0xf7, 0xc0, 0x0, 0x0,
-    0xf8, 0xe0, 0x0, 0x0, 0x1c,
+    0xf, 0x4, 0x1d, 0x6, 0x1b, 0x8, 0x19, 0xa,
+    0x17, 0xc, 0x15, 0xe, 0x13, 0x10, 0x11, 0x12,
+    0xf, 0x9, 0x2, 0x9, 0xd, 0x9, 0x4, 0x9,
+    0xb, 0x9, 0x6, 0x9, 0x9, 0x9, 0x8, 0x9,
+    0x7, 0x9, 0xa, 0x9, 0x5, 0x9, 0xc, 0x9,
+    0x3, 0x9, 0xe, 0x9, 0x1, 0x9, 0x10, 0x8,
+    0x1, 0x8, 0x12, 0xf, 0x14, 0x7, 0x1, 0x5,
+    0x16, 0x5, 0x3, 0x3, 0x18, 0x3, 0x2,
 
     /* U+F078 "" */
-    0x38, 0x0, 0x0, 0x7, 0x1f, 0x0, 0x0, 0x3,
-    0xef, 0xe0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0xff, 0xff, 0x80, 0x0, 0x7f, 0xdf, 0xf0, 0x0,
-    0x3f, 0xe3, 0xfe, 0x0, 0x1f, 0xf0, 0x7f, 0xc0,
-    0xf, 0xf8, 0xf, 0xf8, 0x7, 0xfc, 0x1, 0xff,
-    0x3, 0xfe, 0x0, 0x3f, 0xe1, 0xff, 0x0, 0x7,
-    0xfc, 0xff, 0x80, 0x0, 0xff, 0xff, 0xc0, 0x0,
-    0x1f, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0xf, 0xfc, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x0,
+    0x2, 0x3, 0x18, 0x3, 0x3, 0x5, 0x16, 0x5,
+    0x1, 0x7, 0x14, 0xf, 0x12, 0x11, 0x10, 0x9,
+    0x1, 0x9, 0xe, 0x9, 0x3, 0x9, 0xc, 0x9,
+    0x5, 0x9, 0xa, 0x9, 0x7, 0x9, 0x8, 0x9,
+    0x9, 0x9, 0x6, 0x9, 0xb, 0x9, 0x4, 0x9,
+    0xd, 0x9, 0x2, 0x9, 0xf, 0x12, 0x11, 0x10,
+    0x13, 0xe, 0x15, 0xc, 0x17, 0xa, 0x19, 0x8,
+    0x1b, 0x6, 0x1d, 0x4, 0xf,
 
     /* U+F079 "" */
-    0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x81, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xe1, 0xff, 0xff, 0xfc, 0x0, 0xff,
-    0xf8, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xfe, 0x3f,
-    0xff, 0xff, 0x0, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0x80, 0xff, 0xff, 0xe0, 0x0, 0x7, 0xc0, 0x7e,
-    0xfb, 0xf0, 0x0, 0x3, 0xe0, 0x3e, 0x7c, 0xf8,
-    0x0, 0x1, 0xf0, 0x1e, 0x3e, 0x3c, 0x0, 0x0,
-    0xf8, 0x2, 0x1f, 0x8, 0x0, 0x0, 0x7c, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x3e, 0x0, 0x7, 0xc0,
-    0x0, 0x0, 0x1f, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0xf, 0x80, 0x1, 0xf0, 0x0, 0x0, 0x7, 0xc0,
-    0x0, 0xf8, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x7c,
-    0x0, 0x0, 0x21, 0xf0, 0x80, 0x3e, 0x0, 0x0,
-    0x78, 0xf8, 0xf0, 0x1f, 0x0, 0x0, 0x3e, 0x7c,
-    0xf8, 0xf, 0x80, 0x0, 0x1f, 0xbe, 0xfc, 0x7,
-    0xc0, 0x0, 0xf, 0xff, 0xfe, 0x3, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf8, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xfe, 0x3f, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xf, 0xfe, 0x0, 0x1f, 0xff,
-    0xff, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x0,
+    0x9, 0x1, 0x2e, 0x5, 0x2b, 0x7, 0x29, 0x9,
+    0x6, 0x15, 0xc, 0xb, 0x4, 0x17, 0xa, 0xd,
+    0x3, 0x17, 0x9, 0xf, 0x3, 0x16, 0x8, 0x11,
+    0x3, 0x15, 0x7, 0x13, 0x12, 0x5, 0x7, 0x6,
+    0x1, 0x5, 0x1, 0x6, 0x12, 0x5, 0x7, 0x5,
+    0x2, 0x5, 0x2, 0x5, 0x12, 0x5, 0x7, 0x4,
+    0x3, 0x5, 0x3, 0x4, 0x12, 0x5, 0x9, 0x1,
+    0x4, 0x5, 0x4, 0x1, 0x14, 0x5, 0xe, 0x5,
+    0x19, 0x5, 0xe, 0x5, 0x19, 0x5, 0xe, 0x5,
+    0x19, 0x5, 0xe, 0x5, 0x19, 0x5, 0xe, 0x5,
+    0x19, 0x5, 0xe, 0x5, 0x14, 0x1, 0x4, 0x5,
+    0x4, 0x1, 0x9, 0x5, 0x12, 0x4, 0x3, 0x5,
+    0x3, 0x4, 0x7, 0x5, 0x12, 0x5, 0x2, 0x5,
+    0x2, 0x5, 0x7, 0x5, 0x12, 0x6, 0x1, 0x5,
+    0x1, 0x6, 0x7, 0x5, 0x12, 0x13, 0x7, 0x15,
+    0x3, 0x11, 0x8, 0x16, 0x3, 0xf, 0x9, 0x17,
+    0x3, 0xd, 0xa, 0x17, 0x4, 0xb, 0xc, 0x15,
+    0x6, 0x9, 0x29, 0x7, 0x2b, 0x5, 0x2e, 0x1,
+    0x9,
 
     /* U+F07B "" */
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
+    0x2, 0xf, 0x18, 0x11, 0x16, 0x13, 0x15, 0x14,
+    0x14, 0x15, 0x13, 0x26, 0x2, 0x27, 0x1, 0xff,
+    0xff, 0xff, 0x4b, 0x1, 0x26, 0x3, 0x24, 0x2,
 
     /* U+F093 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0x80,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x80, 0x1, 0xff, 0xff, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0x80,
-    0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x7f, 0xf9, 0xff, 0x9f,
-    0xfe, 0xff, 0xf9, 0xff, 0x9f, 0xff, 0xff, 0xf8,
-    0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x1f, 0xff, 0xff, 0xff, 0xf3,
-    0x1f, 0xff, 0xff, 0xff, 0xf3, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe,
+    0x3a, 0x4, 0x23, 0x6, 0x21, 0x8, 0x1f, 0xa,
+    0x1d, 0xc, 0x1b, 0xe, 0x19, 0x10, 0x17, 0x12,
+    0x15, 0x14, 0x13, 0x16, 0x11, 0x18, 0xf, 0x1a,
+    0xe, 0x1a, 0xe, 0x1a, 0xf, 0x18, 0x17, 0xa,
+    0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa,
+    0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa,
+    0x1e, 0xa, 0x1e, 0xa, 0x1e, 0xa, 0x10, 0xc,
+    0x2, 0xa, 0x2, 0xc, 0x1, 0xd, 0x2, 0xa,
+    0x2, 0x1a, 0xe, 0x1b, 0xc, 0x1e, 0x8, 0x7c,
+    0x2, 0x2, 0x3, 0x21, 0x2, 0x2, 0x3, 0x21,
+    0x2, 0x2, 0x3, 0x2d, 0x1, 0x26, 0x1,
 
     /* U+F095 "" */
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x3f,
-    0xfe, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xfc,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x20, 0x0, 0xff, 0xc0, 0x0, 0xf0, 0x1,
-    0xff, 0x80, 0x7, 0xf8, 0x7, 0xff, 0x0, 0x1f,
-    0xfc, 0xf, 0xfe, 0x0, 0x7f, 0xfe, 0x3f, 0xfc,
-    0x0, 0xff, 0xff, 0x7f, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
+    0x1d, 0x3, 0x24, 0x9, 0x1f, 0xc, 0x1b, 0xd,
+    0x1b, 0xd, 0x1a, 0xe, 0x1a, 0xe, 0x1a, 0xe,
+    0x19, 0xf, 0x19, 0xf, 0x18, 0xf, 0x1a, 0xe,
+    0x1b, 0xd, 0x1c, 0xc, 0x1d, 0xa, 0x1f, 0x9,
+    0x1f, 0x9, 0x1f, 0x8, 0x1f, 0x9, 0x1f, 0x8,
+    0x1f, 0x9, 0x1e, 0x9, 0x1f, 0x9, 0x1e, 0x9,
+    0x10, 0x1, 0xd, 0xa, 0xe, 0x4, 0xb, 0xa,
+    0xc, 0x8, 0x8, 0xb, 0xb, 0xb, 0x6, 0xb,
+    0xa, 0xe, 0x3, 0xc, 0xa, 0x10, 0x1, 0xc,
+    0xb, 0x1c, 0xc, 0x1b, 0xe, 0x19, 0xf, 0x18,
+    0x10, 0x16, 0x12, 0x14, 0x14, 0x12, 0x17, 0xf,
+    0x19, 0xc, 0x1c, 0x8, 0x1e,
 
     /* U+F0C4 "" */
-    0x7, 0xc0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x1,
-    0xc0, 0xff, 0xe0, 0x0, 0xff, 0x3f, 0xfe, 0x0,
-    0x3f, 0xf7, 0xff, 0xc0, 0xf, 0xff, 0xf8, 0xfc,
-    0x3, 0xff, 0xbe, 0xf, 0x80, 0xff, 0xe7, 0xc1,
-    0xf0, 0x3f, 0xf8, 0xf8, 0x3e, 0xf, 0xfe, 0x1f,
-    0x8f, 0xc3, 0xff, 0x81, 0xff, 0xf8, 0xff, 0xe0,
-    0x3f, 0xff, 0xbf, 0xf8, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x3f, 0xff, 0xff, 0x80, 0x1, 0xff, 0xff,
-    0xe0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x3f,
-    0xfe, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xf8, 0x3, 0xff, 0xfb, 0xff,
-    0x80, 0x7f, 0xfe, 0x3f, 0xf8, 0x1f, 0x8f, 0xc3,
-    0xff, 0x83, 0xe0, 0xf8, 0x3f, 0xf8, 0x7c, 0x1f,
-    0x3, 0xff, 0x8f, 0x83, 0xe0, 0x3f, 0xf9, 0xf8,
-    0xfc, 0x3, 0xff, 0x9f, 0xff, 0x0, 0x3f, 0xfb,
-    0xff, 0xe0, 0x3, 0xff, 0x3f, 0xf8, 0x0, 0x3f,
-    0xc3, 0xfe, 0x0, 0x0, 0xe0, 0x1f, 0x0, 0x0,
-    0x0, 0x0,
+    0x5, 0x5, 0x1c, 0x9, 0x10, 0x3, 0x6, 0xb,
+    0xd, 0x8, 0x2, 0xd, 0xb, 0xa, 0x1, 0xd,
+    0xa, 0x11, 0x3, 0x6, 0x8, 0xb, 0x1, 0x5,
+    0x5, 0x5, 0x7, 0xb, 0x2, 0x5, 0x5, 0x5,
+    0x6, 0xb, 0x3, 0x5, 0x5, 0x5, 0x5, 0xb,
+    0x4, 0x6, 0x3, 0x6, 0x4, 0xb, 0x6, 0xe,
+    0x3, 0xb, 0x7, 0xf, 0x1, 0xb, 0x9, 0x19,
+    0xb, 0x17, 0xe, 0x14, 0x13, 0xf, 0x15, 0xd,
+    0x17, 0xb, 0x17, 0xd, 0x15, 0xf, 0x10, 0x14,
+    0xd, 0x17, 0xb, 0x19, 0x9, 0xf, 0x1, 0xb,
+    0x8, 0xe, 0x3, 0xb, 0x6, 0x6, 0x3, 0x6,
+    0x4, 0xb, 0x5, 0x5, 0x5, 0x5, 0x5, 0xb,
+    0x4, 0x5, 0x5, 0x5, 0x6, 0xb, 0x3, 0x5,
+    0x5, 0x5, 0x7, 0xb, 0x2, 0x6, 0x3, 0x6,
+    0x8, 0xb, 0x2, 0xd, 0xa, 0xb, 0x1, 0xd,
+    0xb, 0xa, 0x2, 0xb, 0xd, 0x8, 0x4, 0x9,
+    0x11, 0x3, 0x8, 0x5, 0x19,
 
     /* U+F0C5 "" */
-    0x0, 0x1f, 0xff, 0x98, 0x0, 0x7, 0xff, 0xf3,
-    0x80, 0x0, 0xff, 0xfe, 0x78, 0x0, 0x1f, 0xff,
-    0xcf, 0x80, 0x3, 0xff, 0xf9, 0xf8, 0x0, 0x7f,
-    0xff, 0x3f, 0xc0, 0xf, 0xff, 0xe7, 0xfb, 0xf9,
-    0xff, 0xfc, 0x0, 0xff, 0x3f, 0xff, 0x80, 0x1f,
-    0xe7, 0xff, 0xf8, 0x3, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0x9f, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff,
-    0xf8, 0x1, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xf8, 0x0,
+    0xb, 0xe, 0x2, 0x2, 0x10, 0xf, 0x2, 0x3,
+    0xf, 0xf, 0x2, 0x4, 0xe, 0xf, 0x2, 0x5,
+    0xd, 0xf, 0x2, 0x6, 0xc, 0xf, 0x2, 0x8,
+    0xa, 0xf, 0x2, 0x8, 0x1, 0x7, 0x2, 0xf,
+    0xa, 0x8, 0x2, 0xf, 0xa, 0x8, 0x2, 0x10,
+    0x9, 0x8, 0x2, 0x21, 0x2, 0x21, 0x2, 0x21,
+    0x2, 0x21, 0x2, 0x21, 0x2, 0x21, 0x2, 0x21,
+    0x2, 0x21, 0x2, 0x21, 0x2, 0x21, 0x2, 0x21,
+    0x2, 0x21, 0x2, 0x21, 0x2, 0x21, 0x2, 0x21,
+    0x2, 0x21, 0x2, 0x21, 0x2, 0x21, 0x2, 0x21,
+    0x2, 0x21, 0x2, 0x21, 0x3, 0x17, 0x1, 0x8,
+    0x1b, 0x9, 0x1a, 0xa, 0x19, 0x19, 0xa, 0x19,
+    0xa, 0x19, 0xa, 0x19, 0xb, 0x17, 0xb,
 
     /* U+F0C7 "" */
-    0x3f, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xfe,
-    0x3, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xff, 0xe1, 0xf0, 0x0,
-    0x0, 0xfe, 0x3e, 0x0, 0x0, 0x1f, 0xe7, 0xc0,
-    0x0, 0x3, 0xfe, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x1f,
-    0xff, 0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xfc,
-    0x1, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xfe, 0x0,
+    0x2, 0x19, 0x9, 0x1b, 0x7, 0x1d, 0x6, 0x1e,
+    0x5, 0x1f, 0x4, 0x5, 0x14, 0x7, 0x3, 0x5,
+    0x14, 0x8, 0x2, 0x5, 0x14, 0x9, 0x1, 0x5,
+    0x14, 0xf, 0x14, 0xf, 0x14, 0xf, 0x14, 0xf,
+    0x14, 0xf, 0x14, 0xf, 0x14, 0xc8, 0x5, 0x1d,
+    0x7, 0x1b, 0x9, 0x1a, 0x9, 0x1a, 0x9, 0x1a,
+    0x9, 0x1a, 0x9, 0x1a, 0x9, 0x1b, 0x7, 0x1d,
+    0x5, 0x78, 0x1, 0x21, 0x3, 0x1f, 0x2,
 
     /* U+F0E7 "" */
-    0x1f, 0xff, 0x80, 0xf, 0xff, 0xc0, 0xf, 0xff,
-    0xe0, 0x7, 0xff, 0xf0, 0x3, 0xff, 0xf8, 0x1,
-    0xff, 0xf8, 0x0, 0xff, 0xfc, 0x0, 0x7f, 0xfe,
-    0x0, 0x3f, 0xfe, 0x0, 0x3f, 0xff, 0x0, 0x1f,
-    0xff, 0x80, 0xf, 0xff, 0x80, 0x7, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xc0,
-    0x0, 0x3f, 0xe0, 0x0, 0x1f, 0xe0, 0x0, 0x1f,
-    0xf0, 0x0, 0xf, 0xf0, 0x0, 0x7, 0xf0, 0x0,
-    0x3, 0xf8, 0x0, 0x3, 0xf8, 0x0, 0x1, 0xfc,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x7e, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x1f, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x7, 0x80, 0x0, 0x3,
-    0x80, 0x0, 0x0, 0x80, 0x0,
+    0x3, 0xe, 0xb, 0xe, 0xa, 0xf, 0xa, 0xf,
+    0xa, 0xf, 0xa, 0xe, 0xb, 0xe, 0xb, 0xe,
+    0xb, 0xd, 0xb, 0xe, 0xb, 0xe, 0xb, 0xd,
+    0xc, 0x17, 0x2, 0x18, 0x1, 0x18, 0x1, 0x17,
+    0x1, 0x18, 0x1, 0x17, 0x2, 0x17, 0x2, 0x16,
+    0x3, 0x16, 0x4, 0x14, 0xf, 0x9, 0x10, 0x9,
+    0x10, 0x8, 0x10, 0x9, 0x10, 0x8, 0x11, 0x7,
+    0x12, 0x7, 0x11, 0x7, 0x12, 0x7, 0x12, 0x6,
+    0x13, 0x6, 0x12, 0x6, 0x13, 0x5, 0x14, 0x5,
+    0x14, 0x4, 0x15, 0x4, 0x15, 0x3, 0x17, 0x1,
+    0xf,
 
     /* U+F0EA "" */
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xf3, 0xff,
-    0xc0, 0xf, 0xfe, 0x3f, 0xf8, 0x1, 0xff, 0xc7,
-    0xff, 0x0, 0x3f, 0xf9, 0xff, 0xe0, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x7f, 0xf0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0x1, 0xff, 0x8f, 0xff, 0x30, 0x3f, 0xf3, 0xff,
-    0xe7, 0x7, 0xfe, 0x7f, 0xfc, 0xf0, 0xff, 0xcf,
-    0xff, 0x9f, 0x1f, 0xf9, 0xff, 0xf3, 0xf3, 0xff,
-    0x3f, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xcf, 0xff,
-    0xfc, 0xff, 0xf8, 0x1, 0xff, 0x9f, 0xff, 0x0,
-    0x3f, 0xf3, 0xff, 0xf0, 0x7, 0xfe, 0x7f, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xe7,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0x7f, 0xcf, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0x80, 0x7, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xfe,
+    0xa, 0x5, 0x1d, 0x7, 0x14, 0x17, 0xb, 0xb,
+    0x2, 0xc, 0xa, 0xb, 0x3, 0xb, 0xa, 0xb,
+    0x3, 0xb, 0xa, 0xb, 0x2, 0xc, 0xa, 0x19,
+    0xa, 0x19, 0xa, 0x19, 0xa, 0xc, 0x17, 0xb,
+    0x18, 0xa, 0x19, 0xa, 0x3, 0xc, 0x2, 0x2,
+    0x6, 0xa, 0x2, 0xd, 0x2, 0x3, 0x5, 0xa,
+    0x2, 0xd, 0x2, 0x4, 0x4, 0xa, 0x2, 0xd,
+    0x2, 0x5, 0x3, 0xa, 0x2, 0xd, 0x2, 0x6,
+    0x2, 0xa, 0x2, 0xd, 0x2, 0x12, 0x2, 0xd,
+    0x2, 0x12, 0x2, 0xd, 0xa, 0xa, 0x2, 0xd,
+    0xa, 0xa, 0x2, 0xe, 0x9, 0xa, 0x2, 0x21,
+    0x2, 0x21, 0x2, 0x21, 0x2, 0x21, 0x2, 0x21,
+    0x2, 0x21, 0x2, 0x21, 0x2, 0x21, 0x2, 0x17,
+    0x1, 0x9, 0x2, 0x17, 0xc, 0x17, 0xc, 0x17,
+    0xc, 0x17, 0xc, 0x17, 0xc, 0x17, 0xc, 0x17,
+    0xd, 0x15, 0x1,
 
     /* U+F0F3 "" */
-    0x0, 0x0, 0xe0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x3f,
-    0xfe, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x7,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0xf, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xfc,
-    0x3, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0,
+    0x10, 0x3, 0x1f, 0x5, 0x1e, 0x5, 0x1e, 0x5,
+    0x1c, 0x9, 0x18, 0xd, 0x15, 0xf, 0x12, 0x13,
+    0x10, 0x13, 0xf, 0x15, 0xd, 0x17, 0xc, 0x17,
+    0xb, 0x18, 0xb, 0x19, 0xa, 0x19, 0xa, 0x19,
+    0xa, 0x19, 0xa, 0x19, 0xa, 0x19, 0xa, 0x19,
+    0xa, 0x19, 0x9, 0x1b, 0x8, 0x1b, 0x8, 0x1b,
+    0x7, 0x1d, 0x6, 0x1d, 0x5, 0x1f, 0x3, 0x21,
+    0x1, 0x69, 0x1, 0x21, 0x77, 0x9, 0x1a, 0x9,
+    0x1a, 0x9, 0x1b, 0x7, 0x1d, 0x5, 0xf,
 
     /* U+F11C "" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x1c, 0x38, 0x38,
-    0x70, 0x7f, 0xe0, 0xe1, 0xc1, 0xc3, 0x83, 0xff,
-    0x7, 0xe, 0xe, 0x1c, 0x1f, 0xf8, 0x38, 0x70,
-    0x70, 0xe0, 0xff, 0xc1, 0xc3, 0x83, 0x87, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x30, 0x70, 0x60,
-    0xff, 0xff, 0xc1, 0x83, 0x83, 0x7, 0xff, 0xfe,
-    0xc, 0x1c, 0x18, 0x3f, 0xff, 0xf0, 0x60, 0xe0,
-    0xc1, 0xff, 0xff, 0x83, 0x7, 0x6, 0xf, 0xff,
-    0xfc, 0x18, 0x38, 0x30, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x83, 0x80, 0x0, 0xe, 0xf, 0xfc, 0x1c,
-    0x0, 0x0, 0x70, 0x7f, 0xe0, 0xe0, 0x0, 0x3,
-    0x83, 0xff, 0x7, 0x0, 0x0, 0x1c, 0x1f, 0xf8,
-    0x38, 0x0, 0x0, 0xe0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xf0,
+    0x2, 0x29, 0x3, 0x2b, 0x1, 0x8c, 0x5, 0x3,
+    0x4, 0x3, 0x5, 0x3, 0x4, 0x3, 0x5, 0xa,
+    0x5, 0x3, 0x4, 0x3, 0x5, 0x3, 0x4, 0x3,
+    0x5, 0xa, 0x5, 0x3, 0x4, 0x3, 0x5, 0x3,
+    0x4, 0x3, 0x5, 0xa, 0x5, 0x3, 0x4, 0x3,
+    0x5, 0x3, 0x4, 0x3, 0x5, 0xa, 0x5, 0x3,
+    0x4, 0x3, 0x5, 0x3, 0x4, 0x3, 0x5, 0x68,
+    0x5, 0x2, 0x5, 0x3, 0x5, 0x2, 0x5, 0x12,
+    0x5, 0x2, 0x5, 0x3, 0x5, 0x2, 0x5, 0x12,
+    0x5, 0x2, 0x5, 0x3, 0x5, 0x2, 0x5, 0x12,
+    0x5, 0x2, 0x5, 0x3, 0x5, 0x2, 0x5, 0x12,
+    0x5, 0x2, 0x5, 0x3, 0x5, 0x2, 0x5, 0x12,
+    0x5, 0x2, 0x5, 0x3, 0x5, 0x2, 0x5, 0x68,
+    0x5, 0x3, 0x13, 0x3, 0x5, 0xa, 0x5, 0x3,
+    0x13, 0x3, 0x5, 0xa, 0x5, 0x3, 0x13, 0x3,
+    0x5, 0xa, 0x5, 0x3, 0x13, 0x3, 0x5, 0xa,
+    0x5, 0x3, 0x13, 0x3, 0x5, 0x8c, 0x1, 0x2b,
+    0x3, 0x29, 0x2,
 
     /* U+F124 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xff,
-    0xff, 0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xfc,
-    0x1, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x1f, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x0,
+    0x4b, 0x4, 0x23, 0x7, 0x20, 0xa, 0x1d, 0xc,
+    0x1b, 0xe, 0x18, 0x11, 0x16, 0x12, 0x15, 0x14,
+    0x13, 0x15, 0x12, 0x17, 0x10, 0x18, 0xe, 0x1b,
+    0xc, 0x1c, 0xb, 0x1e, 0x9, 0x1f, 0x8, 0x21,
+    0x7, 0x22, 0x6, 0x22, 0x7, 0x22, 0x7, 0x21,
+    0x8, 0x21, 0x9, 0x1f, 0xc, 0x1d, 0x1a, 0xe,
+    0x1b, 0xe, 0x1b, 0xd, 0x1c, 0xd, 0x1c, 0xc,
+    0x1d, 0xc, 0x1d, 0xc, 0x1d, 0xb, 0x1e, 0xb,
+    0x1e, 0xa, 0x1f, 0xa, 0x1f, 0x9, 0x20, 0x9,
+    0x20, 0x8, 0x22, 0x7, 0x22, 0x6, 0x24, 0x4,
+    0x12,
 
     /* U+F15B "" */
-    0x7f, 0xff, 0xcc, 0x3, 0xff, 0xff, 0x38, 0xf,
-    0xff, 0xfc, 0xf0, 0x3f, 0xff, 0xf3, 0xe0, 0xff,
-    0xff, 0xcf, 0xc3, 0xff, 0xff, 0x3f, 0x8f, 0xff,
-    0xfc, 0xff, 0x3f, 0xff, 0xf3, 0xfe, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xfe,
+    0x1, 0x11, 0x2, 0x2, 0x8, 0x12, 0x2, 0x3,
+    0x7, 0x12, 0x2, 0x4, 0x6, 0x12, 0x2, 0x5,
+    0x5, 0x12, 0x2, 0x6, 0x4, 0x12, 0x2, 0x7,
+    0x3, 0x12, 0x2, 0x8, 0x2, 0x12, 0x2, 0x9,
+    0x1, 0x12, 0x2, 0x1c, 0x2, 0x1c, 0xc, 0x12,
+    0xc, 0x13, 0xb, 0xff, 0xff, 0xff, 0xf, 0x1,
+    0x1c, 0x1,
 
     /* U+F1EB "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xc0, 0x0, 0xff, 0xfc,
-    0xf, 0xff, 0x80, 0x0, 0x7, 0xff, 0xc7, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xfb, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x7, 0xe3,
-    0xc0, 0x0, 0xff, 0xc0, 0x0, 0xf0, 0x60, 0x3,
-    0xff, 0xff, 0x0, 0x18, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xf8,
-    0x7, 0xff, 0x80, 0x0, 0x1f, 0xf0, 0x0, 0x3f,
-    0xe0, 0x0, 0x3, 0xf0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x70, 0x0, 0x0, 0x38, 0x0, 0x0, 0x8,
-    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x0,
+    0x4a, 0x3, 0x27, 0x12, 0x1d, 0x18, 0x17, 0x1e,
+    0x12, 0x22, 0xe, 0x26, 0xb, 0x28, 0x9, 0xe,
+    0xe, 0xe, 0x6, 0xd, 0x14, 0xd, 0x3, 0xb,
+    0x1a, 0xb, 0x1, 0xa, 0x1e, 0x13, 0x20, 0x9,
+    0x1, 0x6, 0x24, 0x6, 0x3, 0x4, 0xe, 0xa,
+    0xe, 0x4, 0x5, 0x2, 0xb, 0x12, 0xb, 0x2,
+    0x11, 0x16, 0x1a, 0x1a, 0x17, 0x1c, 0x14, 0x20,
+    0x12, 0xc, 0x8, 0xc, 0x12, 0x9, 0xe, 0x9,
+    0x13, 0x6, 0x12, 0x6, 0x15, 0x3, 0x16, 0x3,
+    0x17, 0x1, 0x18, 0x1, 0x87, 0x4, 0x2c, 0x8,
+    0x2a, 0x8, 0x29, 0xa, 0x28, 0xa, 0x28, 0xa,
+    0x28, 0xa, 0x29, 0x8, 0x2a, 0x8, 0x2c, 0x4,
+    0x17,
 
     /* U+F240 "" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe7, 0xff, 0xff, 0xff,
-    0xfc, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0xf0, 0x7f, 0xe7, 0xff, 0xff,
-    0xff, 0xfc, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0x7, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xc1, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xe7, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x2, 0x2c, 0x5, 0x2e, 0x3, 0x2f, 0x3, 0x2f,
+    0x3, 0x30, 0x2, 0x5, 0x25, 0x7, 0x1, 0x5,
+    0x25, 0xd, 0x2, 0x21, 0x2, 0xd, 0x2, 0x21,
+    0x2, 0xd, 0x2, 0x21, 0x2, 0xd, 0x2, 0x21,
+    0x5, 0xa, 0x2, 0x21, 0x5, 0xa, 0x2, 0x21,
+    0x5, 0xa, 0x2, 0x21, 0x5, 0xa, 0x2, 0x21,
+    0x5, 0xa, 0x2, 0x21, 0x2, 0xd, 0x2, 0x21,
+    0x2, 0xd, 0x25, 0xd, 0x25, 0xd, 0x25, 0x7,
+    0x1, 0x30, 0x2, 0x2f, 0x3, 0x2f, 0x4, 0x2e,
+    0x5, 0x2c, 0x4,
 
     /* U+F241 "" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe7, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x0, 0x3f,
-    0xfe, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xff, 0x9f,
-    0xff, 0xff, 0xf0, 0x0, 0x7f, 0xe7, 0xff, 0xff,
-    0xfc, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0xff, 0xc0, 0x1, 0xff,
-    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xe7, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x2, 0x2c, 0x5, 0x2e, 0x3, 0x2f, 0x3, 0x2f,
+    0x3, 0x30, 0x2, 0x5, 0x25, 0x7, 0x1, 0x5,
+    0x25, 0xd, 0x2, 0x19, 0xa, 0xd, 0x2, 0x19,
+    0xa, 0xd, 0x2, 0x19, 0xa, 0xd, 0x2, 0x19,
+    0xd, 0xa, 0x2, 0x19, 0xd, 0xa, 0x2, 0x19,
+    0xd, 0xa, 0x2, 0x19, 0xd, 0xa, 0x2, 0x19,
+    0xd, 0xa, 0x2, 0x19, 0xa, 0xd, 0x2, 0x19,
+    0xa, 0xd, 0x25, 0xd, 0x25, 0xd, 0x25, 0x7,
+    0x1, 0x30, 0x2, 0x2f, 0x3, 0x2f, 0x4, 0x2e,
+    0x5, 0x2c, 0x4,
 
     /* U+F242 "" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe7, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xf9, 0xff, 0xff, 0x80, 0x0, 0x3f,
-    0xfe, 0x7f, 0xff, 0xe0, 0x0, 0xf, 0xff, 0x9f,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xfe,
-    0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0x80, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0xe0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xe7, 0xff,
-    0xfe, 0x0, 0x0, 0xff, 0xf9, 0xff, 0xff, 0x80,
-    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x2, 0x2c, 0x5, 0x2e, 0x3, 0x2f, 0x3, 0x2f,
+    0x3, 0x30, 0x2, 0x5, 0x25, 0x7, 0x1, 0x5,
+    0x25, 0xd, 0x2, 0x12, 0x11, 0xd, 0x2, 0x12,
+    0x11, 0xd, 0x2, 0x12, 0x11, 0xd, 0x2, 0x12,
+    0x14, 0xa, 0x2, 0x12, 0x14, 0xa, 0x2, 0x12,
+    0x14, 0xa, 0x2, 0x12, 0x14, 0xa, 0x2, 0x12,
+    0x14, 0xa, 0x2, 0x12, 0x11, 0xd, 0x2, 0x12,
+    0x11, 0xd, 0x25, 0xd, 0x25, 0xd, 0x25, 0x7,
+    0x1, 0x30, 0x2, 0x2f, 0x3, 0x2f, 0x4, 0x2e,
+    0x5, 0x2c, 0x4,
 
     /* U+F243 "" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe7, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xfe, 0x7f, 0xe0, 0x0, 0x0, 0xf, 0xff, 0x9f,
-    0xf8, 0x0, 0x0, 0x0, 0x7f, 0xe7, 0xfe, 0x0,
-    0x0, 0x0, 0x1f, 0xf9, 0xff, 0x80, 0x0, 0x0,
-    0x7, 0xfe, 0x7f, 0xe0, 0x0, 0x0, 0x1, 0xff,
-    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xe7, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0xf9, 0xff, 0x80, 0x0,
-    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x2, 0x2c, 0x5, 0x2e, 0x3, 0x2f, 0x3, 0x2f,
+    0x3, 0x30, 0x2, 0x5, 0x25, 0x7, 0x1, 0x5,
+    0x25, 0xd, 0x2, 0xa, 0x19, 0xd, 0x2, 0xa,
+    0x19, 0xd, 0x2, 0xa, 0x19, 0xd, 0x2, 0xa,
+    0x1c, 0xa, 0x2, 0xa, 0x1c, 0xa, 0x2, 0xa,
+    0x1c, 0xa, 0x2, 0xa, 0x1c, 0xa, 0x2, 0xa,
+    0x1c, 0xa, 0x2, 0xa, 0x19, 0xd, 0x2, 0xa,
+    0x19, 0xd, 0x25, 0xd, 0x25, 0xd, 0x25, 0x7,
+    0x1, 0x30, 0x2, 0x2f, 0x3, 0x2f, 0x4, 0x2e,
+    0x5, 0x2c, 0x4,
 
     /* U+F244 "" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x2, 0x2c, 0x5, 0x2e, 0x3, 0x2f, 0x3, 0x2f,
+    0x3, 0x30, 0x2, 0x5, 0x25, 0x7, 0x1, 0x5,
+    0x25, 0xd, 0x25, 0xd, 0x25, 0xd, 0x25, 0xd,
+    0x28, 0xa, 0x28, 0xa, 0x28, 0xa, 0x28, 0xa,
+    0x28, 0xa, 0x25, 0xd, 0x25, 0xd, 0x25, 0xd,
+    0x25, 0xd, 0x25, 0x7, 0x1, 0x30, 0x2, 0x2f,
+    0x3, 0x2f, 0x4, 0x2e, 0x5, 0x2c, 0x4,
 
     /* U+F287 "" */
-    0x0, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0x83, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0xe, 0x0, 0x0, 0x0, 0x1, 0xff, 0x3, 0x80,
-    0x0, 0x0, 0xc0, 0x7f, 0xc1, 0xc0, 0x0, 0x0,
-    0x3c, 0x3f, 0xf8, 0xf0, 0x0, 0x0, 0xf, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe, 0x0,
-    0x0, 0x3f, 0x1f, 0xf0, 0x1, 0xc0, 0x0, 0xf,
-    0x3, 0xfc, 0x0, 0x70, 0x0, 0x3, 0x0, 0x7c,
-    0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x7, 0x87, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x80, 0x0,
+    0x1b, 0x4, 0x2d, 0x6, 0x2b, 0x8, 0x25, 0xd,
+    0x24, 0xe, 0x24, 0x4, 0x2, 0x8, 0x23, 0x3,
+    0x5, 0x6, 0x24, 0x3, 0x6, 0x4, 0x24, 0x3,
+    0x2f, 0x3, 0x21, 0x5, 0x8, 0x3, 0x20, 0x9,
+    0x6, 0x3, 0x17, 0x2, 0x7, 0x9, 0x5, 0x3,
+    0x18, 0x4, 0x4, 0xb, 0x3, 0x4, 0x18, 0x6,
+    0x2, 0x31, 0x1, 0x3d, 0x9, 0x3, 0x13, 0x6,
+    0x3, 0x9, 0xb, 0x3, 0x12, 0x4, 0x6, 0x8,
+    0xb, 0x3, 0x12, 0x2, 0x9, 0x5, 0xe, 0x3,
+    0x2f, 0x3, 0x30, 0x3, 0x2f, 0x3, 0x5, 0x8,
+    0x22, 0x4, 0x4, 0x8, 0x23, 0x4, 0x3, 0x8,
+    0x24, 0xe, 0x25, 0xd, 0x2a, 0x8, 0x2a, 0x8,
+    0x2a, 0x8, 0xb,
 
     /* U+F293 "" */
-    0x0, 0x1f, 0xf0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xf0, 0x1, 0xff, 0x7f, 0xe0, 0xf,
-    0xfc, 0xff, 0xc0, 0x7f, 0xf1, 0xff, 0x81, 0xff,
-    0xc7, 0xff, 0xf, 0xff, 0xf, 0xfc, 0x3f, 0xfc,
-    0x1f, 0xf1, 0xff, 0xf0, 0x3f, 0xe7, 0xff, 0xc4,
-    0x7f, 0x9f, 0xdf, 0x18, 0xfe, 0x7e, 0x3c, 0x71,
-    0xfb, 0xf8, 0x71, 0xc3, 0xff, 0xf0, 0xc6, 0x1f,
-    0xff, 0xe1, 0x10, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xc0, 0x7f, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0x84, 0x43, 0xff, 0xfc, 0x31,
-    0x87, 0xff, 0xe1, 0xc7, 0xf, 0xdf, 0xf, 0x1c,
-    0x3f, 0x7e, 0x7c, 0x61, 0xf9, 0xff, 0xf1, 0xf,
-    0xe7, 0xff, 0xc0, 0x7f, 0x8f, 0xff, 0x3, 0xfe,
-    0x3f, 0xfc, 0x1f, 0xf0, 0xff, 0xf0, 0xff, 0xc1,
-    0xff, 0xc7, 0xfe, 0x3, 0xff, 0x3f, 0xf8, 0x7,
-    0xfd, 0xff, 0xc0, 0xf, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0xf, 0xfc, 0x0,
+    0xb, 0x9, 0x12, 0xf, 0xd, 0x12, 0xb, 0x9,
+    0x1, 0xa, 0x9, 0xa, 0x2, 0xa, 0x7, 0xb,
+    0x3, 0xa, 0x6, 0xb, 0x3, 0xb, 0x4, 0xc,
+    0x4, 0xa, 0x4, 0xc, 0x5, 0x9, 0x3, 0xd,
+    0x6, 0x9, 0x2, 0xd, 0x3, 0x1, 0x3, 0x8,
+    0x2, 0x7, 0x1, 0x5, 0x3, 0x2, 0x3, 0x7,
+    0x2, 0x6, 0x3, 0x4, 0x3, 0x3, 0x3, 0x6,
+    0x1, 0x7, 0x4, 0x3, 0x3, 0x3, 0x4, 0xe,
+    0x4, 0x2, 0x3, 0x2, 0x4, 0x10, 0x4, 0x1,
+    0x3, 0x1, 0x4, 0x12, 0xb, 0x14, 0x9, 0x16,
+    0x7, 0x18, 0x5, 0x19, 0x5, 0x18, 0x7, 0x16,
+    0x9, 0x14, 0xb, 0x12, 0x4, 0x1, 0x3, 0x1,
+    0x4, 0x10, 0x4, 0x2, 0x3, 0x2, 0x4, 0xe,
+    0x4, 0x3, 0x3, 0x3, 0x4, 0x6, 0x1, 0x5,
+    0x4, 0x4, 0x3, 0x3, 0x4, 0x6, 0x1, 0x6,
+    0x2, 0x5, 0x3, 0x2, 0x4, 0x6, 0x2, 0xd,
+    0x3, 0x1, 0x4, 0x7, 0x2, 0xd, 0x7, 0x8,
+    0x3, 0xc, 0x6, 0x9, 0x3, 0xc, 0x5, 0x9,
+    0x4, 0xc, 0x4, 0xa, 0x5, 0xb, 0x3, 0xa,
+    0x7, 0xa, 0x2, 0xb, 0x8, 0x9, 0x1, 0xb,
+    0xa, 0x13, 0xd, 0xf, 0x11, 0xa, 0xa,
 
     /* U+F2ED "" */
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff,
-    0xff, 0xe1, 0xfc, 0xfd, 0xf9, 0xfc, 0x3f, 0x9f,
-    0x1f, 0x3f, 0x87, 0xf3, 0xe3, 0xe7, 0xf0, 0xfe,
-    0x7c, 0x7c, 0xfe, 0x1f, 0xcf, 0x8f, 0x9f, 0xc3,
-    0xf9, 0xf1, 0xf3, 0xf8, 0x7f, 0x3e, 0x3e, 0x7f,
-    0xf, 0xe7, 0xc7, 0xcf, 0xe1, 0xfc, 0xf8, 0xf9,
-    0xfc, 0x3f, 0x9f, 0x1f, 0x3f, 0x87, 0xf3, 0xe3,
-    0xe7, 0xf0, 0xfe, 0x7c, 0x7c, 0xfe, 0x1f, 0xcf,
-    0x8f, 0x9f, 0xc3, 0xf9, 0xf1, 0xf3, 0xf8, 0x7f,
-    0x3e, 0x3e, 0x7f, 0xf, 0xe7, 0xc7, 0xcf, 0xe1,
-    0xfc, 0xf8, 0xf9, 0xfc, 0x3f, 0x9f, 0x1f, 0x3f,
-    0x87, 0xf3, 0xe3, 0xe7, 0xf0, 0xfe, 0x7c, 0xfc,
-    0xfe, 0x1f, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xf0,
+    0xd, 0x9, 0x18, 0xd, 0x16, 0xd, 0xb, 0xaf,
+    0x48, 0x1f, 0x4, 0x1f, 0x4, 0x1f, 0x4, 0x1f,
+    0x4, 0x1f, 0x4, 0x7, 0x2, 0x6, 0x1, 0x6,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x3, 0x5,
+    0x2, 0x7, 0x4, 0x7, 0x2, 0x5, 0x2, 0x6,
+    0x2, 0x7, 0x4, 0x1f, 0x5, 0x1d, 0x6, 0x1d,
+    0x6, 0x1d, 0x7, 0x1b, 0x4,
 
     /* U+F304 "" */
-    0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0xfe, 0x0, 0x0, 0x2, 0x3f, 0xff,
-    0x0, 0x0, 0x7, 0x1f, 0xff, 0x0, 0x0, 0xf,
-    0x8f, 0xff, 0x0, 0x0, 0x1f, 0xc7, 0xfe, 0x0,
-    0x0, 0x3f, 0xe3, 0xfe, 0x0, 0x0, 0x7f, 0xf1,
-    0xfc, 0x0, 0x0, 0xff, 0xf8, 0xf8, 0x0, 0x1,
-    0xff, 0xfc, 0x70, 0x0, 0x3, 0xff, 0xfe, 0x20,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff, 0xfc,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x0,
-    0x7, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0x3, 0x23, 0x7, 0x20, 0x9, 0x1e, 0xb,
+    0x1c, 0xd, 0x1a, 0xf, 0x1a, 0xe, 0x17, 0x1,
+    0x3, 0xe, 0x15, 0x3, 0x3, 0xd, 0x14, 0x5,
+    0x3, 0xc, 0x13, 0x7, 0x3, 0xa, 0x13, 0x9,
+    0x3, 0x9, 0x12, 0xb, 0x3, 0x7, 0x12, 0xd,
+    0x3, 0x5, 0x12, 0xf, 0x3, 0x3, 0x12, 0x11,
+    0x3, 0x1, 0x12, 0x13, 0x14, 0x15, 0x12, 0x15,
+    0x12, 0x15, 0x12, 0x15, 0x12, 0x15, 0x12, 0x15,
+    0x12, 0x15, 0x12, 0x15, 0x12, 0x15, 0x12, 0x15,
+    0x12, 0x15, 0x12, 0x15, 0x13, 0x14, 0x14, 0x13,
+    0x15, 0x12, 0x16, 0x11, 0x16, 0x11, 0x17, 0x10,
+    0x18, 0xf, 0x19, 0xe, 0x1a, 0xd, 0x1b, 0xc,
+    0x1d, 0x6, 0x21,
 
     /* U+F55A "" */
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xf7, 0xfe, 0xff, 0xfc, 0xf, 0xff, 0xf8, 0xff,
-    0x1f, 0xff, 0x7, 0xff, 0xfc, 0x1f, 0x83, 0xff,
-    0xc3, 0xff, 0xfe, 0x3, 0xc0, 0x7f, 0xf1, 0xff,
-    0xff, 0xc0, 0x60, 0x3f, 0xfc, 0xff, 0xff, 0xf8,
-    0x0, 0x1f, 0xff, 0x7f, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x1f, 0xff, 0xdf, 0xff, 0xff, 0xc0, 0x3, 0xff,
-    0xf3, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xfc, 0x7f,
-    0xff, 0xf0, 0x18, 0xf, 0xff, 0xf, 0xff, 0xf8,
-    0xf, 0x1, 0xff, 0xc1, 0xff, 0xff, 0x7, 0xe0,
-    0xff, 0xf0, 0x3f, 0xff, 0xe3, 0xfc, 0x7f, 0xfc,
-    0x7, 0xff, 0xfd, 0xff, 0xbf, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x80,
+    0xe, 0x21, 0xf, 0x25, 0xc, 0x26, 0xb, 0x28,
+    0x9, 0x29, 0x8, 0x2a, 0x7, 0x11, 0x1, 0xa,
+    0x1, 0xe, 0x6, 0x11, 0x3, 0x8, 0x3, 0xd,
+    0x5, 0x11, 0x5, 0x6, 0x5, 0xc, 0x4, 0x11,
+    0x7, 0x4, 0x7, 0xb, 0x3, 0x13, 0x7, 0x2,
+    0x7, 0xc, 0x2, 0x15, 0xe, 0xd, 0x1, 0x17,
+    0xc, 0x27, 0xa, 0x29, 0x8, 0x2a, 0x8, 0x29,
+    0xa, 0xf, 0x1, 0x17, 0xc, 0xe, 0x2, 0x15,
+    0xe, 0xd, 0x3, 0x13, 0x7, 0x2, 0x7, 0xc,
+    0x4, 0x11, 0x7, 0x4, 0x7, 0xb, 0x5, 0x11,
+    0x5, 0x6, 0x5, 0xc, 0x6, 0x11, 0x3, 0x8,
+    0x3, 0xd, 0x7, 0x11, 0x1, 0xa, 0x1, 0xe,
+    0x8, 0x2a, 0x9, 0x29, 0xa, 0x28, 0xb, 0x26,
+    0xd, 0x25, 0xf, 0x21, 0x3,
 
     /* U+F7C2 "" */
-    0x0, 0x7f, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0x3,
-    0xff, 0xff, 0xfc, 0x1e, 0x38, 0x71, 0xf0, 0xf8,
-    0xe1, 0xc7, 0xc7, 0xe3, 0x87, 0x1f, 0x3f, 0x8e,
-    0x1c, 0x7d, 0xfe, 0x38, 0x71, 0xff, 0xf8, 0xe1,
-    0xc7, 0xff, 0xe3, 0x87, 0x1f, 0xff, 0x8e, 0x1c,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xff, 0x87, 0xff, 0xff, 0xf8,
+    0x9, 0x12, 0xc, 0x14, 0x9, 0x15, 0x8, 0x17,
+    0x6, 0x18, 0x5, 0x4, 0x3, 0x3, 0x4, 0x3,
+    0x3, 0x5, 0x4, 0x5, 0x3, 0x3, 0x4, 0x3,
+    0x3, 0x5, 0x3, 0x6, 0x3, 0x3, 0x4, 0x3,
+    0x3, 0x5, 0x2, 0x7, 0x3, 0x3, 0x4, 0x3,
+    0x3, 0x5, 0x1, 0x8, 0x3, 0x3, 0x4, 0x3,
+    0x3, 0xe, 0x3, 0x3, 0x4, 0x3, 0x3, 0xe,
+    0x3, 0x3, 0x4, 0x3, 0x3, 0xe, 0x3, 0x3,
+    0x4, 0x3, 0x3, 0xff, 0xff, 0xd7, 0x1, 0x1c,
+    0x2, 0x1c, 0x4, 0x18, 0x3,
 
     /* U+F8A2 "" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x0, 0x30, 0x0, 0x0, 0x3f, 0x0, 0xf8,
-    0x0, 0x0, 0x3f, 0x1, 0xf8, 0x0, 0x0, 0x3f,
-    0x3, 0xf8, 0x0, 0x0, 0x3f, 0x7, 0xf8, 0x0,
-    0x0, 0x3f, 0xf, 0xf8, 0x0, 0x0, 0x3f, 0x1f,
-    0xf8, 0x0, 0x0, 0x3f, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x30, 0x0, 0x0, 0x0
+    0x26, 0x2, 0x25, 0x3, 0x24, 0x4, 0x23, 0x5,
+    0x22, 0x6, 0xa, 0x2, 0x16, 0x6, 0x8, 0x5,
+    0x15, 0x6, 0x7, 0x6, 0x15, 0x6, 0x6, 0x7,
+    0x15, 0x6, 0x5, 0x8, 0x15, 0x6, 0x4, 0x9,
+    0x15, 0x6, 0x3, 0xa, 0x15, 0x6, 0x2, 0x26,
+    0x1, 0x77, 0x1, 0x27, 0x2, 0x26, 0x3, 0xa,
+    0x1f, 0x9, 0x20, 0x8, 0x21, 0x7, 0x22, 0x6,
+    0x23, 0x5, 0x25, 0x2, 0x1c
 };
 
 
@@ -1303,62 +825,62 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 200, .adv_w = 640, .box_w = 40, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 350, .adv_w = 640, .box_w = 40, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 525, .adv_w = 640, .box_w = 40, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 675, .adv_w = 440, .box_w = 28, .box_h = 27, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 770, .adv_w = 640, .box_w = 38, .box_h = 39, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 956, .adv_w = 640, .box_w = 38, .box_h = 40, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1146, .adv_w = 720, .box_w = 45, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1343, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 1543, .adv_w = 720, .box_w = 45, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1712, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 1912, .adv_w = 320, .box_w = 20, .box_h = 31, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1990, .adv_w = 480, .box_w = 30, .box_h = 31, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2107, .adv_w = 720, .box_w = 45, .box_h = 38, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 2321, .adv_w = 640, .box_w = 40, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2471, .adv_w = 560, .box_w = 25, .box_h = 35, .ofs_x = 5, .ofs_y = -3},
-    {.bitmap_index = 2581, .adv_w = 560, .box_w = 35, .box_h = 42, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 2765, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2919, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3073, .adv_w = 560, .box_w = 25, .box_h = 35, .ofs_x = 5, .ofs_y = -3},
-    {.bitmap_index = 3183, .adv_w = 560, .box_w = 37, .box_h = 35, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 3345, .adv_w = 400, .box_w = 21, .box_h = 34, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 3435, .adv_w = 400, .box_w = 21, .box_h = 34, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 3525, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3679, .adv_w = 560, .box_w = 35, .box_h = 7, .ofs_x = 0, .ofs_y = 11},
-    {.bitmap_index = 3710, .adv_w = 720, .box_w = 45, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3879, .adv_w = 800, .box_w = 51, .box_h = 40, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 4134, .adv_w = 720, .box_w = 47, .box_h = 40, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 4369, .adv_w = 640, .box_w = 40, .box_h = 34, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4539, .adv_w = 560, .box_w = 34, .box_h = 20, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 4624, .adv_w = 560, .box_w = 34, .box_h = 20, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 4709, .adv_w = 800, .box_w = 49, .box_h = 31, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4899, .adv_w = 640, .box_w = 40, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5049, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 5249, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 5449, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5603, .adv_w = 560, .box_w = 35, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 5778, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5932, .adv_w = 400, .box_w = 25, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 6057, .adv_w = 560, .box_w = 35, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 6232, .adv_w = 560, .box_w = 35, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 6407, .adv_w = 720, .box_w = 45, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6576, .adv_w = 640, .box_w = 41, .box_h = 41, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 6787, .adv_w = 480, .box_w = 30, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 6937, .adv_w = 800, .box_w = 50, .box_h = 37, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 7169, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 7326, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 7483, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 7640, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 7797, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 7954, .adv_w = 800, .box_w = 50, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8142, .adv_w = 560, .box_w = 30, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 8292, .adv_w = 560, .box_w = 35, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8467, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8667, .adv_w = 800, .box_w = 50, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8855, .adv_w = 480, .box_w = 30, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 9005, .adv_w = 644, .box_w = 40, .box_h = 25, .ofs_x = 0, .ofs_y = 2}
+    {.bitmap_index = 129, .adv_w = 640, .box_w = 40, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 244, .adv_w = 640, .box_w = 40, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 323, .adv_w = 640, .box_w = 40, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 402, .adv_w = 440, .box_w = 28, .box_h = 27, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 481, .adv_w = 640, .box_w = 38, .box_h = 39, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 638, .adv_w = 640, .box_w = 38, .box_h = 40, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 747, .adv_w = 720, .box_w = 45, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 902, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 991, .adv_w = 720, .box_w = 45, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1057, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 1194, .adv_w = 320, .box_w = 20, .box_h = 31, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1228, .adv_w = 480, .box_w = 30, .box_h = 31, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1301, .adv_w = 720, .box_w = 45, .box_h = 38, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 1488, .adv_w = 640, .box_w = 40, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1557, .adv_w = 560, .box_w = 25, .box_h = 35, .ofs_x = 5, .ofs_y = -3},
+    {.bitmap_index = 1618, .adv_w = 560, .box_w = 35, .box_h = 42, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 1691, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1772, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1787, .adv_w = 560, .box_w = 25, .box_h = 35, .ofs_x = 5, .ofs_y = -3},
+    {.bitmap_index = 1847, .adv_w = 560, .box_w = 37, .box_h = 35, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 1912, .adv_w = 400, .box_w = 21, .box_h = 34, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 1981, .adv_w = 400, .box_w = 21, .box_h = 34, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 2050, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2113, .adv_w = 560, .box_w = 35, .box_h = 7, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 2120, .adv_w = 720, .box_w = 45, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2249, .adv_w = 800, .box_w = 51, .box_h = 40, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 2410, .adv_w = 720, .box_w = 47, .box_h = 40, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 2531, .adv_w = 640, .box_w = 40, .box_h = 34, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2652, .adv_w = 560, .box_w = 34, .box_h = 20, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 2715, .adv_w = 560, .box_w = 34, .box_h = 20, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 2776, .adv_w = 800, .box_w = 49, .box_h = 31, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2921, .adv_w = 640, .box_w = 40, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2945, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 3032, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 3125, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3258, .adv_w = 560, .box_w = 35, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 3361, .adv_w = 560, .box_w = 35, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3424, .adv_w = 400, .box_w = 25, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 3505, .adv_w = 560, .box_w = 35, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 3628, .adv_w = 560, .box_w = 35, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 3699, .adv_w = 720, .box_w = 45, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3838, .adv_w = 640, .box_w = 41, .box_h = 41, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 3919, .adv_w = 480, .box_w = 30, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 3969, .adv_w = 800, .box_w = 50, .box_h = 37, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4066, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4141, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4216, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4291, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4366, .adv_w = 800, .box_w = 50, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4421, .adv_w = 800, .box_w = 50, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4520, .adv_w = 560, .box_w = 30, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
+    {.bitmap_index = 4687, .adv_w = 560, .box_w = 35, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 4876, .adv_w = 640, .box_w = 40, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 4975, .adv_w = 800, .box_w = 50, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5084, .adv_w = 480, .box_w = 30, .box_h = 40, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 5161, .adv_w = 644, .box_w = 40, .box_h = 25, .ofs_x = 0, .ofs_y = 2}
 };
 
 /*---------------------
@@ -1428,7 +950,7 @@ const lv_font_t fa_symbol_40 = {
 lv_font_t fa_symbol_40 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_rle_get_glyph_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 42,          /*The maximum line height required by the font*/
     .base_line = 6,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -2,9 +2,11 @@
  * Size: 120 px
  * Bpp: 1
  * Opts: --bpp 1 --size 120 --no-compress --font Industry-Black.ttf --symbols 1234567890:.° --format lvgl -o industry_120.c
+ * Post-processed with tools/font_rle.py (run-length glyph bitmaps)
  ******************************************************************************/
 
 #include "lvgl.h"
+#include "font_rle.h"
 
 #ifndef INDUSTRY_120
 #define INDUSTRY_120 1
@@ -19,899 +21,264 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+002E "." */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0xff, 0x6a,
 
     /* U+0030 "0" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0,
+    0xc, 0x26, 0x15, 0x2c, 0x11, 0x2e, 0xe, 0x32,
+    0xb, 0x34, 0x9, 0x36, 0x7, 0x38, 0x6, 0x38,
+    0x5, 0x3a, 0x3, 0x3c, 0x2, 0x3c, 0x2, 0x3c,
+    0x1, 0xff, 0xc8, 0x14, 0x29, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16,
+    0x28, 0x16, 0x29, 0x14, 0xff, 0xc8, 0x1, 0x3c,
+    0x2, 0x3c, 0x2, 0x3b, 0x4, 0x3a, 0x5, 0x38,
+    0x6, 0x38, 0x7, 0x36, 0x9, 0x34, 0xb, 0x32,
+    0xe, 0x2e, 0x11, 0x2b, 0x16, 0x25, 0xd,
 
     /* U+0031 "1" */
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x7,
-    0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xf8, 0xf, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0x13, 0x11, 0x11, 0x13, 0xf, 0x15, 0xd, 0x17,
+    0xb, 0x19, 0x9, 0x1b, 0x7, 0x1d, 0x5, 0x1f,
+    0x3, 0x21, 0x1, 0xff, 0xbf, 0x1, 0x20, 0x4,
+    0x1d, 0x7, 0x1a, 0xa, 0x17, 0xd, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10,
+    0x14,
 
     /* U+0032 "2" */
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x7f, 0xff, 0xf9, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0xfe, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x7f,
-    0xff, 0xf9, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0,
+    0xe, 0x22, 0x19, 0x28, 0x14, 0x2c, 0x11, 0x2e,
+    0xf, 0x30, 0xd, 0x32, 0xb, 0x34, 0x9, 0x36,
+    0x7, 0x38, 0x6, 0x38, 0x5, 0x3a, 0x4, 0x3a,
+    0x4, 0x3a, 0x3, 0x3c, 0x2, 0x3c, 0x2, 0x3c,
+    0x2, 0x3c, 0x2, 0x3c, 0x2, 0x3c, 0x2, 0x14,
+    0x13, 0x15, 0x2, 0x13, 0x15, 0x14, 0x2, 0x13,
+    0x15, 0x14, 0x2, 0x13, 0x15, 0x14, 0x2, 0x13,
+    0x15, 0x14, 0x2, 0x13, 0x15, 0x14, 0x2, 0x13,
+    0x15, 0x14, 0x2, 0x13, 0x15, 0x14, 0x2a, 0x14,
+    0x2a, 0x14, 0x2a, 0x14, 0x29, 0x15, 0x28, 0x16,
+    0x24, 0x1a, 0x21, 0x1d, 0x1e, 0x20, 0x1a, 0x24,
+    0x17, 0x27, 0x14, 0x29, 0x12, 0x2c, 0xf, 0x2f,
+    0xd, 0x30, 0xc, 0x31, 0xb, 0x33, 0xa, 0x33,
+    0xa, 0x33, 0xa, 0x32, 0xb, 0x32, 0xb, 0x31,
+    0xd, 0x30, 0xd, 0x2e, 0x10, 0x2b, 0x12, 0x29,
+    0x15, 0x26, 0x18, 0x23, 0x1b, 0x1f, 0x1f, 0x1c,
+    0x22, 0x19, 0x25, 0x16, 0x28, 0x14, 0x2a, 0x14,
+    0x2a, 0x14, 0x2a, 0x14, 0x2a, 0x14, 0x2a, 0x14,
+    0x2a, 0x14, 0x2a, 0x14, 0x2a, 0x14, 0x2a, 0x14,
+    0x2a, 0xff, 0xff, 0xff, 0xff, 0x9e,
 
     /* U+0033 "3" */
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
-    0xe7, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xf9,
-    0xff, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x7f,
-    0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0x9f, 0xff,
-    0xfe, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0xe, 0x21, 0x19, 0x27, 0x14, 0x2a, 0x12, 0x2d,
+    0xf, 0x2f, 0xd, 0x31, 0xb, 0x33, 0x9, 0x35,
+    0x7, 0x36, 0x7, 0x37, 0x5, 0x39, 0x4, 0x39,
+    0x4, 0x39, 0x3, 0x3b, 0x2, 0x3b, 0x2, 0x3b,
+    0x2, 0x3b, 0x2, 0x3b, 0x2, 0x3b, 0x2, 0x15,
+    0x11, 0x15, 0x2, 0x14, 0x13, 0x14, 0x2, 0x14,
+    0x13, 0x14, 0x2, 0x14, 0x13, 0x14, 0x2, 0x14,
+    0x13, 0x14, 0x2, 0x14, 0x13, 0x14, 0x2, 0x14,
+    0x13, 0x14, 0x2, 0x14, 0x13, 0x14, 0x29, 0x14,
+    0x29, 0x14, 0x29, 0x14, 0x29, 0x14, 0x29, 0x14,
+    0x29, 0x14, 0x28, 0x15, 0x17, 0x25, 0x18, 0x25,
+    0x18, 0x25, 0x18, 0x24, 0x19, 0x24, 0x19, 0x23,
+    0x1a, 0x22, 0x1b, 0x21, 0x1c, 0x1f, 0x1e, 0x1f,
+    0x1e, 0x21, 0x1c, 0x22, 0x1b, 0x23, 0x1a, 0x24,
+    0x19, 0x25, 0x18, 0x26, 0x17, 0x26, 0x17, 0x26,
+    0x28, 0x16, 0x29, 0x14, 0x29, 0x14, 0x29, 0x14,
+    0x29, 0x14, 0x29, 0x14, 0x29, 0x14, 0x29, 0x28,
+    0x15, 0x28, 0x15, 0x28, 0x15, 0x28, 0x15, 0x28,
+    0x15, 0x28, 0x15, 0x28, 0x15, 0x29, 0x13, 0xff,
+    0x84, 0x1, 0x3b, 0x2, 0x3b, 0x2, 0x3b, 0x3,
+    0x39, 0x4, 0x38, 0x6, 0x37, 0x7, 0x35, 0x9,
+    0x33, 0xb, 0x31, 0xd, 0x2f, 0xf, 0x2c, 0x13,
+    0x29, 0x17, 0x23, 0xd,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x8f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0xf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x3,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xe0, 0xf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x7f, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xfe,
-    0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x3, 0xff,
-    0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x80, 0x0,
+    0x28, 0x15, 0x34, 0x16, 0x33, 0x17, 0x32, 0x18,
+    0x32, 0x18, 0x31, 0x19, 0x30, 0x1a, 0x30, 0x1a,
+    0x2f, 0x1b, 0x2e, 0x1c, 0x2d, 0x1d, 0x2d, 0x1d,
+    0x2c, 0x1e, 0x2b, 0x1f, 0x2a, 0x20, 0x2a, 0x20,
+    0x29, 0x21, 0x28, 0x22, 0x28, 0x22, 0x27, 0x23,
+    0x26, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x26,
+    0x23, 0x27, 0x22, 0x28, 0x22, 0x14, 0x1, 0x13,
+    0x21, 0x14, 0x2, 0x13, 0x20, 0x15, 0x2, 0x13,
+    0x20, 0x14, 0x3, 0x13, 0x1f, 0x14, 0x4, 0x13,
+    0x1e, 0x14, 0x5, 0x13, 0x1d, 0x15, 0x5, 0x13,
+    0x1d, 0x14, 0x6, 0x13, 0x1c, 0x14, 0x7, 0x13,
+    0x1b, 0x15, 0x7, 0x13, 0x1a, 0x15, 0x8, 0x13,
+    0x1a, 0x14, 0x9, 0x13, 0x19, 0x14, 0xa, 0x13,
+    0x18, 0x15, 0xa, 0x13, 0x18, 0x14, 0xb, 0x13,
+    0x17, 0x14, 0xc, 0x13, 0x16, 0x15, 0xc, 0x13,
+    0x15, 0x15, 0xd, 0x13, 0x15, 0x14, 0xe, 0x13,
+    0x14, 0x14, 0xf, 0x13, 0x13, 0x15, 0xf, 0x13,
+    0x13, 0x14, 0x10, 0x13, 0x12, 0x14, 0x11, 0x13,
+    0x11, 0x15, 0x11, 0x13, 0x10, 0x15, 0x12, 0x13,
+    0x10, 0x14, 0x13, 0x13, 0xf, 0x14, 0x14, 0x13,
+    0xe, 0xff, 0xbc, 0x1, 0x49, 0x1, 0x49, 0x1,
+    0x49, 0x2, 0x48, 0x2, 0x48, 0x2, 0x48, 0x2,
+    0x48, 0x3, 0x47, 0x3, 0x47, 0x3, 0x47, 0x4,
+    0x46, 0x4, 0x46, 0x2a, 0x13, 0x37, 0x13, 0x37,
+    0x13, 0x37, 0x13, 0x37, 0x13, 0x37, 0x13, 0x37,
+    0x13, 0x37, 0x13, 0x37, 0x13, 0x37, 0x13, 0x37,
+    0x13, 0x37, 0x13, 0x37, 0x13, 0x37, 0x13, 0x37,
+    0x13, 0x37, 0x13, 0xd,
 
     /* U+0035 "5" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xfc, 0x3,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0x7f, 0xff,
-    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x3f, 0xff, 0xfc, 0x0, 0x1f,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x1f,
-    0xff, 0xfe, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x3f,
-    0xff, 0xfc, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x1, 0x3b, 0x4, 0x3b, 0x4, 0x3b, 0x4, 0x3b,
+    0x4, 0x3b, 0x4, 0x3b, 0x4, 0x3b, 0x4, 0x3b,
+    0x4, 0x3b, 0x4, 0x3b, 0x4, 0x3b, 0x4, 0x3b,
+    0x4, 0x3b, 0x4, 0x3b, 0x4, 0x3b, 0x4, 0x3b,
+    0x4, 0x3b, 0x4, 0x3b, 0x4, 0x3b, 0x4, 0x14,
+    0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14,
+    0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14,
+    0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14, 0xb, 0x11,
+    0xf, 0x14, 0x8, 0x17, 0xc, 0x14, 0x7, 0x1a,
+    0xa, 0x14, 0x5, 0x1e, 0x8, 0x14, 0x4, 0x20,
+    0x7, 0x14, 0x2, 0x23, 0x6, 0x14, 0x1, 0x25,
+    0x5, 0x14, 0x1, 0x26, 0x4, 0x3b, 0x4, 0x3c,
+    0x3, 0x3c, 0x3, 0x3d, 0x2, 0x3d, 0x2, 0x3e,
+    0x1, 0x3e, 0x2, 0x3d, 0x6, 0x39, 0x9, 0x14,
+    0xd, 0x15, 0xd, 0xd, 0x11, 0x14, 0x10, 0x8,
+    0x13, 0x14, 0x14, 0x2, 0x15, 0x14, 0x2b, 0x14,
+    0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14,
+    0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x28,
+    0x17, 0x28, 0x17, 0x28, 0x17, 0x28, 0x17, 0x28,
+    0x17, 0x28, 0x17, 0x28, 0x17, 0x29, 0x15, 0xff,
+    0x90, 0x1, 0x3d, 0x2, 0x3d, 0x2, 0x3d, 0x3,
+    0x3b, 0x5, 0x3a, 0x5, 0x39, 0x7, 0x37, 0x9,
+    0x35, 0xb, 0x33, 0xd, 0x31, 0x10, 0x2d, 0x13,
+    0x2b, 0x17, 0x25, 0xd,
 
     /* U+0036 "6" */
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xdf, 0xff, 0xfe,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xbf, 0xff, 0xfc,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xff, 0xfe, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xfd, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0, 0x7f,
-    0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xf8, 0x1f, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x7f, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0xd, 0x24, 0x18, 0x2a, 0x13, 0x2e, 0x10, 0x30,
+    0xe, 0x32, 0xc, 0x34, 0xa, 0x36, 0x8, 0x38,
+    0x6, 0x3a, 0x5, 0x3a, 0x4, 0x3c, 0x3, 0x3c,
+    0x3, 0x3c, 0x2, 0x3e, 0x1, 0x3e, 0x1, 0x3e,
+    0x1, 0x3e, 0x1, 0x3e, 0x1, 0x3e, 0x1, 0x15,
+    0x14, 0x15, 0x1, 0x14, 0x16, 0x14, 0x1, 0x14,
+    0x16, 0x14, 0x1, 0x14, 0x16, 0x14, 0x1, 0x14,
+    0x16, 0x14, 0x1, 0x14, 0x16, 0x14, 0x1, 0x14,
+    0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14,
+    0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14, 0xb, 0x13,
+    0xd, 0x14, 0x9, 0x17, 0xb, 0x14, 0x7, 0x1b,
+    0x9, 0x14, 0x5, 0x1f, 0x7, 0x14, 0x4, 0x21,
+    0x6, 0x14, 0x3, 0x23, 0x5, 0x14, 0x2, 0x25,
+    0x4, 0x14, 0x1, 0x27, 0x3, 0x3c, 0x3, 0x3d,
+    0x2, 0x3e, 0x1, 0x3e, 0x1, 0x3e, 0x1, 0xff,
+    0x58, 0xe, 0x2d, 0x13, 0x2a, 0x15, 0x28, 0x17,
+    0x28, 0x17, 0x28, 0x17, 0x28, 0x17, 0x28, 0x17,
+    0x28, 0x17, 0x28, 0x17, 0x28, 0x17, 0x28, 0x17,
+    0x28, 0x17, 0x28, 0x17, 0x28, 0x17, 0x28, 0x17,
+    0x28, 0x17, 0x29, 0x15, 0xff, 0x90, 0x1, 0x3d,
+    0x2, 0x3d, 0x2, 0x3d, 0x3, 0x3b, 0x4, 0x3a,
+    0x6, 0x39, 0x7, 0x37, 0x9, 0x35, 0xb, 0x33,
+    0xd, 0x31, 0xf, 0x2e, 0x13, 0x2b, 0x17, 0x25,
+    0xd,
 
     /* U+0037 "7" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0x71, 0x1, 0x3d,
+    0x29, 0x16, 0x28, 0x16, 0x29, 0x16, 0x28, 0x16,
+    0x28, 0x17, 0x28, 0x16, 0x28, 0x16, 0x29, 0x16,
+    0x28, 0x16, 0x28, 0x17, 0x28, 0x16, 0x28, 0x17,
+    0x28, 0x16, 0x28, 0x16, 0x29, 0x16, 0x28, 0x16,
+    0x28, 0x17, 0x28, 0x16, 0x28, 0x16, 0x29, 0x16,
+    0x28, 0x16, 0x29, 0x16, 0x28, 0x16, 0x28, 0x17,
+    0x28, 0x16, 0x28, 0x16, 0x29, 0x16, 0x28, 0x16,
+    0x29, 0x16, 0x28, 0x16, 0x28, 0x17, 0x28, 0x16,
+    0x28, 0x16, 0x29, 0x16, 0x28, 0x16, 0x29, 0x16,
+    0x28, 0x16, 0x28, 0x17, 0x28, 0x16, 0x28, 0x16,
+    0x29, 0x16, 0x28, 0x16, 0x29, 0x16, 0x28, 0x16,
+    0x28, 0x17, 0x28, 0x16, 0x28, 0x16, 0x29, 0x16,
+    0x28, 0x16, 0x28, 0x17, 0x28, 0x16, 0x28, 0x17,
+    0x28, 0x16, 0x28, 0x16, 0x29, 0x16, 0x28, 0x16,
+    0x28, 0x17, 0x28, 0x16, 0x28, 0x17, 0x28, 0x16,
+    0x28, 0x16, 0x29, 0x16, 0x28, 0x16, 0x28, 0x17,
+    0x28, 0x16, 0x28, 0x17, 0x28, 0x16, 0x28, 0x16,
+    0x29,
 
     /* U+0038 "8" */
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0xf9, 0xff, 0xff, 0xe0, 0x0, 0x1,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0x80, 0x0, 0x7,
-    0xff, 0xff, 0x9f, 0xff, 0xfe, 0x0, 0x0, 0x1f,
-    0xff, 0xfe, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x7f,
-    0xff, 0xf9, 0xff, 0xff, 0xe0, 0x0, 0x1, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0x80, 0x0, 0x7, 0xff,
-    0xff, 0x9f, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff,
-    0xfe, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xf9, 0xff, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff,
-    0xe7, 0xff, 0xff, 0x80, 0x0, 0x7, 0xff, 0xff,
-    0x9f, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0xfe,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xf9,
-    0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0xe3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0,
+    0xe, 0x22, 0x19, 0x28, 0x14, 0x2c, 0x11, 0x2e,
+    0xf, 0x30, 0xd, 0x32, 0xb, 0x34, 0x9, 0x36,
+    0x7, 0x37, 0x7, 0x38, 0x5, 0x3a, 0x4, 0x3a,
+    0x4, 0x3a, 0x3, 0x3c, 0x2, 0x3c, 0x2, 0x3c,
+    0x2, 0x3c, 0x2, 0x3c, 0x2, 0x3c, 0x2, 0x15,
+    0x12, 0x15, 0x2, 0x14, 0x14, 0x14, 0x2, 0x14,
+    0x14, 0x14, 0x2, 0x14, 0x14, 0x14, 0x2, 0x14,
+    0x14, 0x14, 0x2, 0x14, 0x14, 0x14, 0x2, 0x14,
+    0x14, 0x14, 0x2, 0x14, 0x14, 0x14, 0x2, 0x14,
+    0x14, 0x14, 0x2, 0x14, 0x14, 0x14, 0x2, 0x14,
+    0x14, 0x14, 0x2, 0x14, 0x14, 0x14, 0x2, 0x14,
+    0x14, 0x14, 0x2, 0x14, 0x14, 0x14, 0x2, 0x15,
+    0x12, 0x15, 0x3, 0x3a, 0x4, 0x3a, 0x4, 0x3a,
+    0x5, 0x38, 0x7, 0x36, 0x8, 0x36, 0x9, 0x34,
+    0xb, 0x32, 0xe, 0x2e, 0xf, 0x30, 0xd, 0x32,
+    0xa, 0x35, 0x8, 0x38, 0x6, 0x38, 0x5, 0x3a,
+    0x3, 0x3c, 0x2, 0x3c, 0x2, 0x3c, 0x1, 0x16,
+    0x12, 0x2a, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28,
+    0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28,
+    0x16, 0x28, 0x16, 0x28, 0x16, 0x28, 0x16, 0x28,
+    0x16, 0x28, 0x16, 0x28, 0x16, 0x29, 0x14, 0xff,
+    0x8a, 0x1, 0x3c, 0x2, 0x3c, 0x2, 0x3c, 0x3,
+    0x3a, 0x4, 0x3a, 0x5, 0x38, 0x7, 0x36, 0x9,
+    0x34, 0xb, 0x32, 0xd, 0x30, 0xf, 0x2e, 0x12,
+    0x2a, 0x17, 0x24, 0xd,
 
     /* U+0039 "9" */
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0x7, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0x80, 0xff,
-    0xff, 0xf0, 0x3, 0xff, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xe0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xdf, 0xff, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xbf, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xfe,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xfd,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff, 0xfb,
-    0xff, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0xd, 0x25, 0x17, 0x2b, 0x12, 0x2f, 0xf, 0x31,
+    0xd, 0x33, 0xb, 0x35, 0x9, 0x37, 0x7, 0x39,
+    0x5, 0x3b, 0x4, 0x3b, 0x3, 0x3d, 0x2, 0x3d,
+    0x2, 0x3d, 0x1, 0xff, 0x90, 0x15, 0x29, 0x17,
+    0x28, 0x17, 0x28, 0x17, 0x28, 0x17, 0x28, 0x17,
+    0x28, 0x17, 0x28, 0x17, 0x28, 0x17, 0x28, 0x17,
+    0x28, 0x17, 0x28, 0x17, 0x28, 0x17, 0x28, 0x17,
+    0x28, 0x17, 0x28, 0x15, 0x2a, 0x13, 0x2d, 0xe,
+    0xff, 0x19, 0x1, 0x3e, 0x1, 0x3e, 0x1, 0x3e,
+    0x2, 0x3d, 0x2, 0x3d, 0x3, 0x27, 0x1, 0x14,
+    0x4, 0x26, 0x1, 0x14, 0x5, 0x24, 0x2, 0x14,
+    0x6, 0x21, 0x4, 0x14, 0x7, 0x1f, 0x5, 0x14,
+    0x8, 0x1c, 0x7, 0x14, 0xa, 0x19, 0x8, 0x14,
+    0xd, 0x13, 0xb, 0x14, 0x2b, 0x14, 0x2b, 0x14,
+    0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14, 0x2b, 0x14,
+    0x2b, 0x14, 0x1, 0x14, 0x16, 0x14, 0x1, 0x14,
+    0x16, 0x14, 0x1, 0x14, 0x16, 0x14, 0x1, 0x14,
+    0x16, 0x14, 0x1, 0x14, 0x16, 0x14, 0x1, 0x14,
+    0x16, 0x14, 0x1, 0x15, 0x14, 0x15, 0x1, 0x3e,
+    0x1, 0x3e, 0x1, 0x3e, 0x1, 0x3e, 0x1, 0x3e,
+    0x1, 0x3e, 0x2, 0x3c, 0x3, 0x3c, 0x3, 0x3c,
+    0x4, 0x3a, 0x5, 0x3a, 0x6, 0x38, 0x8, 0x36,
+    0xa, 0x34, 0xc, 0x32, 0xe, 0x30, 0x10, 0x2d,
+    0x14, 0x2a, 0x18, 0x24, 0xd,
 
     /* U+003A ":" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0,
+    0x0, 0xff, 0x6a, 0xff, 0xff, 0x3, 0xff, 0x6a,
 
     /* U+00B0 "°" */
-    0xf, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf0, 0x3, 0xff, 0xfc, 0x0, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xc0, 0xf, 0xff, 0xf0, 0x3,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xc0, 0xf, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc, 0xf, 0xff,
-    0xfc, 0x0
+    0x4, 0x12, 0x6, 0x16, 0x3, 0x18, 0x2, 0x18,
+    0x1, 0x3c, 0xa, 0x10, 0xa, 0x10, 0xa, 0x10,
+    0xa, 0x10, 0xa, 0x10, 0xa, 0x10, 0xa, 0x10,
+    0xa, 0x10, 0xa, 0x10, 0xa, 0x10, 0xa, 0x10,
+    0xa, 0x10, 0xa, 0x3c, 0x1, 0x18, 0x2, 0x18,
+    0x3, 0x16, 0x6, 0x12, 0x4
 };
 
 
@@ -922,18 +289,18 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 497, .box_w = 19, .box_h = 19, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 46, .adv_w = 1212, .box_w = 62, .box_h = 87, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 721, .adv_w = 828, .box_w = 36, .box_h = 87, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 1113, .adv_w = 1165, .box_w = 62, .box_h = 87, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 1788, .adv_w = 1167, .box_w = 61, .box_h = 87, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 2452, .adv_w = 1260, .box_w = 74, .box_h = 87, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3257, .adv_w = 1235, .box_w = 63, .box_h = 87, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 3943, .adv_w = 1215, .box_w = 63, .box_h = 87, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 4629, .adv_w = 1131, .box_w = 63, .box_h = 87, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 5315, .adv_w = 1185, .box_w = 62, .box_h = 87, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 5990, .adv_w = 1215, .box_w = 63, .box_h = 87, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 6676, .adv_w = 497, .box_w = 19, .box_h = 65, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 6831, .adv_w = 612, .box_w = 26, .box_h = 25, .ofs_x = 6, .ofs_y = 61}
+    {.bitmap_index = 3, .adv_w = 1212, .box_w = 62, .box_h = 87, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 154, .adv_w = 828, .box_w = 36, .box_h = 87, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 307, .adv_w = 1165, .box_w = 62, .box_h = 87, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 465, .adv_w = 1167, .box_w = 61, .box_h = 87, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 645, .adv_w = 1260, .box_w = 74, .box_h = 87, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 865, .adv_w = 1235, .box_w = 63, .box_h = 87, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 1053, .adv_w = 1215, .box_w = 63, .box_h = 87, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 1238, .adv_w = 1131, .box_w = 63, .box_h = 87, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 1383, .adv_w = 1185, .box_w = 62, .box_h = 87, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 1579, .adv_w = 1215, .box_w = 63, .box_h = 87, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 1768, .adv_w = 497, .box_w = 19, .box_h = 65, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 1776, .adv_w = 612, .box_w = 26, .box_h = 25, .ofs_x = 6, .ofs_y = 61}
 };
 
 /*---------------------
@@ -1038,7 +405,7 @@ const lv_font_t industry_120 = {
 lv_font_t industry_120 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_rle_get_glyph_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 87,          /*The maximum line height required by the font*/
     .base_line = 0,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
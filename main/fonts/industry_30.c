@@ -2,9 +2,11 @@
  * Size: 30 px
  * Bpp: 1
  * Opts: --bpp 1 --size 30 --no-compress --font Industry-Black.ttf --symbols °CF --format lvgl -o industry_30.c
+ * Post-processed with tools/font_rle.py (run-length glyph bitmaps)
  ******************************************************************************/
 
 #include "lvgl.h"
+#include "font_rle.h"
 
 #ifndef INDUSTRY_30
 #define INDUSTRY_30 1
@@ -19,22 +21,22 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0043 "C" */
-    0x3f, 0xfc, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f,
-    0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0,
-    0xf8, 0x0, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f,
-    0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe,
-    0x3f, 0xfc,
+    0x2, 0xc, 0x3, 0xe, 0x1, 0x25, 0x6, 0xa,
+    0x6, 0xa, 0x6, 0xa, 0x6, 0xa, 0xb, 0x5,
+    0xb, 0x5, 0xb, 0x5, 0xb, 0x5, 0xb, 0x5,
+    0x6, 0xa, 0x6, 0xa, 0x6, 0xa, 0x6, 0x25,
+    0x1, 0xe, 0x3, 0xc, 0x2,
 
     /* U+0046 "F" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x1f, 0x0, 0x3e, 0x0, 0x7c, 0x0, 0xff,
-    0xf9, 0xff, 0xf3, 0xff, 0xe7, 0xff, 0xcf, 0x80,
-    0x1f, 0x0, 0x3e, 0x0, 0x7c, 0x0, 0xf8, 0x1,
-    0xf0, 0x3, 0xe0, 0x7, 0xc0, 0xf, 0x80, 0x0,
+    0x0, 0x41, 0xa, 0x5, 0xa, 0x5, 0xa, 0x5,
+    0xa, 0xd, 0x2, 0xd, 0x2, 0xd, 0x2, 0xd,
+    0x2, 0x5, 0xa, 0x5, 0xa, 0x5, 0xa, 0x5,
+    0xa, 0x5, 0xa, 0x5, 0xa, 0x5, 0xa, 0x5,
+    0xa, 0x5, 0xa,
 
     /* U+00B0 "°" */
-    0xff, 0x3c, 0xf3, 0xcf, 0xf0
+    0x0, 0x8, 0x2, 0x4, 0x2, 0x4, 0x2, 0x4,
+    0x2, 0x8
 };
 
 
@@ -45,8 +47,8 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 298, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 42, .adv_w = 279, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 82, .adv_w = 153, .box_w = 6, .box_h = 6, .ofs_x = 2, .ofs_y = 15}
+    {.bitmap_index = 37, .adv_w = 279, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 72, .adv_w = 153, .box_w = 6, .box_h = 6, .ofs_x = 2, .ofs_y = 15}
 };
 
 /*---------------------
@@ -134,7 +136,7 @@ const lv_font_t industry_30 = {
 lv_font_t industry_30 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_rle_get_glyph_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 21,          /*The maximum line height required by the font*/
     .base_line = 0,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
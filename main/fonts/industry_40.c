@@ -2,9 +2,11 @@
  * Size: 40 px
  * Bpp: 1
  * Opts: --bpp 1 --size 40 --no-compress --font Industry-Black.ttf --symbols °CF --format lvgl -o industry_40.c
+ * Post-processed with tools/font_rle.py (run-length glyph bitmaps)
  ******************************************************************************/
 
 #include "lvgl.h"
+#include "font_rle.h"
 
 #ifndef INDUSTRY_40
 #define INDUSTRY_40 1
@@ -19,31 +21,26 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0043 "C" */
-    0x1f, 0xff, 0x83, 0xff, 0xfc, 0x7f, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3, 0xff, 0xc0, 0x3f, 0xfc, 0x3, 0xff, 0xc0,
-    0x3f, 0xfc, 0x3, 0xff, 0xc0, 0x0, 0xfc, 0x0,
-    0xf, 0xc0, 0x0, 0xfc, 0x0, 0xf, 0xc0, 0x0,
-    0xfc, 0x0, 0xf, 0xc0, 0x0, 0xfc, 0x3, 0xff,
-    0xc0, 0x3f, 0xfc, 0x3, 0xff, 0xc0, 0x3f, 0xfc,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xe3, 0xff, 0xfc, 0x1f, 0xff,
-    0x80,
+    0x3, 0xe, 0x5, 0x10, 0x3, 0x12, 0x1, 0x42,
+    0x8, 0xc, 0x8, 0xc, 0x8, 0xc, 0x8, 0xc,
+    0x8, 0xc, 0xe, 0x6, 0xe, 0x6, 0xe, 0x6,
+    0xe, 0x6, 0xe, 0x6, 0xe, 0x6, 0xe, 0x6,
+    0x8, 0xc, 0x8, 0xc, 0x8, 0xc, 0x8, 0xc,
+    0x8, 0x42, 0x1, 0x12, 0x3, 0x10, 0x5, 0xe,
+    0x3,
 
     /* U+0046 "F" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7, 0xe0, 0x0, 0xfc, 0x0, 0x1f, 0x80, 0x3,
-    0xf0, 0x0, 0x7f, 0xff, 0xcf, 0xff, 0xf9, 0xff,
-    0xff, 0x3f, 0xff, 0xe7, 0xff, 0xfc, 0xff, 0xff,
-    0x9f, 0x80, 0x3, 0xf0, 0x0, 0x7e, 0x0, 0xf,
-    0xc0, 0x1, 0xf8, 0x0, 0x3f, 0x0, 0x7, 0xe0,
-    0x0, 0xfc, 0x0, 0x1f, 0x80, 0x3, 0xf0, 0x0,
-    0x7e, 0x0, 0xf, 0xc0, 0x0,
+    0x0, 0x78, 0xd, 0x6, 0xd, 0x6, 0xd, 0x6,
+    0xd, 0x6, 0xd, 0x11, 0x2, 0x11, 0x2, 0x11,
+    0x2, 0x11, 0x2, 0x11, 0x2, 0x11, 0x2, 0x6,
+    0xd, 0x6, 0xd, 0x6, 0xd, 0x6, 0xd, 0x6,
+    0xd, 0x6, 0xd, 0x6, 0xd, 0x6, 0xd, 0x6,
+    0xd, 0x6, 0xd, 0x6, 0xd, 0x6, 0xd,
 
     /* U+00B0 "°" */
-    0x7f, 0x7f, 0xf8, 0xfc, 0x7e, 0x3f, 0x1f, 0x8f,
-    0xff, 0x7f, 0x0
+    0x1, 0x7, 0x1, 0xc, 0x3, 0x6, 0x3, 0x6,
+    0x3, 0x6, 0x3, 0x6, 0x3, 0xc, 0x1, 0x7,
+    0x1
 };
 
 
@@ -54,8 +51,8 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 397, .box_w = 20, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 73, .adv_w = 372, .box_w = 19, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 142, .adv_w = 204, .box_w = 9, .box_h = 9, .ofs_x = 2, .ofs_y = 21}
+    {.bitmap_index = 49, .adv_w = 372, .box_w = 19, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 96, .adv_w = 204, .box_w = 9, .box_h = 9, .ofs_x = 2, .ofs_y = 21}
 };
 
 /*---------------------
@@ -143,7 +140,7 @@ const lv_font_t industry_40 = {
 lv_font_t industry_40 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_rle_get_glyph_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 30,          /*The maximum line height required by the font*/
     .base_line = 0,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -2,9 +2,11 @@
  * Size: 50 px
  * Bpp: 1
  * Opts: --bpp 1 --size 50 --no-compress --font Industry-Black.ttf --symbols °CF --format lvgl -o industry_50.c
+ * Post-processed with tools/font_rle.py (run-length glyph bitmaps)
  ******************************************************************************/
 
 #include "lvgl.h"
+#include "font_rle.h"
 
 #ifndef INDUSTRY_50
 #define INDUSTRY_50 1
@@ -19,41 +21,29 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0043 "C" */
-    0xf, 0xff, 0xfc, 0x7, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf0, 0x3, 0xff, 0xfc, 0x0, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xc0, 0x0, 0xf, 0xf0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0xff, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0xf, 0xf0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0xf,
-    0xf0, 0x0, 0x3, 0xfc, 0x0, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xc0, 0xf, 0xff, 0xf0, 0x3, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xe0, 0x3f, 0xff, 0xf0,
+    0x4, 0x12, 0x7, 0x14, 0x5, 0x16, 0x3, 0x18,
+    0x1, 0x70, 0xa, 0x10, 0xa, 0x10, 0xa, 0x10,
+    0xa, 0x10, 0xa, 0x10, 0x12, 0x8, 0x12, 0x8,
+    0x12, 0x8, 0x12, 0x8, 0x12, 0x8, 0x12, 0x8,
+    0x12, 0x8, 0x12, 0x8, 0x12, 0x8, 0x12, 0x8,
+    0xa, 0x10, 0xa, 0x10, 0xa, 0x10, 0xa, 0x10,
+    0xa, 0x70, 0x1, 0x18, 0x2, 0x17, 0x5, 0x14,
+    0x7, 0x12, 0x4,
 
     /* U+0046 "F" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0xff, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xf8, 0xff, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0xff, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0xff, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0xff, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0xff, 0x0, 0x0,
+    0x0, 0xc8, 0x10, 0x8, 0x10, 0x8, 0x10, 0x8,
+    0x10, 0x8, 0x10, 0x8, 0x10, 0x15, 0x3, 0x15,
+    0x3, 0x15, 0x3, 0x15, 0x3, 0x15, 0x3, 0x15,
+    0x3, 0x15, 0x3, 0x15, 0x3, 0x8, 0x10, 0x8,
+    0x10, 0x8, 0x10, 0x8, 0x10, 0x8, 0x10, 0x8,
+    0x10, 0x8, 0x10, 0x8, 0x10, 0x8, 0x10, 0x8,
+    0x10, 0x8, 0x10, 0x8, 0x10, 0x8, 0x10, 0x8,
+    0x10,
 
     /* U+00B0 "°" */
-    0x7f, 0xdf, 0xff, 0x83, 0xf0, 0x7e, 0xf, 0xc1,
-    0xf8, 0x3f, 0x7, 0xff, 0xef, 0xf8
+    0x1, 0x9, 0x1, 0xe, 0x5, 0x6, 0x5, 0x6,
+    0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0xe,
+    0x1, 0x9, 0x1
 };
 
 
@@ -64,8 +54,8 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 496, .box_w = 26, .box_h = 36, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 117, .adv_w = 465, .box_w = 24, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 225, .adv_w = 255, .box_w = 11, .box_h = 10, .ofs_x = 3, .ofs_y = 25}
+    {.bitmap_index = 59, .adv_w = 465, .box_w = 24, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 116, .adv_w = 255, .box_w = 11, .box_h = 10, .ofs_x = 3, .ofs_y = 25}
 };
 
 /*---------------------
@@ -153,7 +143,7 @@ const lv_font_t industry_50 = {
 lv_font_t industry_50 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_rle_get_glyph_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 36,          /*The maximum line height required by the font*/
     .base_line = 0,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -2,9 +2,11 @@
  * Size: 60 px
  * Bpp: 1
  * Opts: --bpp 1 --size 60 --no-compress --font Industry-Black.ttf --symbols 1234567890:.° --format lvgl -o industry_60.c
+ * Post-processed with tools/font_rle.py (run-length glyph bitmaps)
  ******************************************************************************/
 
 #include "lvgl.h"
+#include "font_rle.h"
 
 #ifndef INDUSTRY_60
 #define INDUSTRY_60 1
@@ -19,256 +21,147 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+002E "." */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x64,
 
     /* U+0030 "0" */
-    0x7, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xe7,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xc0, 0x3f,
-    0xff, 0xfe, 0x0,
+    0x5, 0x15, 0x8, 0x19, 0x5, 0x1b, 0x3, 0x1d,
+    0x2, 0x1d, 0x1, 0x86, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x86,
+    0x1, 0x1d, 0x2, 0x1c, 0x4, 0x1b, 0x5, 0x19,
+    0x8, 0x15, 0x5,
 
     /* U+0031 "1" */
-    0x0, 0x7f, 0xc0, 0x7f, 0xf0, 0x7f, 0xfc, 0x7f,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xe0, 0xff, 0xc0, 0x3f, 0xf0,
-    0xf, 0xfc, 0x3, 0xff, 0x0, 0xff, 0xc0, 0x3f,
-    0xf0, 0xf, 0xfc, 0x3, 0xff, 0x0, 0xff, 0xc0,
-    0x3f, 0xf0, 0xf, 0xfc, 0x3, 0xff, 0x0, 0xff,
-    0xc0, 0x3f, 0xf0, 0xf, 0xfc, 0x3, 0xff, 0x0,
-    0xff, 0xc0, 0x3f, 0xf0, 0xf, 0xfc, 0x3, 0xff,
-    0x0, 0xff, 0xc0, 0x3f, 0xf0, 0xf, 0xfc, 0x3,
-    0xff, 0x0, 0xff, 0xc0, 0x3f, 0xf0, 0xf, 0xfc,
-    0x3, 0xff, 0x0, 0xff, 0xc0, 0x3f, 0xf0, 0xf,
-    0xfc, 0x3, 0xff,
+    0x9, 0x9, 0x7, 0xb, 0x5, 0xd, 0x3, 0xf,
+    0x1, 0x83, 0x2, 0xd, 0x5, 0xa, 0x8, 0xa,
+    0x8, 0xa, 0x8, 0xa, 0x8, 0xa, 0x8, 0xa,
+    0x8, 0xa, 0x8, 0xa, 0x8, 0xa, 0x8, 0xa,
+    0x8, 0xa, 0x8, 0xa, 0x8, 0xa, 0x8, 0xa,
+    0x8, 0xa, 0x8, 0xa, 0x8, 0xa, 0x8, 0xa,
+    0x8, 0xa, 0x8, 0xa, 0x8, 0xa, 0x8, 0xa,
+    0x8, 0xa, 0x8, 0xa, 0x8, 0xa, 0x8, 0xa,
+    0x8, 0xa, 0x8, 0xa, 0x8, 0xa, 0x8, 0xa,
+    0x8, 0xa, 0x8, 0xa,
 
     /* U+0032 "2" */
-    0x3, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xc0,
-    0x7f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfc,
-    0x0, 0x7f, 0xe0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xe0,
-    0x7, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xc0, 0x0,
-    0x1f, 0xfc, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0x7f, 0xe0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0x80, 0x0, 0x3, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0,
+    0x6, 0x13, 0xa, 0x17, 0x7, 0x19, 0x5, 0x1b,
+    0x3, 0x1d, 0x2, 0x1d, 0x1, 0x67, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0xa, 0x15, 0xa,
+    0x15, 0xa, 0x13, 0xc, 0x10, 0xf, 0xd, 0x12,
+    0xa, 0x15, 0x7, 0x18, 0x5, 0x19, 0x4, 0x1b,
+    0x3, 0x1b, 0x3, 0x1b, 0x4, 0x19, 0x5, 0x18,
+    0x7, 0x15, 0xa, 0x12, 0xd, 0xe, 0x11, 0xb,
+    0x14, 0xa, 0x15, 0xa, 0x15, 0xa, 0x15, 0xa,
+    0x15, 0xa, 0x15, 0xff, 0x18,
 
     /* U+0033 "3" */
-    0x1, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x3f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0xfc, 0xff, 0xc0, 0x1f, 0xf9, 0xff,
-    0x80, 0x3f, 0xf3, 0xff, 0x0, 0x7f, 0xe7, 0xfe,
-    0x0, 0xff, 0xc0, 0x0, 0x1, 0xff, 0x80, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0xf, 0xfc, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x7f,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xc0, 0x1, 0xff,
-    0xff, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x7f,
-    0xe0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xfc, 0x0,
+    0x7, 0x11, 0xc, 0x15, 0x9, 0x17, 0x7, 0x19,
+    0x5, 0x1b, 0x4, 0x1b, 0x3, 0x1d, 0x2, 0x1d,
+    0x2, 0x1d, 0x2, 0xa, 0x9, 0xa, 0x2, 0xa,
+    0x9, 0xa, 0x2, 0xa, 0x9, 0xa, 0x2, 0xa,
+    0x9, 0xa, 0x15, 0xa, 0x15, 0xa, 0x15, 0xa,
+    0x15, 0xa, 0xc, 0x13, 0xc, 0x12, 0xd, 0x12,
+    0xd, 0x11, 0xe, 0x10, 0xf, 0x11, 0xe, 0x12,
+    0xd, 0x13, 0xc, 0x14, 0x14, 0xb, 0x15, 0xa,
+    0x15, 0xa, 0x15, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x67, 0x1, 0x1d,
+    0x2, 0x1d, 0x3, 0x1b, 0x5, 0x19, 0x7, 0x17,
+    0xa, 0x13, 0x6,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
-    0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x7, 0xff, 0xf8,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x3,
-    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xfc, 0x0,
-    0x1, 0xff, 0xff, 0xe0, 0x0, 0x1f, 0xfb, 0xff,
-    0x0, 0x0, 0xff, 0xdf, 0xf8, 0x0, 0xf, 0xfc,
-    0xff, 0xc0, 0x0, 0xff, 0xc7, 0xfe, 0x0, 0xf,
-    0xfe, 0x3f, 0xf0, 0x0, 0x7f, 0xe1, 0xff, 0x80,
-    0x7, 0xfe, 0xf, 0xfc, 0x0, 0x7f, 0xf0, 0x7f,
-    0xe0, 0x3, 0xff, 0x3, 0xff, 0x0, 0x3f, 0xf0,
-    0x1f, 0xf8, 0x3, 0xff, 0x0, 0xff, 0xc0, 0x3f,
-    0xf8, 0x7, 0xfe, 0x1, 0xff, 0x80, 0x3f, 0xf0,
-    0x1f, 0xf8, 0x1, 0xff, 0x81, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xfc, 0x0,
+    0x14, 0xb, 0x19, 0xc, 0x18, 0xd, 0x17, 0xe,
+    0x17, 0xe, 0x16, 0xf, 0x15, 0x10, 0x15, 0x10,
+    0x14, 0x11, 0x13, 0x12, 0x12, 0x13, 0x12, 0x13,
+    0x11, 0x14, 0x10, 0xa, 0x1, 0xa, 0x10, 0xa,
+    0x1, 0xa, 0xf, 0xa, 0x2, 0xa, 0xe, 0xa,
+    0x3, 0xa, 0xd, 0xb, 0x3, 0xa, 0xd, 0xa,
+    0x4, 0xa, 0xc, 0xa, 0x5, 0xa, 0xb, 0xb,
+    0x5, 0xa, 0xb, 0xa, 0x6, 0xa, 0xa, 0xa,
+    0x7, 0xa, 0x9, 0xa, 0x8, 0xa, 0x8, 0xb,
+    0x8, 0xa, 0x8, 0xa, 0x9, 0xa, 0x7, 0xa,
+    0xa, 0xa, 0x6, 0x94, 0x1, 0x24, 0x1, 0x24,
+    0x1, 0x24, 0x2, 0x23, 0x2, 0x23, 0x15, 0xa,
+    0x1b, 0xa, 0x1b, 0xa, 0x1b, 0xa, 0x1b, 0xa,
+    0x1b, 0xa, 0x1b, 0xa, 0x1b, 0xa, 0x6,
 
     /* U+0035 "5" */
-    0x7f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xe7,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0xfc, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x3, 0xff, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x3f, 0xf0, 0x7f, 0xc0, 0x7f, 0xe3,
-    0xff, 0xe0, 0xff, 0xcf, 0xff, 0xe1, 0xff, 0xbf,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0x3, 0xfc, 0x7,
-    0xfe, 0x0, 0xe0, 0xf, 0xfc, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x7f,
-    0xe0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xfc, 0x0,
+    0x1, 0x1d, 0x2, 0x1d, 0x2, 0x1d, 0x2, 0x1d,
+    0x2, 0x1d, 0x2, 0x1d, 0x2, 0x1d, 0x2, 0x1d,
+    0x2, 0x1d, 0x2, 0xa, 0x15, 0xa, 0x15, 0xa,
+    0x15, 0xa, 0x15, 0xa, 0x15, 0xa, 0x15, 0xa,
+    0x5, 0x9, 0x7, 0xa, 0x3, 0xd, 0x5, 0xa,
+    0x2, 0xf, 0x4, 0xa, 0x1, 0x11, 0x3, 0x1d,
+    0x2, 0x1d, 0x2, 0x1e, 0x1, 0x1e, 0x3, 0x1c,
+    0x6, 0x8, 0x7, 0xa, 0x9, 0x3, 0x9, 0xa,
+    0x15, 0xa, 0x15, 0xa, 0x15, 0xa, 0x15, 0xa,
+    0x15, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x67, 0x1, 0x1d, 0x2, 0x1d, 0x3, 0x1b,
+    0x5, 0x19, 0x7, 0x17, 0xa, 0x13, 0x6,
 
     /* U+0036 "6" */
-    0x3, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xc0,
-    0x7f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfc,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0xff, 0xc1,
-    0xff, 0x81, 0xff, 0x8f, 0xff, 0xc3, 0xff, 0x3f,
-    0xff, 0xc7, 0xfe, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xfc, 0x0,
+    0x6, 0x13, 0xa, 0x17, 0x7, 0x19, 0x5, 0x1b,
+    0x3, 0x1d, 0x2, 0x1d, 0x1, 0x67, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0x15, 0xa, 0x15, 0xa,
+    0x15, 0xa, 0x15, 0xa, 0x5, 0xa, 0x6, 0xa,
+    0x3, 0xe, 0x4, 0xa, 0x2, 0x10, 0x3, 0xa,
+    0x1, 0x12, 0x2, 0x1e, 0x1, 0x1e, 0x1, 0x6a,
+    0x8, 0x15, 0xa, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x67, 0x1, 0x1d, 0x2, 0x1d,
+    0x3, 0x1b, 0x5, 0x19, 0x7, 0x17, 0xa, 0x13,
+    0x6,
 
     /* U+0037 "7" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0xf, 0xfe, 0x0,
-    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x7f, 0xf0, 0x0, 0x0, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x0,
-    0x1f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x3f, 0xf8, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x7f, 0xf0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0xff, 0x20, 0x14, 0xc, 0x14, 0xb, 0x14,
+    0xc, 0x14, 0xb, 0x14, 0xc, 0x14, 0xb, 0x14,
+    0xb, 0x15, 0xb, 0x14, 0xb, 0x14, 0xc, 0x14,
+    0xb, 0x14, 0xc, 0x14, 0xb, 0x14, 0xb, 0x15,
+    0xb, 0x14, 0xb, 0x14, 0xc, 0x14, 0xb, 0x14,
+    0xc, 0x14, 0xb, 0x14, 0xb, 0x15, 0xb, 0x14,
+    0xb, 0x14, 0xc, 0x14, 0xb, 0x14, 0xc, 0x14,
+    0xb, 0x14, 0xc, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xc, 0x14, 0xb, 0x14, 0xc, 0x14, 0xb, 0x14,
+    0xc, 0x14,
 
     /* U+0038 "8" */
-    0x1, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x3f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0xfc, 0xff, 0xc0, 0x1f, 0xf9, 0xff,
-    0x80, 0x3f, 0xf3, 0xff, 0x0, 0x7f, 0xe7, 0xfe,
-    0x0, 0xff, 0xcf, 0xfc, 0x1, 0xff, 0x9f, 0xf8,
-    0x3, 0xff, 0x3f, 0xf0, 0x7, 0xfe, 0x7f, 0xe0,
-    0xf, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xe1, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xfc, 0x7, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xfc, 0x0,
+    0x7, 0x11, 0xc, 0x15, 0x9, 0x17, 0x7, 0x19,
+    0x5, 0x1b, 0x4, 0x1b, 0x3, 0x1d, 0x2, 0x1d,
+    0x2, 0x1d, 0x2, 0xa, 0x9, 0xa, 0x2, 0xa,
+    0x9, 0xa, 0x2, 0xa, 0x9, 0xa, 0x2, 0xa,
+    0x9, 0xa, 0x2, 0xa, 0x9, 0xa, 0x2, 0xa,
+    0x9, 0xa, 0x2, 0xa, 0x9, 0xa, 0x2, 0xa,
+    0x9, 0xa, 0x2, 0x1d, 0x3, 0x1b, 0x4, 0x1b,
+    0x5, 0x19, 0x7, 0x17, 0x7, 0x19, 0x5, 0x1b,
+    0x3, 0x1d, 0x1, 0x29, 0xa, 0x15, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x67, 0x1, 0x1d,
+    0x2, 0x1d, 0x3, 0x1b, 0x5, 0x19, 0x7, 0x17,
+    0xa, 0x13, 0x6,
 
     /* U+0039 "9" */
-    0x3, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xc0,
-    0x7f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf7,
-    0xfe, 0x3f, 0xff, 0xcf, 0xfc, 0x3f, 0xff, 0x1f,
-    0xf8, 0x1f, 0xf8, 0x3f, 0xf0, 0x0, 0x0, 0x7f,
-    0xe0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xfc, 0x0,
+    0x6, 0x13, 0xa, 0x17, 0x7, 0x19, 0x5, 0x1b,
+    0x3, 0x1d, 0x2, 0x1d, 0x1, 0x67, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x14, 0xb, 0x14, 0xa, 0x15,
+    0x8, 0x6a, 0x1, 0x1e, 0x1, 0x1e, 0x2, 0x12,
+    0x1, 0xa, 0x3, 0x10, 0x2, 0xa, 0x4, 0xe,
+    0x3, 0xa, 0x6, 0xa, 0x5, 0xa, 0x15, 0xa,
+    0x15, 0xa, 0x15, 0xa, 0x15, 0x14, 0xb, 0x14,
+    0xb, 0x14, 0xb, 0x85, 0x2, 0x1d, 0x3, 0x1b,
+    0x5, 0x19, 0x7, 0x17, 0xa, 0x13, 0x6,
 
     /* U+003A ":" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0,
+    0x0, 0x64, 0x82, 0x64,
 
     /* U+00B0 "°" */
-    0x3f, 0xe3, 0xff, 0xbf, 0xff, 0xe0, 0xff, 0x7,
-    0xf8, 0x3f, 0xc1, 0xfe, 0xf, 0xf0, 0x7f, 0x83,
-    0xff, 0xfe, 0xff, 0xe3, 0xfe, 0x0
+    0x2, 0x9, 0x3, 0xb, 0x1, 0x11, 0x5, 0x8,
+    0x5, 0x8, 0x5, 0x8, 0x5, 0x8, 0x5, 0x8,
+    0x5, 0x8, 0x5, 0x11, 0x1, 0xb, 0x3, 0x9,
+    0x2
 };
 
 
@@ -279,18 +172,18 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 249, .box_w = 10, .box_h = 10, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13, .adv_w = 606, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 184, .adv_w = 414, .box_w = 18, .box_h = 44, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 283, .adv_w = 583, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 454, .adv_w = 584, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 625, .adv_w = 630, .box_w = 37, .box_h = 44, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 829, .adv_w = 617, .box_w = 31, .box_h = 44, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 1000, .adv_w = 608, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 1171, .adv_w = 565, .box_w = 32, .box_h = 44, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1347, .adv_w = 592, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 1518, .adv_w = 608, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 1689, .adv_w = 249, .box_w = 10, .box_h = 33, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 1731, .adv_w = 306, .box_w = 13, .box_h = 13, .ofs_x = 3, .ofs_y = 31}
+    {.bitmap_index = 2, .adv_w = 606, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 77, .adv_w = 414, .box_w = 18, .box_h = 44, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 153, .adv_w = 583, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 222, .adv_w = 584, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 313, .adv_w = 630, .box_w = 37, .box_h = 44, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 424, .adv_w = 617, .box_w = 31, .box_h = 44, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 519, .adv_w = 608, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 600, .adv_w = 565, .box_w = 32, .box_h = 44, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 674, .adv_w = 592, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 773, .adv_w = 608, .box_w = 31, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 852, .adv_w = 249, .box_w = 10, .box_h = 33, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 856, .adv_w = 306, .box_w = 13, .box_h = 13, .ofs_x = 3, .ofs_y = 31}
 };
 
 /*---------------------
@@ -395,7 +288,7 @@ const lv_font_t industry_60 = {
 lv_font_t industry_60 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_rle_get_glyph_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 44,          /*The maximum line height required by the font*/
     .base_line = 0,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
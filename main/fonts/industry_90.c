@@ -2,9 +2,11 @@
  * Size: 90 px
  * Bpp: 1
  * Opts: --bpp 1 --size 90 --no-compress --font Industry-Black.ttf --symbols 1234567890:.° --format lvgl -o industry_90.c
+ * Post-processed with tools/font_rle.py (run-length glyph bitmaps)
  ******************************************************************************/
 
 #include "lvgl.h"
+#include "font_rle.h"
 
 #ifndef INDUSTRY_90
 #define INDUSTRY_90 1
@@ -19,517 +21,207 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+002E "." */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0,
+    0x0, 0xc4,
 
     /* U+0030 "0" */
-    0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0,
+    0x9, 0x1d, 0xf, 0x23, 0xb, 0x25, 0x9, 0x27,
+    0x7, 0x29, 0x5, 0x2b, 0x3, 0x2d, 0x2, 0x2d,
+    0x2, 0x2d, 0x1, 0xfa, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0xfa, 0x1, 0x2d,
+    0x2, 0x2d, 0x2, 0x2d, 0x3, 0x2b, 0x5, 0x29,
+    0x7, 0x27, 0x9, 0x25, 0xb, 0x23, 0xf, 0x1d,
+    0x9,
 
     /* U+0031 "1" */
-    0x0, 0x3, 0xff, 0xe0, 0x1, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf0, 0x3f, 0xff,
-    0xfe, 0x1f, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-    0xc0, 0x7, 0xff, 0xf0, 0x0, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xc0, 0x3, 0xff, 0xf8, 0x0, 0x7f,
-    0xff, 0x0, 0xf, 0xff, 0xe0, 0x1, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0x80, 0x7, 0xff, 0xf0, 0x0,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xc0, 0x3, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0x0, 0xf, 0xff, 0xe0,
-    0x1, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0x80, 0x7,
-    0xff, 0xf0, 0x0, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xc0, 0x3, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0x0,
-    0xf, 0xff, 0xe0, 0x1, 0xff, 0xfc, 0x0, 0x3f,
-    0xff, 0x80, 0x7, 0xff, 0xf0, 0x0, 0xff, 0xfe,
-    0x0, 0x1f, 0xff, 0xc0, 0x3, 0xff, 0xf8, 0x0,
-    0x7f, 0xff, 0x0, 0xf, 0xff, 0xe0, 0x1, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0x80, 0x7, 0xff, 0xf0,
-    0x0, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xc0, 0x3,
-    0xff, 0xf8, 0x0, 0x7f, 0xff, 0x0, 0xf, 0xff,
-    0xe0, 0x1, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0x80,
-    0x7, 0xff, 0xf0, 0x0, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xc0, 0x3, 0xff, 0xf8, 0x0, 0x7f, 0xff,
-    0x0, 0xf, 0xff, 0xe0,
+    0xe, 0xd, 0xc, 0xf, 0xa, 0x11, 0x8, 0x13,
+    0x6, 0x15, 0x4, 0x17, 0x2, 0xff, 0x17, 0x2,
+    0x16, 0x5, 0x13, 0x8, 0x10, 0xb, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf, 0xc, 0xf, 0xc, 0xf, 0xc, 0xf, 0xc,
+    0xf,
 
     /* U+0032 "2" */
-    0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xdf, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0x7f, 0xfe, 0x0, 0x1,
-    0xff, 0xfd, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xf7,
-    0xff, 0xe0, 0x0, 0x1f, 0xff, 0xdf, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f,
-    0xff, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0xa, 0x1b, 0x11, 0x1f, 0xd, 0x23, 0xa, 0x25,
+    0x8, 0x27, 0x6, 0x29, 0x5, 0x29, 0x4, 0x2b,
+    0x3, 0x2b, 0x2, 0x2d, 0x1, 0x2d, 0x1, 0x2d,
+    0x1, 0x2d, 0x1, 0x2d, 0x1, 0xf, 0xe, 0x10,
+    0x1, 0xe, 0x10, 0xf, 0x1, 0xe, 0x10, 0xf,
+    0x1, 0xe, 0x10, 0xf, 0x1, 0xe, 0x10, 0xf,
+    0x1, 0xe, 0x10, 0xf, 0x1f, 0xf, 0x1f, 0xf,
+    0x1f, 0xf, 0x1d, 0x11, 0x19, 0x15, 0x16, 0x18,
+    0x13, 0x1b, 0xf, 0x1f, 0xc, 0x21, 0xb, 0x23,
+    0x8, 0x25, 0x8, 0x26, 0x6, 0x27, 0x6, 0x27,
+    0x6, 0x27, 0x7, 0x25, 0x8, 0x24, 0xa, 0x22,
+    0xb, 0x1f, 0xf, 0x1c, 0x12, 0x19, 0x15, 0x16,
+    0x18, 0x12, 0x1c, 0x10, 0x1e, 0xf, 0x1f, 0xf,
+    0x1f, 0xf, 0x1f, 0xf, 0x1f, 0xf, 0x1f, 0xf,
+    0x1f, 0xf, 0x1f, 0xff, 0xff, 0x86,
 
     /* U+0033 "3" */
-    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0x9f, 0xff,
-    0xc0, 0x0, 0xff, 0xfe, 0x7f, 0xff, 0x0, 0x3,
-    0xff, 0xf9, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xe7,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0x9f, 0xff, 0xc0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0,
+    0xa, 0x1a, 0x12, 0x1e, 0xe, 0x22, 0xb, 0x24,
+    0x9, 0x26, 0x7, 0x28, 0x6, 0x28, 0x5, 0x2a,
+    0x4, 0x2a, 0x3, 0x2c, 0x2, 0x2c, 0x2, 0x2c,
+    0x2, 0x2c, 0x2, 0x2c, 0x2, 0x10, 0xc, 0x10,
+    0x2, 0xf, 0xe, 0xf, 0x2, 0xf, 0xe, 0xf,
+    0x2, 0xf, 0xe, 0xf, 0x2, 0xf, 0xe, 0xf,
+    0x2, 0xf, 0xe, 0xf, 0x1f, 0xf, 0x1f, 0xf,
+    0x1f, 0xf, 0x1f, 0xf, 0x1e, 0x10, 0x12, 0x1b,
+    0x13, 0x1b, 0x13, 0x1b, 0x13, 0x1a, 0x14, 0x19,
+    0x15, 0x18, 0x16, 0x17, 0x17, 0x18, 0x16, 0x1a,
+    0x14, 0x1b, 0x13, 0x1b, 0x13, 0x1c, 0x12, 0x1c,
+    0x1f, 0x10, 0x1f, 0xf, 0x1f, 0xf, 0x1f, 0xf,
+    0x1f, 0xf, 0x1f, 0x1e, 0x10, 0x1e, 0x10, 0x1e,
+    0x10, 0x1e, 0x10, 0x1e, 0x10, 0x1e, 0x10, 0x1f,
+    0xe, 0xf6, 0x1, 0x2c, 0x2, 0x2c, 0x3, 0x2a,
+    0x4, 0x29, 0x6, 0x28, 0x7, 0x26, 0x9, 0x24,
+    0xc, 0x20, 0x10, 0x1c, 0x9,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xfc, 0xff,
-    0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8, 0xff, 0xfc,
-    0x0, 0x0, 0x7, 0xff, 0xf8, 0xff, 0xfc, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0xff, 0xfc, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0xe0, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff,
-    0xc0, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0x0, 0xff,
-    0xfc, 0x0, 0x0, 0xff, 0xff, 0x0, 0xff, 0xfc,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0xff, 0xfc, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xfc, 0x0, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xf8, 0x0, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0xff, 0xfc, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0xff, 0xfc, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0,
+    0x1e, 0x10, 0x27, 0x11, 0x27, 0x11, 0x26, 0x12,
+    0x25, 0x13, 0x24, 0x14, 0x24, 0x14, 0x23, 0x15,
+    0x22, 0x16, 0x22, 0x16, 0x21, 0x17, 0x20, 0x18,
+    0x1f, 0x19, 0x1f, 0x19, 0x1e, 0x1a, 0x1d, 0x1b,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1d, 0x1a, 0x1e,
+    0x1a, 0xf, 0x1, 0xe, 0x19, 0xf, 0x2, 0xe,
+    0x18, 0xf, 0x3, 0xe, 0x17, 0x10, 0x3, 0xe,
+    0x17, 0xf, 0x4, 0xe, 0x16, 0xf, 0x5, 0xe,
+    0x15, 0x10, 0x5, 0xe, 0x14, 0x10, 0x6, 0xe,
+    0x14, 0xf, 0x7, 0xe, 0x13, 0xf, 0x8, 0xe,
+    0x12, 0x10, 0x8, 0xe, 0x12, 0xf, 0x9, 0xe,
+    0x11, 0xf, 0xa, 0xe, 0x10, 0x10, 0xa, 0xe,
+    0xf, 0x10, 0xb, 0xe, 0xf, 0xf, 0xc, 0xe,
+    0xe, 0x10, 0xc, 0xe, 0xd, 0x10, 0xd, 0xe,
+    0xc, 0x10, 0xe, 0xe, 0xc, 0xf, 0xf, 0xe,
+    0xb, 0xa7, 0x1, 0x37, 0x1, 0x37, 0x1, 0x37,
+    0x2, 0x36, 0x2, 0x36, 0x2, 0x36, 0x2, 0x36,
+    0x3, 0x35, 0x3, 0x35, 0x3, 0x35, 0x20, 0xe,
+    0x2a, 0xe, 0x2a, 0xe, 0x2a, 0xe, 0x2a, 0xe,
+    0x2a, 0xe, 0x2a, 0xe, 0x2a, 0xe, 0x2a, 0xe,
+    0x2a, 0xe, 0x2a, 0xe, 0x2a, 0xe, 0xa,
 
     /* U+0035 "5" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x3f, 0xfe, 0x0, 0x3f,
-    0xff, 0x81, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf,
-    0xff, 0xff, 0x80, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xc1, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xc3, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff,
-    0xe0, 0xf, 0xff, 0xf0, 0x1, 0xfe, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x30, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0,
+    0x1, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c,
+    0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c,
+    0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c,
+    0x3, 0x2c, 0x3, 0x2c, 0x3, 0xf, 0x20, 0xf,
+    0x20, 0xf, 0x20, 0xf, 0x20, 0xf, 0x20, 0xf,
+    0x20, 0xf, 0x20, 0xf, 0x20, 0xf, 0x8, 0xd,
+    0xb, 0xf, 0x6, 0x12, 0x8, 0xf, 0x4, 0x15,
+    0x7, 0xf, 0x3, 0x18, 0x5, 0xf, 0x2, 0x1a,
+    0x4, 0xf, 0x1, 0x1b, 0x4, 0x2c, 0x3, 0x2d,
+    0x2, 0x2d, 0x2, 0x2d, 0x2, 0x2e, 0x1, 0x2e,
+    0x4, 0x2b, 0x8, 0xe, 0x9, 0x10, 0xb, 0x8,
+    0xd, 0xf, 0xf, 0x2, 0xf, 0xf, 0x20, 0xf,
+    0x20, 0xf, 0x20, 0xf, 0x20, 0xf, 0x20, 0xf,
+    0x20, 0xf, 0x20, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1f, 0xf, 0xfb,
+    0x1, 0x2d, 0x2, 0x2d, 0x3, 0x2b, 0x4, 0x2b,
+    0x5, 0x29, 0x7, 0x27, 0x9, 0x25, 0xc, 0x21,
+    0x10, 0x1d, 0x9,
 
     /* U+0036 "6" */
-    0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xc0, 0x0, 0xff, 0xff,
-    0x7f, 0xff, 0x0, 0x0, 0xff, 0xfe, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xfd, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xfb, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xf7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x1,
-    0xff, 0xf8, 0x1, 0xff, 0xfc, 0xf, 0xff, 0xfe,
-    0x3, 0xff, 0xf8, 0x7f, 0xff, 0xfe, 0x7, 0xff,
-    0xf1, 0xff, 0xff, 0xff, 0xf, 0xff, 0xe7, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0,
+    0x9, 0x1c, 0x11, 0x20, 0xd, 0x24, 0xa, 0x26,
+    0x8, 0x28, 0x6, 0x2a, 0x5, 0x2a, 0x4, 0x2c,
+    0x3, 0x2c, 0x2, 0x2e, 0x1, 0x2e, 0x1, 0x2e,
+    0x1, 0x2e, 0x1, 0x2e, 0x1, 0x10, 0xe, 0x10,
+    0x1, 0xf, 0x10, 0xf, 0x1, 0xf, 0x10, 0xf,
+    0x1, 0xf, 0x10, 0xf, 0x1, 0xf, 0x10, 0xf,
+    0x1, 0xf, 0x20, 0xf, 0x20, 0xf, 0x20, 0xf,
+    0x20, 0xf, 0x20, 0xf, 0x8, 0xe, 0xa, 0xf,
+    0x6, 0x13, 0x7, 0xf, 0x4, 0x16, 0x6, 0xf,
+    0x3, 0x19, 0x4, 0xf, 0x2, 0x1b, 0x3, 0xf,
+    0x1, 0x1d, 0x2, 0x2d, 0x2, 0x2e, 0x1, 0x2e,
+    0x1, 0xd0, 0xb, 0x21, 0xf, 0x1f, 0x10, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1f, 0xf, 0xfb, 0x1, 0x2d,
+    0x2, 0x2d, 0x3, 0x2b, 0x4, 0x2b, 0x5, 0x29,
+    0x7, 0x27, 0x9, 0x25, 0xc, 0x21, 0x10, 0x1d,
+    0x9,
 
     /* U+0037 "7" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x64, 0x1, 0x2e, 0x1e, 0x10,
+    0x1e, 0x11, 0x1e, 0x10, 0x1e, 0x11, 0x1d, 0x11,
+    0x1e, 0x10, 0x1e, 0x11, 0x1e, 0x10, 0x1e, 0x11,
+    0x1e, 0x10, 0x1e, 0x11, 0x1d, 0x11, 0x1e, 0x10,
+    0x1e, 0x11, 0x1e, 0x10, 0x1e, 0x11, 0x1e, 0x10,
+    0x1e, 0x11, 0x1d, 0x11, 0x1e, 0x10, 0x1e, 0x11,
+    0x1e, 0x10, 0x1e, 0x11, 0x1e, 0x10, 0x1e, 0x11,
+    0x1d, 0x11, 0x1e, 0x10, 0x1e, 0x11, 0x1e, 0x10,
+    0x1e, 0x11, 0x1e, 0x10, 0x1e, 0x11, 0x1d, 0x11,
+    0x1e, 0x11, 0x1d, 0x11, 0x1e, 0x10, 0x1e, 0x11,
+    0x1e, 0x10, 0x1e, 0x11, 0x1d, 0x11, 0x1e, 0x11,
+    0x1d, 0x11, 0x1e, 0x10, 0x1e, 0x11, 0x1e, 0x10,
+    0x1e, 0x11, 0x1d, 0x11, 0x1e, 0x11, 0x1d, 0x11,
+    0x1e, 0x10, 0x1e, 0x11, 0x1e,
 
     /* U+0038 "8" */
-    0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xdf, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x7f, 0xff, 0x0, 0x1,
-    0xff, 0xfd, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xdf, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0x7f, 0xff, 0x0, 0x1, 0xff,
-    0xfd, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf7, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xdf, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0x7f, 0xff, 0x80, 0x3, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0,
+    0xa, 0x1b, 0x11, 0x1f, 0xd, 0x23, 0xa, 0x25,
+    0x8, 0x27, 0x6, 0x29, 0x5, 0x29, 0x4, 0x2b,
+    0x3, 0x2b, 0x2, 0x2d, 0x1, 0x2d, 0x1, 0x2d,
+    0x1, 0x2d, 0x1, 0x2d, 0x1, 0x10, 0xd, 0x10,
+    0x1, 0xf, 0xf, 0xf, 0x1, 0xf, 0xf, 0xf,
+    0x1, 0xf, 0xf, 0xf, 0x1, 0xf, 0xf, 0xf,
+    0x1, 0xf, 0xf, 0xf, 0x1, 0xf, 0xf, 0xf,
+    0x1, 0xf, 0xf, 0xf, 0x1, 0xf, 0xf, 0xf,
+    0x1, 0xf, 0xf, 0xf, 0x1, 0x10, 0xd, 0x10,
+    0x2, 0x2b, 0x3, 0x2b, 0x3, 0x2a, 0x5, 0x29,
+    0x6, 0x27, 0x8, 0x25, 0xa, 0x22, 0xb, 0x25,
+    0x7, 0x28, 0x5, 0x2a, 0x4, 0x2b, 0x2, 0x2c,
+    0x2, 0x2c, 0x1, 0x10, 0xe, 0x1f, 0x10, 0x1e,
+    0x10, 0x1e, 0x10, 0x1e, 0x10, 0x1e, 0x10, 0x1e,
+    0x10, 0x1e, 0x10, 0x1e, 0x10, 0x1e, 0x10, 0x1e,
+    0x10, 0x1e, 0x10, 0x1f, 0xe, 0xf6, 0x1, 0x2c,
+    0x2, 0x2c, 0x3, 0x2a, 0x4, 0x2a, 0x5, 0x28,
+    0x7, 0x26, 0x9, 0x24, 0xc, 0x20, 0x10, 0x1c,
+    0x9,
 
     /* U+0039 "9" */
-    0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xe0, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xc0,
-    0x7f, 0xff, 0xf0, 0x3f, 0xff, 0x80, 0x3f, 0xff,
-    0x80, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xdf, 0xff,
-    0xc0, 0x0, 0x3f, 0xff, 0xbf, 0xff, 0x80, 0x0,
-    0x7f, 0xff, 0x7f, 0xff, 0x0, 0x0, 0xff, 0xfe,
-    0xff, 0xfe, 0x0, 0x1, 0xff, 0xfd, 0xff, 0xfe,
-    0x0, 0x7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0,
+    0x9, 0x1d, 0x10, 0x21, 0xc, 0x25, 0x9, 0x27,
+    0x7, 0x29, 0x5, 0x2b, 0x4, 0x2b, 0x3, 0x2d,
+    0x2, 0x2d, 0x1, 0xfb, 0xf, 0x1f, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e, 0x11, 0x1e,
+    0x11, 0x1e, 0xf, 0x21, 0xb, 0xd0, 0x1, 0x2e,
+    0x1, 0x2e, 0x2, 0x2d, 0x2, 0x1d, 0x1, 0xf,
+    0x3, 0x1b, 0x2, 0xf, 0x4, 0x19, 0x3, 0xf,
+    0x5, 0x17, 0x4, 0xf, 0x7, 0x13, 0x6, 0xf,
+    0x9, 0xf, 0x8, 0xf, 0x20, 0xf, 0x20, 0xf,
+    0x20, 0xf, 0x20, 0xf, 0x20, 0xf, 0x20, 0xf,
+    0x1, 0xf, 0x10, 0xf, 0x1, 0xf, 0x10, 0xf,
+    0x1, 0xf, 0x10, 0xf, 0x1, 0xf, 0x10, 0xf,
+    0x1, 0x10, 0xe, 0x10, 0x1, 0x2e, 0x1, 0x2e,
+    0x1, 0x2e, 0x1, 0x2e, 0x1, 0x2e, 0x2, 0x2c,
+    0x3, 0x2c, 0x4, 0x2a, 0x5, 0x2a, 0x6, 0x28,
+    0x8, 0x26, 0xa, 0x24, 0xd, 0x20, 0x11, 0x1c,
+    0x9,
 
     /* U+003A ":" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0xc4, 0xff, 0x27, 0xc4,
 
     /* U+00B0 "°" */
-    0x1f, 0xff, 0xf, 0xff, 0xf9, 0xff, 0xff, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xff, 0x1,
-    0xff, 0xe0, 0x3f, 0xfc, 0x7, 0xff, 0x80, 0xff,
-    0xf0, 0x1f, 0xfe, 0x3, 0xff, 0xc0, 0x7f, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
-    0xcf, 0xff, 0xf8, 0x7f, 0xfc, 0x0
+    0x3, 0xd, 0x4, 0x11, 0x2, 0x11, 0x1, 0x2c,
+    0x7, 0xc, 0x7, 0xc, 0x7, 0xc, 0x7, 0xc,
+    0x7, 0xc, 0x7, 0xc, 0x7, 0xc, 0x7, 0xc,
+    0x7, 0x2c, 0x1, 0x11, 0x2, 0x11, 0x4, 0xd,
+    0x3
 };
 
 
@@ -540,18 +232,18 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 373, .box_w = 14, .box_h = 14, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 25, .adv_w = 909, .box_w = 47, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 407, .adv_w = 621, .box_w = 27, .box_h = 65, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 627, .adv_w = 874, .box_w = 46, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 1001, .adv_w = 876, .box_w = 46, .box_h = 65, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 1375, .adv_w = 945, .box_w = 56, .box_h = 65, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1830, .adv_w = 926, .box_w = 47, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 2212, .adv_w = 912, .box_w = 47, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 2594, .adv_w = 848, .box_w = 47, .box_h = 65, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 2976, .adv_w = 888, .box_w = 46, .box_h = 65, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 3350, .adv_w = 912, .box_w = 47, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 3732, .adv_w = 373, .box_w = 14, .box_h = 49, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 3818, .adv_w = 459, .box_w = 19, .box_h = 19, .ofs_x = 5, .ofs_y = 46}
+    {.bitmap_index = 2, .adv_w = 909, .box_w = 47, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 115, .adv_w = 621, .box_w = 27, .box_h = 65, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 228, .adv_w = 874, .box_w = 46, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 346, .adv_w = 876, .box_w = 46, .box_h = 65, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 479, .adv_w = 945, .box_w = 56, .box_h = 65, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 646, .adv_w = 926, .box_w = 47, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 785, .adv_w = 912, .box_w = 47, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 922, .adv_w = 848, .box_w = 47, .box_h = 65, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 1031, .adv_w = 888, .box_w = 46, .box_h = 65, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 1176, .adv_w = 912, .box_w = 47, .box_h = 65, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 1313, .adv_w = 373, .box_w = 14, .box_h = 49, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 1318, .adv_w = 459, .box_w = 19, .box_h = 19, .ofs_x = 5, .ofs_y = 46}
 };
 
 /*---------------------
@@ -656,7 +348,7 @@ const lv_font_t industry_90 = {
 lv_font_t industry_90 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_rle_get_glyph_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 65,          /*The maximum line height required by the font*/
     .base_line = 0,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
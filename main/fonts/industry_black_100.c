@@ -2,9 +2,11 @@
  * Size: 100 px
  * Bpp: 1
  * Opts: --bpp 1 --size 100 --no-compress --font Industry-Black.ttf --symbols .1234567890° --format lvgl -o industry_black_100.c
+ * Post-processed with tools/font_rle.py (run-length glyph bitmaps)
  ******************************************************************************/
 
 #include "lvgl.h"
+#include "font_rle.h"
 
 #ifndef INDUSTRY_BLACK_100
 #define INDUSTRY_BLACK_100 1
@@ -19,625 +21,221 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+002E "." */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0x1,
 
     /* U+0030 "0" */
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xc0, 0x0,
+    0xa, 0x20, 0x11, 0x26, 0xd, 0x28, 0xb, 0x2a,
+    0x9, 0x2c, 0x7, 0x2e, 0x5, 0x30, 0x3, 0x32,
+    0x2, 0x32, 0x2, 0x32, 0x1, 0xff, 0x4b, 0x10,
+    0x23, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x23, 0x10,
+    0xff, 0x4b, 0x1, 0x32, 0x2, 0x32, 0x2, 0x32,
+    0x3, 0x30, 0x5, 0x2e, 0x7, 0x2c, 0x9, 0x2a,
+    0xb, 0x28, 0xd, 0x26, 0x11, 0x20, 0xa,
 
     /* U+0031 "1" */
-    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x3, 0xff, 0xfc,
-    0x0, 0x1f, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc0, 0x3f,
-    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0xff,
-    0xff, 0x80, 0x1, 0xff, 0xff, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0xff, 0xff,
-    0x80, 0x1, 0xff, 0xff, 0x0, 0x3, 0xff, 0xfe,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x1f, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0xff, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0x0, 0x3, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xf8, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0xff, 0xff, 0x80, 0x1,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x7,
-    0xff, 0xfc, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x7f,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0x80, 0x1, 0xff, 0xff,
-    0x0, 0x3, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0x80, 0x1, 0xff, 0xff, 0x0,
-    0x3, 0xff, 0xfe,
+    0x11, 0xe, 0xf, 0x10, 0xd, 0x12, 0xa, 0x15,
+    0x8, 0x17, 0x6, 0x19, 0x4, 0x1b, 0x2, 0xff,
+    0x60, 0x2, 0x1a, 0x5, 0x17, 0x8, 0x14, 0xb,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11, 0xe,
+    0x11, 0xe, 0x11, 0xe, 0x11, 0xe, 0x11,
 
     /* U+0032 "2" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xef, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xfd, 0xff, 0xfe, 0x0, 0x0, 0xff,
-    0xff, 0xbf, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xf7,
-    0xff, 0xf8, 0x0, 0x3, 0xff, 0xfe, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xdf, 0xff, 0xe0, 0x0,
-    0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0,
+    0xc, 0x1c, 0x14, 0x22, 0xf, 0x26, 0xc, 0x28,
+    0xa, 0x2a, 0x8, 0x2c, 0x6, 0x2e, 0x5, 0x2e,
+    0x4, 0x30, 0x3, 0x30, 0x3, 0x30, 0x2, 0x32,
+    0x1, 0x32, 0x1, 0x32, 0x1, 0x32, 0x1, 0x32,
+    0x1, 0x11, 0xf, 0x12, 0x1, 0x10, 0x11, 0x11,
+    0x1, 0x10, 0x11, 0x11, 0x1, 0x10, 0x11, 0x11,
+    0x1, 0x10, 0x11, 0x11, 0x1, 0x10, 0x11, 0x11,
+    0x1, 0x10, 0x11, 0x11, 0x22, 0x11, 0x22, 0x11,
+    0x22, 0x11, 0x20, 0x13, 0x1c, 0x17, 0x19, 0x1a,
+    0x16, 0x1d, 0x13, 0x20, 0x10, 0x22, 0xd, 0x26,
+    0xb, 0x28, 0x9, 0x29, 0x8, 0x2a, 0x8, 0x2a,
+    0x8, 0x2a, 0x8, 0x2a, 0x8, 0x2a, 0x9, 0x28,
+    0xa, 0x27, 0xc, 0x24, 0xe, 0x22, 0x11, 0x1e,
+    0x15, 0x1b, 0x18, 0x18, 0x1b, 0x15, 0x1e, 0x12,
+    0x21, 0x11, 0x22, 0x11, 0x22, 0x11, 0x22, 0x11,
+    0x22, 0x11, 0x22, 0x11, 0x22, 0x11, 0x22, 0x11,
+    0x22, 0xff, 0xff, 0xff, 0x33,
 
     /* U+0033 "3" */
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xe0, 0x0, 0xff, 0xff, 0xcf, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xf9, 0xff, 0xff, 0x0, 0x1, 0xff,
-    0xff, 0x3f, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xe7,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xfc, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xff, 0x9f, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x0, 0x0,
+    0xc, 0x1b, 0x15, 0x21, 0x10, 0x25, 0xd, 0x27,
+    0xb, 0x29, 0x9, 0x2b, 0x7, 0x2c, 0x7, 0x2d,
+    0x5, 0x2f, 0x4, 0x2f, 0x4, 0x2f, 0x3, 0x31,
+    0x2, 0x31, 0x2, 0x31, 0x2, 0x31, 0x2, 0x31,
+    0x2, 0x12, 0xd, 0x12, 0x2, 0x11, 0xf, 0x11,
+    0x2, 0x11, 0xf, 0x11, 0x2, 0x11, 0xf, 0x11,
+    0x2, 0x11, 0xf, 0x11, 0x2, 0x11, 0xf, 0x11,
+    0x2, 0x11, 0xf, 0x11, 0x22, 0x11, 0x22, 0x11,
+    0x22, 0x11, 0x22, 0x11, 0x21, 0x12, 0x14, 0x1e,
+    0x15, 0x1e, 0x15, 0x1e, 0x15, 0x1d, 0x16, 0x1c,
+    0x17, 0x1b, 0x18, 0x1a, 0x19, 0x19, 0x1a, 0x1a,
+    0x19, 0x1c, 0x17, 0x1d, 0x16, 0x1e, 0x15, 0x1e,
+    0x15, 0x1f, 0x14, 0x1f, 0x22, 0x12, 0x22, 0x11,
+    0x22, 0x11, 0x22, 0x11, 0x22, 0x11, 0x22, 0x11,
+    0x22, 0x22, 0x11, 0x22, 0x11, 0x22, 0x11, 0x22,
+    0x11, 0x22, 0x11, 0x22, 0x11, 0x23, 0xf, 0xff,
+    0x12, 0x1, 0x31, 0x2, 0x31, 0x2, 0x31, 0x3,
+    0x2f, 0x4, 0x2e, 0x6, 0x2d, 0x7, 0x2b, 0x9,
+    0x29, 0xb, 0x26, 0xf, 0x23, 0x12, 0x1e, 0xb,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x7f, 0xff, 0x80, 0x0,
-    0x0, 0x1f, 0xff, 0xf3, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xf8, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x87, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xfc, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x7f,
-    0xff, 0xc1, 0xff, 0xfe, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff,
-    0xe0, 0x7f, 0xff, 0x80, 0x0, 0x3, 0xff, 0xfe,
-    0x3, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x1f, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x7,
-    0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0x0, 0x3f,
-    0xff, 0xc0, 0x0, 0x1f, 0xff, 0xf0, 0x1, 0xff,
-    0xfe, 0x0, 0x1, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x7f, 0xff,
-    0x80, 0x0, 0xff, 0xff, 0x80, 0x3, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xe0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0xff, 0xff, 0x0,
-    0x7, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf8, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xc0, 0x7,
-    0xff, 0xfe, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xe0, 0x0,
+    0x21, 0x12, 0x2a, 0x13, 0x2a, 0x13, 0x29, 0x14,
+    0x28, 0x15, 0x27, 0x16, 0x27, 0x16, 0x26, 0x17,
+    0x25, 0x18, 0x25, 0x18, 0x24, 0x19, 0x23, 0x1a,
+    0x22, 0x1b, 0x22, 0x1b, 0x21, 0x1c, 0x20, 0x1d,
+    0x20, 0x1d, 0x1f, 0x1e, 0x1e, 0x1f, 0x1d, 0x20,
+    0x1d, 0x20, 0x1c, 0x21, 0x1b, 0x11, 0x1, 0x10,
+    0x1a, 0x11, 0x2, 0x10, 0x1a, 0x11, 0x2, 0x10,
+    0x19, 0x11, 0x3, 0x10, 0x18, 0x11, 0x4, 0x10,
+    0x18, 0x11, 0x4, 0x10, 0x17, 0x11, 0x5, 0x10,
+    0x16, 0x11, 0x6, 0x10, 0x15, 0x12, 0x6, 0x10,
+    0x15, 0x11, 0x7, 0x10, 0x14, 0x11, 0x8, 0x10,
+    0x13, 0x11, 0x9, 0x10, 0x13, 0x11, 0x9, 0x10,
+    0x12, 0x11, 0xa, 0x10, 0x11, 0x11, 0xb, 0x10,
+    0x10, 0x12, 0xb, 0x10, 0x10, 0x11, 0xc, 0x10,
+    0xf, 0x11, 0xd, 0x10, 0xe, 0x12, 0xd, 0x10,
+    0xe, 0x11, 0xe, 0x10, 0xd, 0x11, 0xf, 0x10,
+    0xc, 0x11, 0x10, 0x10, 0xb, 0x12, 0x10, 0x10,
+    0xb, 0xff, 0x31, 0x1, 0x3c, 0x1, 0x3c, 0x1,
+    0x3c, 0x1, 0x3c, 0x2, 0x3b, 0x2, 0x3b, 0x2,
+    0x3b, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x23,
+    0x10, 0x2d, 0x10, 0x2d, 0x10, 0x2d, 0x10, 0x2d,
+    0x10, 0x2d, 0x10, 0x2d, 0x10, 0x2d, 0x10, 0x2d,
+    0x10, 0x2d, 0x10, 0x2d, 0x10, 0x2d, 0x10, 0x2d,
+    0x10, 0xa,
 
     /* U+0035 "5" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfc, 0x1, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0xc0, 0xff, 0xff, 0xf0, 0x7,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-    0xc3, 0xff, 0xff, 0xfe, 0x7, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0x87, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf8,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0x0,
-    0x3f, 0xff, 0xf0, 0x0, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0x0, 0x0, 0xe0, 0x0, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xc0, 0x0,
+    0x1, 0x31, 0x3, 0x31, 0x3, 0x31, 0x3, 0x31,
+    0x3, 0x31, 0x3, 0x31, 0x3, 0x31, 0x3, 0x31,
+    0x3, 0x31, 0x3, 0x31, 0x3, 0x31, 0x3, 0x31,
+    0x3, 0x31, 0x3, 0x31, 0x3, 0x31, 0x3, 0x31,
+    0x3, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0x11, 0x9, 0xe, 0xc, 0x11,
+    0x6, 0x14, 0x9, 0x11, 0x5, 0x17, 0x7, 0x11,
+    0x4, 0x19, 0x6, 0x11, 0x2, 0x1c, 0x5, 0x11,
+    0x1, 0x1e, 0x4, 0x11, 0x1, 0x1e, 0x4, 0x31,
+    0x3, 0x32, 0x2, 0x32, 0x2, 0x32, 0x2, 0x33,
+    0x1, 0x33, 0x2, 0x32, 0x5, 0x2f, 0x9, 0xf,
+    0xa, 0x12, 0xc, 0x9, 0xe, 0x11, 0x10, 0x3,
+    0x10, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x22,
+    0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22,
+    0x12, 0x22, 0x12, 0x23, 0x10, 0xff, 0x17, 0x1,
+    0x32, 0x2, 0x32, 0x2, 0x32, 0x3, 0x30, 0x4,
+    0x30, 0x5, 0x2e, 0x7, 0x2c, 0x9, 0x2a, 0xb,
+    0x28, 0xe, 0x24, 0x12, 0x20, 0xa,
 
     /* U+0036 "6" */
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x3, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0x80, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0x87, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xc0, 0x0,
+    0xb, 0x1e, 0x13, 0x24, 0xf, 0x26, 0xc, 0x2a,
+    0x9, 0x2c, 0x7, 0x2e, 0x5, 0x30, 0x4, 0x30,
+    0x3, 0x32, 0x2, 0x32, 0x2, 0x32, 0x1, 0xff,
+    0x17, 0x10, 0x23, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x23, 0x11, 0x23, 0x11, 0x23,
+    0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x9,
+    0xf, 0xb, 0x11, 0x7, 0x14, 0x8, 0x11, 0x5,
+    0x18, 0x6, 0x11, 0x4, 0x1a, 0x5, 0x11, 0x2,
+    0x1d, 0x4, 0x11, 0x1, 0x1f, 0x3, 0x11, 0x1,
+    0x20, 0x2, 0x32, 0x2, 0x33, 0x1, 0x33, 0x1,
+    0x33, 0x1, 0xe7, 0xb, 0x26, 0xf, 0x23, 0x11,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x23, 0x10,
+    0xff, 0x17, 0x1, 0x32, 0x2, 0x32, 0x2, 0x32,
+    0x3, 0x30, 0x4, 0x30, 0x5, 0x2e, 0x7, 0x2c,
+    0x9, 0x2a, 0xb, 0x28, 0xe, 0x24, 0x12, 0x20,
+    0xa,
 
     /* U+0037 "7" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0x1d, 0x1, 0x34, 0x21,
+    0x13, 0x22, 0x13, 0x21, 0x13, 0x22, 0x12, 0x22,
+    0x13, 0x22, 0x12, 0x22, 0x13, 0x21, 0x13, 0x22,
+    0x13, 0x21, 0x13, 0x22, 0x12, 0x22, 0x13, 0x22,
+    0x12, 0x22, 0x13, 0x21, 0x13, 0x22, 0x12, 0x22,
+    0x13, 0x22, 0x12, 0x22, 0x13, 0x22, 0x12, 0x22,
+    0x13, 0x21, 0x13, 0x22, 0x12, 0x22, 0x13, 0x22,
+    0x12, 0x22, 0x13, 0x21, 0x13, 0x22, 0x13, 0x21,
+    0x13, 0x22, 0x12, 0x22, 0x13, 0x22, 0x12, 0x22,
+    0x13, 0x21, 0x13, 0x22, 0x13, 0x21, 0x13, 0x22,
+    0x12, 0x22, 0x13, 0x22, 0x12, 0x22, 0x13, 0x21,
+    0x13, 0x22, 0x13, 0x21, 0x13, 0x22, 0x12, 0x22,
+    0x13, 0x22, 0x12, 0x22, 0x13, 0x21, 0x13, 0x22,
+    0x13, 0x21, 0x13, 0x22, 0x12, 0x22, 0x13, 0x21,
+    0x13, 0x22, 0x13, 0x21, 0x13, 0x22, 0x12, 0x22,
+    0x13, 0x22,
 
     /* U+0038 "8" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xe7, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xfe, 0x7f, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xe7, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xfe, 0x7f, 0xff, 0xc0, 0x0, 0x3f, 0xff,
-    0xe7, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xfe, 0x7f,
-    0xff, 0xc0, 0x0, 0x3f, 0xff, 0xe7, 0xff, 0xfc,
-    0x0, 0x3, 0xff, 0xfe, 0x7f, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xe7, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xfe, 0x7f, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xe7,
-    0xff, 0xfe, 0x0, 0x7, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0,
+    0xc, 0x1c, 0x15, 0x22, 0x10, 0x26, 0xd, 0x28,
+    0xb, 0x2a, 0x9, 0x2c, 0x7, 0x2e, 0x6, 0x2e,
+    0x5, 0x30, 0x4, 0x30, 0x3, 0x31, 0x3, 0x32,
+    0x2, 0x32, 0x2, 0x32, 0x2, 0x32, 0x2, 0x32,
+    0x2, 0x12, 0xe, 0x12, 0x2, 0x11, 0x10, 0x11,
+    0x2, 0x11, 0x10, 0x11, 0x2, 0x11, 0x10, 0x11,
+    0x2, 0x11, 0x10, 0x11, 0x2, 0x11, 0x10, 0x11,
+    0x2, 0x11, 0x10, 0x11, 0x2, 0x11, 0x10, 0x11,
+    0x2, 0x11, 0x10, 0x11, 0x2, 0x11, 0x10, 0x11,
+    0x2, 0x11, 0x10, 0x11, 0x2, 0x12, 0xe, 0x12,
+    0x3, 0x30, 0x4, 0x30, 0x4, 0x30, 0x5, 0x2e,
+    0x7, 0x2c, 0x9, 0x2a, 0xb, 0x28, 0xd, 0x26,
+    0xc, 0x2a, 0x9, 0x2c, 0x7, 0x2e, 0x5, 0x30,
+    0x3, 0x31, 0x3, 0x32, 0x2, 0x32, 0x1, 0x12,
+    0x10, 0x23, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22,
+    0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22,
+    0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22,
+    0x12, 0x23, 0x10, 0xff, 0x17, 0x1, 0x32, 0x2,
+    0x32, 0x2, 0x32, 0x3, 0x30, 0x4, 0x30, 0x5,
+    0x2e, 0x7, 0x2c, 0x9, 0x2a, 0xb, 0x28, 0xe,
+    0x24, 0x13, 0x1e, 0xb,
 
     /* U+0039 "9" */
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xf0, 0x1, 0xff, 0xfc,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x7f, 0xff, 0xc0, 0x0, 0x1f, 0xff,
-    0xf7, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0x7f,
-    0xff, 0xc0, 0x0, 0x1f, 0xff, 0xf7, 0xff, 0xfc,
-    0x0, 0x1, 0xff, 0xff, 0x7f, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x80, 0x0,
+    0xb, 0x1e, 0x13, 0x24, 0xe, 0x28, 0xb, 0x2a,
+    0x9, 0x2c, 0x7, 0x2e, 0x5, 0x30, 0x4, 0x30,
+    0x3, 0x32, 0x2, 0x32, 0x2, 0x32, 0x1, 0xff,
+    0x17, 0x10, 0x23, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12,
+    0x22, 0x11, 0x23, 0xf, 0x26, 0xb, 0xe7, 0x1,
+    0x33, 0x1, 0x33, 0x1, 0x33, 0x2, 0x32, 0x2,
+    0x20, 0x1, 0x11, 0x3, 0x1f, 0x1, 0x11, 0x4,
+    0x1d, 0x2, 0x11, 0x5, 0x1b, 0x3, 0x11, 0x6,
+    0x18, 0x5, 0x11, 0x8, 0x15, 0x6, 0x11, 0xb,
+    0xf, 0x9, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23,
+    0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x1,
+    0x11, 0x11, 0x11, 0x1, 0x11, 0x11, 0x11, 0x1,
+    0x11, 0x11, 0x11, 0x1, 0x11, 0x11, 0x11, 0x1,
+    0x12, 0xf, 0x12, 0x1, 0x33, 0x1, 0x33, 0x1,
+    0x33, 0x1, 0x33, 0x1, 0x33, 0x2, 0x31, 0x3,
+    0x31, 0x3, 0x31, 0x4, 0x2f, 0x5, 0x2f, 0x6,
+    0x2d, 0x8, 0x2b, 0xa, 0x29, 0xc, 0x27, 0xf,
+    0x23, 0x14, 0x1d, 0xb,
 
     /* U+00B0 "°" */
-    0x1f, 0xff, 0xe0, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7,
-    0xff, 0xe0, 0x1f, 0xff, 0x80, 0x7f, 0xfe, 0x1,
-    0xff, 0xf8, 0x7, 0xff, 0xe0, 0x1f, 0xff, 0x80,
-    0x7f, 0xfe, 0x1, 0xff, 0xf8, 0x7, 0xff, 0xe0,
-    0x1f, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0x8f, 0xff, 0xfc, 0x1f,
-    0xff, 0xe0
+    0x3, 0x10, 0x5, 0x12, 0x3, 0x14, 0x1, 0x33,
+    0x8, 0xe, 0x8, 0xe, 0x8, 0xe, 0x8, 0xe,
+    0x8, 0xe, 0x8, 0xe, 0x8, 0xe, 0x8, 0xe,
+    0x8, 0xe, 0x8, 0xe, 0x8, 0x33, 0x1, 0x14,
+    0x3, 0x12, 0x5, 0x10, 0x3
 };
 
 
@@ -648,17 +246,17 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 414, .box_w = 16, .box_h = 16, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 32, .adv_w = 1010, .box_w = 52, .box_h = 73, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 507, .adv_w = 690, .box_w = 31, .box_h = 73, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 790, .adv_w = 971, .box_w = 51, .box_h = 73, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 1256, .adv_w = 973, .box_w = 51, .box_h = 73, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 1722, .adv_w = 1050, .box_w = 61, .box_h = 73, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 2279, .adv_w = 1029, .box_w = 52, .box_h = 73, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 2754, .adv_w = 1013, .box_w = 52, .box_h = 73, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 3229, .adv_w = 942, .box_w = 53, .box_h = 73, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 3713, .adv_w = 987, .box_w = 52, .box_h = 73, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 4188, .adv_w = 1013, .box_w = 52, .box_h = 73, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 4663, .adv_w = 510, .box_w = 22, .box_h = 21, .ofs_x = 5, .ofs_y = 51}
+    {.bitmap_index = 3, .adv_w = 1010, .box_w = 52, .box_h = 73, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 130, .adv_w = 690, .box_w = 31, .box_h = 73, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 257, .adv_w = 971, .box_w = 51, .box_h = 73, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 390, .adv_w = 973, .box_w = 51, .box_h = 73, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 542, .adv_w = 1050, .box_w = 61, .box_h = 73, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 728, .adv_w = 1029, .box_w = 52, .box_h = 73, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 886, .adv_w = 1013, .box_w = 52, .box_h = 73, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 1023, .adv_w = 942, .box_w = 53, .box_h = 73, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 1145, .adv_w = 987, .box_w = 52, .box_h = 73, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 1309, .adv_w = 1013, .box_w = 52, .box_h = 73, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 1465, .adv_w = 510, .box_w = 22, .box_h = 21, .ofs_x = 5, .ofs_y = 51}
 };
 
 /*---------------------
@@ -763,7 +361,7 @@ const lv_font_t industry_black_100 = {
 lv_font_t industry_black_100 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_rle_get_glyph_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 73,          /*The maximum line height required by the font*/
     .base_line = 0,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
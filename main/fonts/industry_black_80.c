@@ -2,9 +2,11 @@
  * Size: 80 px
  * Bpp: 1
  * Opts: --bpp 1 --size 80 --no-compress --font Industry-Black.ttf --symbols .1234567890°: --format lvgl -o industry_black_80.c
+ * Post-processed with tools/font_rle.py (run-length glyph bitmaps)
  ******************************************************************************/
 
 #include "lvgl.h"
+#include "font_rle.h"
 
 #ifndef INDUSTRY_BLACK_80
 #define INDUSTRY_BLACK_80 1
@@ -19,424 +21,189 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+002E "." */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0xa9,
 
     /* U+0030 "0" */
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xfe,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xf8, 0x3, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
+    0x8, 0x19, 0xd, 0x1f, 0x9, 0x21, 0x7, 0x23,
+    0x5, 0x25, 0x3, 0x27, 0x2, 0x27, 0x2, 0x27,
+    0x1, 0xda, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0xda, 0x1, 0x27, 0x2, 0x27,
+    0x2, 0x27, 0x3, 0x25, 0x5, 0x23, 0x7, 0x21,
+    0x9, 0x1f, 0xd, 0x19, 0x8,
 
     /* U+0031 "1" */
-    0x0, 0x7, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x7f,
-    0xff, 0x1, 0xff, 0xff, 0x7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xf8, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0x0, 0x1f,
-    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
-    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
-    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
-    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
-    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
-    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
-    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
-    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
-    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
-    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
-    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
-    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
-    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
-    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
-    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
-    0xff,
+    0xd, 0xb, 0xb, 0xd, 0x9, 0xf, 0x7, 0x11,
+    0x5, 0x13, 0x3, 0x15, 0x1, 0xdf, 0x3, 0x12,
+    0x6, 0xf, 0x9, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
+    0xb, 0xd, 0xb, 0xd, 0xb, 0xd,
 
     /* U+0032 "2" */
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xfc, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0xff, 0xf0, 0x0, 0xff, 0xfd,
-    0xff, 0xf0, 0x0, 0x3f, 0xfe, 0xff, 0xf8, 0x0,
-    0x1f, 0xff, 0x7f, 0xfc, 0x0, 0xf, 0xff, 0xbf,
-    0xfe, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x80, 0x3, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xe0,
-    0x3f, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-    0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x7f,
-    0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff,
-    0xc0, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xe0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x9, 0x18, 0xf, 0x1c, 0xb, 0x1f, 0x9, 0x22,
+    0x7, 0x22, 0x6, 0x24, 0x4, 0x26, 0x3, 0x26,
+    0x2, 0x28, 0x1, 0x28, 0x1, 0x28, 0x1, 0x28,
+    0x1, 0x28, 0x1, 0xe, 0xc, 0xe, 0x1, 0xd,
+    0xe, 0xd, 0x1, 0xd, 0xe, 0xd, 0x1, 0xd,
+    0xe, 0xd, 0x1, 0xd, 0xe, 0xd, 0x1c, 0xd,
+    0x1c, 0xd, 0x1c, 0xd, 0x1a, 0xf, 0x17, 0x12,
+    0x13, 0x16, 0x10, 0x19, 0xd, 0x1c, 0xa, 0x1e,
+    0x8, 0x21, 0x7, 0x21, 0x6, 0x22, 0x6, 0x22,
+    0x6, 0x22, 0x6, 0x21, 0x8, 0x1f, 0x9, 0x1d,
+    0xc, 0x1a, 0xf, 0x17, 0x12, 0x13, 0x16, 0x10,
+    0x19, 0xe, 0x1b, 0xe, 0x1b, 0xe, 0x1b, 0xe,
+    0x1b, 0xe, 0x1b, 0xe, 0x1b, 0xe, 0x1b, 0xff,
+    0xff, 0x17,
 
     /* U+0033 "3" */
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xe0,
-    0x3, 0xff, 0xf3, 0xff, 0xe0, 0x0, 0xff, 0xf9,
-    0xff, 0xf0, 0x0, 0x7f, 0xfc, 0xff, 0xf8, 0x0,
-    0x3f, 0xfe, 0x7f, 0xfc, 0x0, 0x1f, 0xff, 0x3f,
-    0xfe, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x7,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
-    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xfe,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
+    0x9, 0x17, 0x10, 0x1b, 0xc, 0x1e, 0xa, 0x21,
+    0x7, 0x22, 0x7, 0x23, 0x5, 0x25, 0x4, 0x25,
+    0x3, 0x27, 0x2, 0x27, 0x2, 0x27, 0x2, 0x27,
+    0x2, 0xe, 0xb, 0xe, 0x2, 0xd, 0xd, 0xd,
+    0x2, 0xd, 0xd, 0xd, 0x2, 0xd, 0xd, 0xd,
+    0x2, 0xd, 0xd, 0xd, 0x2, 0xd, 0xd, 0xd,
+    0x1c, 0xd, 0x1c, 0xd, 0x1c, 0xd, 0x1c, 0xd,
+    0x1b, 0xe, 0xf, 0x1a, 0xf, 0x19, 0x10, 0x19,
+    0x10, 0x18, 0x11, 0x17, 0x12, 0x16, 0x13, 0x16,
+    0x13, 0x18, 0x11, 0x19, 0x10, 0x19, 0x10, 0x1a,
+    0xf, 0x1a, 0x1c, 0xe, 0x1c, 0xd, 0x1c, 0xd,
+    0x1c, 0xd, 0x1c, 0xd, 0x1c, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1b,
+    0xd, 0xb2, 0x1, 0x27, 0x2, 0x27, 0x3, 0x25,
+    0x4, 0x24, 0x6, 0x22, 0x8, 0x20, 0xb, 0x1d,
+    0xe, 0x19, 0x8,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xfb, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xf9,
-    0xff, 0xf0, 0x0, 0x0, 0xff, 0xfc, 0xff, 0xf8,
-    0x0, 0x0, 0xff, 0xfc, 0x7f, 0xfc, 0x0, 0x0,
-    0x7f, 0xfc, 0x3f, 0xfe, 0x0, 0x0, 0x7f, 0xfc,
-    0x1f, 0xff, 0x0, 0x0, 0x7f, 0xfe, 0xf, 0xff,
-    0x80, 0x0, 0x7f, 0xfe, 0x7, 0xff, 0xc0, 0x0,
-    0x3f, 0xfe, 0x3, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0x1, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0x0, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0x0, 0x7f, 0xfc, 0x0,
-    0x1f, 0xff, 0x80, 0x3f, 0xfe, 0x0, 0x1f, 0xff,
-    0x80, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x80, 0xf,
-    0xff, 0x80, 0xf, 0xff, 0x80, 0x7, 0xff, 0xc0,
-    0xf, 0xff, 0xc0, 0x3, 0xff, 0xe0, 0xf, 0xff,
-    0xc0, 0x1, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xe0, 0x0,
+    0x1a, 0xf, 0x22, 0xf, 0x21, 0x10, 0x20, 0x11,
+    0x1f, 0x12, 0x1f, 0x12, 0x1e, 0x13, 0x1d, 0x14,
+    0x1d, 0x14, 0x1c, 0x15, 0x1b, 0x16, 0x1a, 0x17,
+    0x1a, 0x17, 0x19, 0x18, 0x18, 0x19, 0x18, 0x19,
+    0x17, 0x1a, 0x16, 0x1b, 0x15, 0xe, 0x1, 0xd,
+    0x15, 0xd, 0x2, 0xd, 0x14, 0xe, 0x2, 0xd,
+    0x13, 0xe, 0x3, 0xd, 0x13, 0xd, 0x4, 0xd,
+    0x12, 0xd, 0x5, 0xd, 0x11, 0xe, 0x5, 0xd,
+    0x10, 0xe, 0x6, 0xd, 0x10, 0xd, 0x7, 0xd,
+    0xf, 0xe, 0x7, 0xd, 0xe, 0xe, 0x8, 0xd,
+    0xe, 0xd, 0x9, 0xd, 0xd, 0xe, 0x9, 0xd,
+    0xc, 0xe, 0xa, 0xd, 0xb, 0xe, 0xb, 0xd,
+    0xb, 0xd, 0xc, 0xd, 0xa, 0xe, 0xc, 0xd,
+    0x9, 0xe, 0xd, 0xd, 0x9, 0xc3, 0x1, 0x30,
+    0x1, 0x30, 0x1, 0x30, 0x1, 0x30, 0x2, 0x2f,
+    0x2, 0x2f, 0x2, 0x2f, 0x2, 0x2f, 0x1c, 0xd,
+    0x24, 0xd, 0x24, 0xd, 0x24, 0xd, 0x24, 0xd,
+    0x24, 0xd, 0x24, 0xd, 0x24, 0xd, 0x24, 0xd,
+    0x24, 0xd, 0x24, 0xd, 0x8,
 
     /* U+0035 "5" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x7, 0xff, 0xc0, 0x1f, 0xff,
-    0x7, 0xff, 0xfc, 0x7, 0xff, 0xc7, 0xff, 0xff,
-    0x81, 0xff, 0xf3, 0xff, 0xff, 0xf0, 0x7f, 0xfd,
-    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xe0, 0xf, 0xff, 0xc0, 0xf, 0xc0,
-    0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff,
-    0xf8, 0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xfc, 0x0,
+    0x1, 0x27, 0x3, 0x27, 0x3, 0x27, 0x3, 0x27,
+    0x3, 0x27, 0x3, 0x27, 0x3, 0x27, 0x3, 0x27,
+    0x3, 0x27, 0x3, 0x27, 0x3, 0x27, 0x3, 0x27,
+    0x3, 0x27, 0x3, 0xd, 0x1d, 0xd, 0x1d, 0xd,
+    0x1d, 0xd, 0x1d, 0xd, 0x1d, 0xd, 0x1d, 0xd,
+    0x1d, 0xd, 0x7, 0xd, 0x9, 0xd, 0x5, 0x11,
+    0x7, 0xd, 0x3, 0x14, 0x6, 0xd, 0x2, 0x16,
+    0x5, 0xd, 0x1, 0x18, 0x4, 0x27, 0x3, 0x28,
+    0x2, 0x28, 0x2, 0x28, 0x2, 0x29, 0x1, 0x29,
+    0x4, 0x26, 0x7, 0xc, 0x9, 0xe, 0xa, 0x6,
+    0xd, 0xd, 0x1d, 0xd, 0x1d, 0xd, 0x1d, 0xd,
+    0x1d, 0xd, 0x1d, 0xd, 0x1d, 0x1a, 0x10, 0x1a,
+    0x10, 0x1a, 0x10, 0x1a, 0x10, 0x1a, 0x10, 0x1b,
+    0xe, 0xe0, 0x1, 0x28, 0x2, 0x28, 0x3, 0x26,
+    0x5, 0x24, 0x6, 0x24, 0x8, 0x20, 0xb, 0x1e,
+    0xe, 0x1a, 0x8,
 
     /* U+0036 "6" */
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0x87,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x0, 0x7,
-    0xff, 0xef, 0xff, 0x80, 0x0, 0xff, 0xfb, 0xff,
-    0xe0, 0x0, 0x3f, 0xfe, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xbf, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x80, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xfe,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0xff, 0xfc,
-    0x3, 0xff, 0xe0, 0xff, 0xff, 0xc0, 0xff, 0xf8,
-    0xff, 0xff, 0xf8, 0x3f, 0xfe, 0x7f, 0xff, 0xff,
-    0xf, 0xff, 0xbf, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
-    0x7, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff,
-    0xf8, 0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xfc, 0x0,
+    0x8, 0x19, 0xf, 0x1d, 0xb, 0x20, 0x9, 0x23,
+    0x7, 0x23, 0x6, 0x25, 0x4, 0x27, 0x3, 0x27,
+    0x2, 0x29, 0x1, 0x29, 0x1, 0x29, 0x1, 0x29,
+    0x1, 0x29, 0x1, 0xe, 0xd, 0xe, 0x1, 0xd,
+    0xf, 0xd, 0x1, 0xd, 0xf, 0xd, 0x1, 0xd,
+    0xf, 0xd, 0x1, 0xd, 0x1d, 0xd, 0x1d, 0xd,
+    0x1d, 0xd, 0x1d, 0xd, 0x1d, 0xd, 0x7, 0xe,
+    0x8, 0xd, 0x5, 0x12, 0x6, 0xd, 0x3, 0x15,
+    0x5, 0xd, 0x2, 0x17, 0x4, 0xd, 0x1, 0x19,
+    0x3, 0x28, 0x2, 0x29, 0x1, 0x29, 0x1, 0xba,
+    0xa, 0x1d, 0xe, 0x1a, 0x10, 0x1a, 0x10, 0x1a,
+    0x10, 0x1a, 0x10, 0x1a, 0x10, 0x1a, 0x10, 0x1a,
+    0x10, 0x1a, 0x10, 0x1a, 0x10, 0x1b, 0xe, 0xe0,
+    0x1, 0x28, 0x2, 0x28, 0x3, 0x26, 0x5, 0x24,
+    0x6, 0x24, 0x8, 0x20, 0xb, 0x1e, 0xe, 0x1a,
+    0x8,
 
     /* U+0037 "7" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xf,
-    0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xfe,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xe0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x23, 0x1b, 0xe, 0x1b, 0xf,
+    0x1b, 0xe, 0x1b, 0xf, 0x1a, 0xf, 0x1b, 0xf,
+    0x1a, 0xf, 0x1b, 0xe, 0x1b, 0xf, 0x1b, 0xe,
+    0x1b, 0xf, 0x1a, 0xf, 0x1b, 0xf, 0x1a, 0xf,
+    0x1b, 0xf, 0x1a, 0xf, 0x1b, 0xe, 0x1b, 0xf,
+    0x1a, 0xf, 0x1b, 0xf, 0x1a, 0xf, 0x1b, 0xf,
+    0x1a, 0xf, 0x1b, 0xe, 0x1b, 0xf, 0x1b, 0xe,
+    0x1b, 0xf, 0x1a, 0xf, 0x1b, 0xf, 0x1a, 0xf,
+    0x1b, 0xf, 0x1a, 0xf, 0x1b, 0xe, 0x1b, 0xf,
+    0x1a, 0xf, 0x1b, 0xf, 0x1a, 0xf, 0x1b, 0xf,
+    0x1a, 0xf, 0x1b, 0xe, 0x1b, 0xf, 0x1a, 0xf,
+    0x1b, 0xf, 0x1a, 0xf, 0x1b, 0xf, 0x1a, 0xf,
+    0x1b,
 
     /* U+0038 "8" */
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0xfc, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xe0,
-    0x3, 0xff, 0xf3, 0xff, 0xe0, 0x0, 0xff, 0xf9,
-    0xff, 0xf0, 0x0, 0x7f, 0xfc, 0xff, 0xf8, 0x0,
-    0x3f, 0xfe, 0x7f, 0xfc, 0x0, 0x1f, 0xff, 0x3f,
-    0xfe, 0x0, 0xf, 0xff, 0x9f, 0xff, 0x0, 0x7,
-    0xff, 0xcf, 0xff, 0x80, 0x3, 0xff, 0xe7, 0xff,
-    0xc0, 0x1, 0xff, 0xf3, 0xff, 0xe0, 0x0, 0xff,
-    0xf9, 0xff, 0xf8, 0x0, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0x80, 0x3, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
+    0x9, 0x17, 0x10, 0x1b, 0xc, 0x1f, 0x9, 0x21,
+    0x7, 0x23, 0x6, 0x23, 0x5, 0x25, 0x4, 0x25,
+    0x3, 0x27, 0x2, 0x27, 0x2, 0x27, 0x2, 0x27,
+    0x2, 0xe, 0xb, 0xe, 0x2, 0xd, 0xd, 0xd,
+    0x2, 0xd, 0xd, 0xd, 0x2, 0xd, 0xd, 0xd,
+    0x2, 0xd, 0xd, 0xd, 0x2, 0xd, 0xd, 0xd,
+    0x2, 0xd, 0xd, 0xd, 0x2, 0xd, 0xd, 0xd,
+    0x2, 0xd, 0xd, 0xd, 0x2, 0xd, 0xd, 0xd,
+    0x2, 0xe, 0xb, 0xe, 0x2, 0x27, 0x3, 0x25,
+    0x4, 0x25, 0x5, 0x23, 0x7, 0x21, 0x9, 0x1f,
+    0xa, 0x1f, 0x8, 0x23, 0x5, 0x25, 0x3, 0x27,
+    0x2, 0x27, 0x1, 0x28, 0x1, 0xe, 0xd, 0x1b,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a, 0xf, 0x1a,
+    0xf, 0x1a, 0xf, 0x1b, 0xd, 0xb2, 0x1, 0x27,
+    0x2, 0x27, 0x3, 0x25, 0x4, 0x24, 0x6, 0x23,
+    0x7, 0x21, 0xa, 0x1d, 0xe, 0x19, 0x8,
 
     /* U+0039 "9" */
-    0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xff,
-    0xe0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x1f,
-    0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7f,
-    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xf7, 0xff, 0xc7, 0xff, 0xff,
-    0xf9, 0xff, 0xf0, 0x7f, 0xff, 0xfc, 0x7f, 0xfc,
-    0xf, 0xff, 0xfc, 0x1f, 0xff, 0x0, 0xff, 0xfc,
-    0x7, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0,
-    0x0, 0x0, 0x1, 0xff, 0xf7, 0xff, 0xc0, 0x0,
-    0x7f, 0xfd, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0x7f,
-    0xfc, 0x0, 0x7, 0xff, 0xdf, 0xff, 0x80, 0x3,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
+    0x8, 0x1a, 0xe, 0x1e, 0xb, 0x20, 0x8, 0x24,
+    0x6, 0x24, 0x5, 0x26, 0x3, 0x28, 0x2, 0x28,
+    0x1, 0xe0, 0xe, 0x1b, 0x10, 0x1a, 0x10, 0x1a,
+    0x10, 0x1a, 0x10, 0x1a, 0x10, 0x1a, 0x10, 0x1a,
+    0x10, 0x1a, 0x10, 0x1a, 0x10, 0x1a, 0xe, 0x1d,
+    0xa, 0xba, 0x1, 0x29, 0x1, 0x29, 0x2, 0x28,
+    0x3, 0x19, 0x1, 0xd, 0x3, 0x18, 0x2, 0xd,
+    0x5, 0x15, 0x3, 0xd, 0x6, 0x12, 0x5, 0xd,
+    0x8, 0xe, 0x7, 0xd, 0x1d, 0xd, 0x1d, 0xd,
+    0x1d, 0xd, 0x1d, 0xd, 0x1d, 0xd, 0x1, 0xd,
+    0xf, 0xd, 0x1, 0xd, 0xf, 0xd, 0x1, 0xd,
+    0xf, 0xd, 0x1, 0xe, 0xd, 0xe, 0x1, 0x29,
+    0x1, 0x29, 0x1, 0x29, 0x1, 0x29, 0x1, 0x29,
+    0x2, 0x27, 0x3, 0x27, 0x4, 0x25, 0x6, 0x23,
+    0x7, 0x23, 0x8, 0x20, 0xc, 0x1d, 0xf, 0x19,
+    0x8,
 
     /* U+003A ":" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0xa9, 0xea, 0xa9,
 
     /* U+00B0 "°" */
-    0x3f, 0xfe, 0x3f, 0xff, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xc0, 0x7f, 0xe0, 0x3f, 0xf0,
-    0x1f, 0xf8, 0xf, 0xfc, 0x7, 0xfe, 0x3, 0xff,
-    0x1, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xfe, 0x3f, 0xfe, 0x0
+    0x2, 0xd, 0x3, 0xf, 0x1, 0x27, 0x7, 0xa,
+    0x7, 0xa, 0x7, 0xa, 0x7, 0xa, 0x7, 0xa,
+    0x7, 0xa, 0x7, 0xa, 0x7, 0xa, 0x7, 0x27,
+    0x1, 0xf, 0x3, 0xd, 0x2
 };
 
 
@@ -447,18 +214,18 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 332, .box_w = 13, .box_h = 13, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22, .adv_w = 808, .box_w = 41, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 325, .adv_w = 552, .box_w = 24, .box_h = 59, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 502, .adv_w = 777, .box_w = 41, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 805, .adv_w = 778, .box_w = 41, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 1108, .adv_w = 840, .box_w = 49, .box_h = 59, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1470, .adv_w = 823, .box_w = 42, .box_h = 59, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 1780, .adv_w = 810, .box_w = 42, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 2090, .adv_w = 754, .box_w = 42, .box_h = 59, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 2400, .adv_w = 790, .box_w = 41, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 2703, .adv_w = 810, .box_w = 42, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 3013, .adv_w = 332, .box_w = 13, .box_h = 44, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 3085, .adv_w = 408, .box_w = 17, .box_h = 17, .ofs_x = 4, .ofs_y = 41}
+    {.bitmap_index = 2, .adv_w = 808, .box_w = 41, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 103, .adv_w = 552, .box_w = 24, .box_h = 59, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 205, .adv_w = 777, .box_w = 41, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 311, .adv_w = 778, .box_w = 41, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 434, .adv_w = 840, .box_w = 49, .box_h = 59, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 583, .adv_w = 823, .box_w = 42, .box_h = 59, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 706, .adv_w = 810, .box_w = 42, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 827, .adv_w = 754, .box_w = 42, .box_h = 59, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 924, .adv_w = 790, .box_w = 41, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 1059, .adv_w = 810, .box_w = 42, .box_h = 59, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 1180, .adv_w = 332, .box_w = 13, .box_h = 44, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 1184, .adv_w = 408, .box_w = 17, .box_h = 17, .ofs_x = 4, .ofs_y = 41}
 };
 
 /*---------------------
@@ -563,7 +330,7 @@ const lv_font_t industry_black_80 = {
 lv_font_t industry_black_80 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_rle_get_glyph_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 59,          /*The maximum line height required by the font*/
     .base_line = 0,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -0,0 +1,242 @@
+/**
+ * @file      gesture.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gesture.h"
+
+#define GESTURE_PI      3.14159265f
+
+static int gesture_emit(gesture_event_t *events, int n, gesture_type_t type, int16_t x, int16_t y, int64_t time_us)
+{
+    gesture_event_t *e = &events[n];
+    memset(e, 0, sizeof(*e));
+    e->type = type;
+    e->x = x;
+    e->y = y;
+    e->scale = 1.0f;
+    e->time_us = time_us;
+    return n + 1;
+}
+
+static uint32_t dist2(int x0, int y0, int x1, int y1)
+{
+    return (uint32_t)((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+}
+
+static uint32_t square(uint32_t v)
+{
+    return v * v;
+}
+
+// A tap that can no longer become the first half of a double tap
+static int gesture_flush_tap(gesture_t *g, int64_t now_us, gesture_event_t *events, int n)
+{
+    if (!g->tap_pending) {
+        return n;
+    }
+    g->tap_pending = false;
+    return gesture_emit(events, n, GESTURE_TAP, g->tap_x, g->tap_y, now_us);
+}
+
+void gesture_init(gesture_t *g, const gesture_config_t *cfg)
+{
+    memset(g, 0, sizeof(*g));
+    if (cfg) {
+        g->cfg = *cfg;
+    } else {
+        gesture_config_t def = GESTURE_CONFIG_DEFAULT();
+        g->cfg = def;
+    }
+}
+
+int64_t gesture_next_deadline(const gesture_t *g)
+{
+    int64_t deadline = -1;
+    if (g->tap_pending && !g->active) {
+        deadline = g->tap_up_us + g->cfg.double_tap_gap_us;
+    }
+    if (g->active && !g->multi && !g->long_press_sent && g->max_dist2 <= square(g->cfg.tap_slop_px)) {
+        int64_t t = g->down_us + g->cfg.long_press_us;
+        if (deadline < 0 || t < deadline) {
+            deadline = t;
+        }
+    }
+    return deadline;
+}
+
+int gesture_poll(gesture_t *g, int64_t now_us, gesture_event_t *events)
+{
+    int n = 0;
+    // While a second press is down the pending tap waits for its outcome
+    if (g->tap_pending && !g->active && now_us - g->tap_up_us >= g->cfg.double_tap_gap_us) {
+        n = gesture_flush_tap(g, now_us, events, n);
+    }
+    if (g->active && !g->multi && !g->long_press_sent && g->max_dist2 <= square(g->cfg.tap_slop_px) &&
+            now_us - g->down_us >= g->cfg.long_press_us) {
+        g->long_press_sent = true;
+        n = gesture_flush_tap(g, now_us, events, n);
+        n = gesture_emit(events, n, GESTURE_LONG_PRESS, g->down_x, g->down_y, now_us);
+    }
+    return n;
+}
+
+static int gesture_release(gesture_t *g, int64_t now_us, gesture_event_t *events, int n)
+{
+    g->active = false;
+    if (g->multi || g->long_press_sent) {
+        return gesture_flush_tap(g, now_us, events, n);
+    }
+
+    int dx = g->last_x - g->down_x;
+    int dy = g->last_y - g->down_y;
+    int64_t duration = now_us - g->down_us;
+
+    if (dist2(0, 0, dx, dy) >= square(g->cfg.swipe_min_px) && duration <= g->cfg.swipe_max_us) {
+        n = gesture_flush_tap(g, now_us, events, n);
+        gesture_type_t type;
+        if (abs(dx) >= abs(dy)) {
+            type = dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT;
+        } else {
+            type = dy < 0 ? GESTURE_SWIPE_UP : GESTURE_SWIPE_DOWN;
+        }
+        n = gesture_emit(events, n, type, g->down_x, g->down_y, now_us);
+        events[n - 1].dx = dx;
+        events[n - 1].dy = dy;
+        return n;
+    }
+
+    if (g->max_dist2 > square(g->cfg.tap_slop_px) || duration > g->cfg.tap_max_us) {
+        return gesture_flush_tap(g, now_us, events, n);
+    }
+    if (g->tap_pending) {
+        // gesture_begin() already dropped taps that are too far or too old to pair
+        g->tap_pending = false;
+        return gesture_emit(events, n, GESTURE_DOUBLE_TAP, g->down_x, g->down_y, now_us);
+    }
+    if (!g->cfg.double_tap_gap_us) {
+        return gesture_emit(events, n, GESTURE_TAP, g->down_x, g->down_y, now_us);
+    }
+    g->tap_pending = true;
+    g->tap_x = g->down_x;
+    g->tap_y = g->down_y;
+    g->tap_up_us = now_us;
+    return n;
+}
+
+static int gesture_begin(gesture_t *g, const touch_sample_t *s, gesture_event_t *events, int n)
+{
+    const touch_point_t *p = &s->points[0];
+
+    // A pending tap only pairs with a single press that is close in time and place
+    if (s->count > 1 || s->time_us - g->tap_up_us > g->cfg.double_tap_gap_us ||
+            dist2(g->tap_x, g->tap_y, p->x, p->y) > square(g->cfg.double_tap_slop_px)) {
+        n = gesture_flush_tap(g, s->time_us, events, n);
+    }
+
+    g->active = true;
+    g->multi = false;
+    g->two_down = false;
+    g->long_press_sent = false;
+    g->down_x = g->last_x = p->x;
+    g->down_y = g->last_y = p->y;
+    g->down_us = s->time_us;
+    g->max_dist2 = 0;
+    return n;
+}
+
+static int gesture_two_fingers(gesture_t *g, const touch_sample_t *s, gesture_event_t *events, int n)
+{
+    const touch_point_t *a = &s->points[0];
+    const touch_point_t *b = &s->points[1];
+    float dx = b->x - a->x;
+    float dy = b->y - a->y;
+    float dist = sqrtf(dx * dx + dy * dy);
+    float angle = atan2f(dy, dx);
+    int16_t cx = (a->x + b->x) / 2;
+    int16_t cy = (a->y + b->y) / 2;
+
+    g->multi = true;
+    if (!g->two_down) {
+        g->two_down = true;
+        g->pinching = false;
+        g->rotating = false;
+        g->base_dist = dist;
+        g->prev_angle = angle;
+        g->angle = 0;
+        return n;
+    }
+
+    // Controllers may report the two fingers in either order, fold that and the ±pi wrap away
+    float delta = angle - g->prev_angle;
+    while (delta > GESTURE_PI / 2) {
+        delta -= GESTURE_PI;
+    }
+    while (delta <= -GESTURE_PI / 2) {
+        delta += GESTURE_PI;
+    }
+    g->prev_angle = angle;
+    g->angle += delta;
+
+    float scale = g->base_dist > 0 ? dist / g->base_dist : 1.0f;
+    float degrees = g->angle * 180.0f / GESTURE_PI;
+
+    if (!g->pinching && fabsf(scale - 1.0f) >= g->cfg.pinch_min_scale) {
+        g->pinching = true;
+    }
+    if (!g->rotating && fabsf(degrees) >= g->cfg.rotate_min_deg) {
+        g->rotating = true;
+    }
+    if (g->pinching) {
+        n = gesture_emit(events, n, GESTURE_PINCH, cx, cy, s->time_us);
+        events[n - 1].scale = scale;
+    }
+    if (g->rotating) {
+        n = gesture_emit(events, n, GESTURE_ROTATE, cx, cy, s->time_us);
+        events[n - 1].angle_deg = degrees;
+    }
+    return n;
+}
+
+int gesture_feed(gesture_t *g, const touch_sample_t *s, gesture_event_t *events)
+{
+    // Timers that expired before this sample come first
+    int n = gesture_poll(g, s->time_us, events);
+
+    if (!s->count) {
+        return g->active ? gesture_release(g, s->time_us, events, n) : n;
+    }
+    if (!g->active) {
+        n = gesture_begin(g, s, events, n);
+    }
+
+    const touch_point_t *p = &s->points[0];
+    g->last_x = p->x;
+    g->last_y = p->y;
+    uint32_t d = dist2(g->down_x, g->down_y, p->x, p->y);
+    if (d > g->max_dist2) {
+        g->max_dist2 = d;
+    }
+
+    if (s->count >= 2) {
+        n = gesture_two_fingers(g, s, events, n);
+    } else {
+        g->two_down = false;
+    }
+    return n;
+}
+
+const char *gesture_name(gesture_type_t type)
+{
+    static const char *const names[] = {
+        "none", "tap", "double tap", "long press", "swipe left", "swipe right",
+        "swipe up", "swipe down", "pinch", "rotate",
+    };
+    return type < sizeof(names) / sizeof(names[0]) ? names[type] : "?";
+}
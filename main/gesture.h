@@ -0,0 +1,114 @@
+/**
+ * @file      gesture.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "touch_input.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GESTURE_MAX_EVENTS      4       // most events one call can produce
+
+typedef enum {
+    GESTURE_NONE,
+    GESTURE_TAP,
+    GESTURE_DOUBLE_TAP,
+    GESTURE_LONG_PRESS,
+    GESTURE_SWIPE_LEFT,
+    GESTURE_SWIPE_RIGHT,
+    GESTURE_SWIPE_UP,
+    GESTURE_SWIPE_DOWN,
+    GESTURE_PINCH,          // scale relative to the first two finger sample
+    GESTURE_ROTATE,         // angle_deg relative to the first two finger sample
+} gesture_type_t;
+
+typedef struct gesture_event {
+    gesture_type_t type;
+    int16_t x;              // first point, centre of the two fingers for pinch and rotate
+    int16_t y;
+    int16_t dx;             // swipe travel
+    int16_t dy;
+    float scale;
+    float angle_deg;
+    int64_t time_us;
+} gesture_event_t;
+
+typedef struct {
+    uint16_t tap_slop_px;           // farther than this is no longer a tap or long press
+    uint16_t double_tap_slop_px;
+    uint16_t swipe_min_px;
+    uint32_t tap_max_us;
+    uint32_t double_tap_gap_us;     // 0 reports every tap at once
+    uint32_t long_press_us;
+    uint32_t swipe_max_us;
+    float pinch_min_scale;          // |scale - 1| before pinch events start
+    float rotate_min_deg;
+} gesture_config_t;
+
+#define GESTURE_CONFIG_DEFAULT() {      \
+    .tap_slop_px = 12,                  \
+    .double_tap_slop_px = 30,           \
+    .swipe_min_px = 50,                 \
+    .tap_max_us = 300000,               \
+    .double_tap_gap_us = 250000,        \
+    .long_press_us = 600000,            \
+    .swipe_max_us = 600000,             \
+    .pinch_min_scale = 0.08f,           \
+    .rotate_min_deg = 10.0f,            \
+}
+
+typedef struct {
+    gesture_config_t cfg;
+    // Current touch sequence, from the first press to the last release
+    bool active;
+    bool multi;
+    bool long_press_sent;
+    bool two_down;
+    bool pinching;
+    bool rotating;
+    int16_t down_x;
+    int16_t down_y;
+    int16_t last_x;
+    int16_t last_y;
+    uint32_t max_dist2;
+    int64_t down_us;
+    float base_dist;
+    float prev_angle;
+    float angle;            // unwrapped, radians
+    // Single tap waiting for a possible second one
+    bool tap_pending;
+    int16_t tap_x;
+    int16_t tap_y;
+    int64_t tap_up_us;
+} gesture_t;
+
+/*
+ * Recogniser over timestamped samples. Time only comes from the samples
+ * and the `now_us` passed to gesture_poll(), so a recorded trace always
+ * gives the same events.
+ */
+void gesture_init(gesture_t *g, const gesture_config_t *cfg);
+
+// Feed the next sample, returns the number of events written
+int gesture_feed(gesture_t *g, const touch_sample_t *sample, gesture_event_t *events);
+
+// Fire timers (long press, a lone tap) that are due at now_us
+int gesture_poll(gesture_t *g, int64_t now_us, gesture_event_t *events);
+
+// Earliest time gesture_poll() may report something, -1 when nothing is pending
+int64_t gesture_next_deadline(const gesture_t *g);
+
+const char *gesture_name(gesture_type_t type);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,203 @@
+/**
+ * @file      glyph_cache.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <sdkconfig.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "glyph_cache.h"
+#include "src/draw/sw/lv_draw_sw.h"
+
+#if CONFIG_LILYGO_GLYPH_CACHE
+
+#define GLYPH_CACHE_MAX_ENTRIES     64
+
+// Two timer reads per letter cost more than a cached small glyph, so timing is opt-in
+#if CONFIG_LILYGO_GLYPH_CACHE_TIMING
+#define GLYPH_TIME()                esp_timer_get_time()
+#else
+#define GLYPH_TIME()                0
+#endif
+
+typedef struct {
+    const lv_font_t *font;
+    const lv_font_glyph_dsc_t *g;
+    uint32_t letter;
+} glyph_job_t;
+
+static const char *TAG = "GLYPH_CACHE";
+static cache_store_t glyph_store;
+static bool glyph_ready = false;
+static bool glyph_enabled = true;
+static lv_coord_t glyph_min_height;
+static glyph_cache_stats_t glyph_stats;
+static void (*glyph_prev_ctx_init)(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx);
+static void (*glyph_prev_draw_letter)(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc,
+                                      const lv_point_t *pos_p, uint32_t letter);
+
+static bool glyph_fill(void *buf, size_t size, void *user_data)
+{
+    glyph_job_t *job = (glyph_job_t *)user_data;
+    const uint8_t *bitmap = lv_font_get_glyph_bitmap(job->font, job->letter);
+    if (!bitmap) {
+        return false;
+    }
+
+    // Font bitmaps are packed without row padding, expand them to one byte per pixel
+    uint8_t bpp = job->g->bpp;
+    uint8_t mask = (1 << bpp) - 1;
+    uint32_t count = (uint32_t)job->g->box_w * job->g->box_h;
+    lv_opa_t *out = (lv_opa_t *)buf;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t bit = i * bpp;
+        uint8_t v = (bitmap[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+        out[i] = (lv_opa_t)((v * 255) / mask);
+    }
+    return true;
+}
+
+static bool glyph_cache_draw(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc,
+                             const lv_point_t *pos_p, uint32_t letter)
+{
+    lv_font_glyph_dsc_t g;
+    if (!lv_font_get_glyph_dsc(dsc->font, &g, letter, '\0') || !g.resolved_font) {
+        return false;
+    }
+    if (g.box_h < glyph_min_height || g.box_w == 0 ||
+            g.bpp == LV_IMGFONT_BPP || g.resolved_font->subpx != LV_FONT_SUBPX_NONE ||
+            (g.bpp != 1 && g.bpp != 2 && g.bpp != 4 && g.bpp != 8)) {
+        return false;
+    }
+
+    // Same placement as lv_draw_sw_letter()
+    lv_area_t area;
+    area.x1 = pos_p->x + g.ofs_x;
+    area.y1 = pos_p->y + (dsc->font->line_height - dsc->font->base_line) - g.box_h - g.ofs_y;
+    area.x2 = area.x1 + g.box_w - 1;
+    area.y2 = area.y1 + g.box_h - 1;
+
+    if (!_lv_area_is_on(&area, draw_ctx->clip_area)) {
+        return true;
+    }
+    if (lv_draw_mask_is_any(&area)) {
+        return false;
+    }
+
+    cache_key_t key;
+    memset(&key, 0, sizeof(key));
+    uint64_t p = (uintptr_t)g.resolved_font;
+    key.w[0] = (uint32_t)p;
+    key.w[1] = (uint32_t)(p >> 32);
+    key.w[2] = letter;
+
+    glyph_job_t job = {g.resolved_font, &g, letter};
+    lv_opa_t *sprite = (lv_opa_t *)cache_store_get(&glyph_store, &key, (size_t)g.box_w * g.box_h, glyph_fill, &job);
+    if (!sprite) {
+        return false;
+    }
+
+    // The blender clips against the draw area and reads the mask with the sprite stride
+    lv_draw_sw_blend_dsc_t blend;
+    lv_memset_00(&blend, sizeof(blend));
+    blend.blend_area = &area;
+    blend.mask_area = &area;
+    blend.mask_buf = sprite;
+    blend.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    blend.color = dsc->color;
+    blend.opa = dsc->opa;
+    blend.blend_mode = dsc->blend_mode;
+    lv_draw_sw_blend(draw_ctx, &blend);
+    return true;
+}
+
+static void glyph_cache_draw_letter(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc,
+                                    const lv_point_t *pos_p, uint32_t letter)
+{
+    int64_t start = GLYPH_TIME();
+    if (glyph_enabled && glyph_cache_draw(draw_ctx, dsc, pos_p, letter)) {
+        glyph_stats.cached_draws++;
+        glyph_stats.cached_us += GLYPH_TIME() - start;
+        return;
+    }
+
+    glyph_prev_draw_letter(draw_ctx, dsc, pos_p, letter);
+
+    if (lv_font_get_line_height(dsc->font) >= glyph_min_height) {
+        glyph_stats.direct_draws++;
+        glyph_stats.direct_us += GLYPH_TIME() - start;
+    }
+}
+
+static void glyph_cache_draw_ctx_init(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx)
+{
+    glyph_prev_ctx_init(drv, draw_ctx);
+    glyph_prev_draw_letter = draw_ctx->draw_letter;
+    draw_ctx->draw_letter = glyph_cache_draw_letter;
+}
+
+bool glyph_cache_init(size_t capacity, lv_coord_t min_height, uint32_t caps)
+{
+    if (glyph_ready) {
+        return true;
+    }
+    if (!cache_store_init(&glyph_store, "glyph", capacity, GLYPH_CACHE_MAX_ENTRIES, caps)) {
+        ESP_LOGE(TAG, "No memory for cache table");
+        return false;
+    }
+    glyph_min_height = min_height;
+    glyph_ready = true;
+    ESP_LOGI(TAG, "Glyph sprite cache %u KB, glyphs >= %d px", (unsigned)(capacity / 1024), (int)min_height);
+    return true;
+}
+
+void glyph_cache_install(lv_disp_drv_t *drv)
+{
+    if (!glyph_ready || drv->draw_ctx_init == glyph_cache_draw_ctx_init) {
+        return;
+    }
+    glyph_prev_ctx_init = drv->draw_ctx_init;
+    drv->draw_ctx_init = glyph_cache_draw_ctx_init;
+}
+
+void glyph_cache_set_enabled(bool enabled)
+{
+    glyph_enabled = enabled;
+}
+
+void glyph_cache_get_stats(glyph_cache_stats_t *stats)
+{
+    *stats = glyph_stats;
+    if (glyph_ready) {
+        cache_store_get_stats(&glyph_store, &stats->store);
+    }
+}
+
+void glyph_cache_reset_stats()
+{
+    memset(&glyph_stats, 0, sizeof(glyph_stats));
+}
+
+void glyph_cache_dump()
+{
+    if (!glyph_ready) {
+        return;
+    }
+    cache_store_dump(&glyph_store);
+#if CONFIG_LILYGO_GLYPH_CACHE_TIMING
+    printf("  cached draws:%lu avg:%lu us  direct draws:%lu avg:%lu us\n",
+           (unsigned long)glyph_stats.cached_draws,
+           (unsigned long)(glyph_stats.cached_draws ? glyph_stats.cached_us / glyph_stats.cached_draws : 0),
+           (unsigned long)glyph_stats.direct_draws,
+           (unsigned long)(glyph_stats.direct_draws ? glyph_stats.direct_us / glyph_stats.direct_draws : 0));
+#else
+    printf("  cached draws:%lu  direct draws:%lu\n",
+           (unsigned long)glyph_stats.cached_draws, (unsigned long)glyph_stats.direct_draws);
+#endif
+}
+
+#endif
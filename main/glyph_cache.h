@@ -0,0 +1,51 @@
+/**
+ * @file      glyph_cache.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "lvgl.h"
+#include "cache_store.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    cache_stats_t store;
+    uint32_t cached_draws;
+    uint32_t direct_draws;      // Glyphs of large fonts drawn by the stock renderer
+    uint64_t cached_us;         // CONFIG_LILYGO_GLYPH_CACHE_TIMING only
+    uint64_t direct_us;
+} glyph_cache_stats_t;
+
+/*
+ * Glyph sprite cache.
+ * Glyphs at least `min_height` pixels tall are unpacked once per font and
+ * letter into an A8 coverage sprite. Later draws blend the sprite with the
+ * label colour in a single call instead of unpacking the font bitmap again,
+ * so one sprite serves every colour the glyph is drawn in.
+ */
+bool glyph_cache_init(size_t capacity, lv_coord_t min_height, uint32_t caps);
+
+// Hook the draw context of `drv`, call after lv_disp_drv_init()
+void glyph_cache_install(lv_disp_drv_t *drv);
+
+// Disabled draws go to the stock renderer and are timed, for A/B comparison
+void glyph_cache_set_enabled(bool enabled);
+
+void glyph_cache_get_stats(glyph_cache_stats_t *stats);
+
+void glyph_cache_reset_stats();
+
+void glyph_cache_dump();
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,397 @@
+/**
+ * @file      i2c_discovery.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include "product_pins.h"
+#include "i2c_driver.h"
+#include "i2c_sched.h"
+#include "nvs_store.h"
+#include "i2c_discovery.h"
+
+#ifdef BOARD_I2C_SDA
+
+#define DISCOVERY_FIRST_ADDRESS     0x08        // 0x00-0x07 and 0x78-0x7F are reserved
+#define DISCOVERY_LAST_ADDRESS      0x77
+#define DISCOVERY_PROBE_TIMEOUT_MS  5
+#define DISCOVERY_ID_SPEED_HZ       100000
+#define DISCOVERY_STACK_SIZE        3072
+#define DISCOVERY_DONE_BIT          BIT0
+
+#define DISCOVERY_NS                "board"
+#define DISCOVERY_KEY               "i2c_map"
+#define DISCOVERY_VERSION           1
+
+#if CONFIG_LILYGO_T_AMOLED_LITE_147
+#define DISCOVERY_BOARD             "T-AMOLED-Lite-1.47"
+#elif CONFIG_LILYGO_T_DISPLAY_S3_AMOLED
+#define DISCOVERY_BOARD             "T-Display-S3-AMOLED"
+#elif CONFIG_LILYGO_T_DISPLAY_S3_AMOLED_TOUCH
+#define DISCOVERY_BOARD             "T-Display-S3-AMOLED-Touch"
+#elif CONFIG_LILYGO_T4_S3_241
+#define DISCOVERY_BOARD             "T4-S3-2.41"
+#elif CONFIG_LILYGO_T_DISPLAY_S3_PRO
+#define DISCOVERY_BOARD             "T-Display-S3-Pro"
+#elif CONFIG_LILYGO_T_DISPLAY_S3
+#define DISCOVERY_BOARD             "T-Display-S3"
+#elif CONFIG_LILYGO_T_DISPLAY_LONG
+#define DISCOVERY_BOARD             "T-Display-S3-Long"
+#elif CONFIG_LILYGO_T_QT_C6
+#define DISCOVERY_BOARD             "T-QT-C6"
+#elif CONFIG_LILYGO_T_RGB
+#define DISCOVERY_BOARD             "T-RGB"
+#elif CONFIG_LILYGO_T_WATCH_S3
+#define DISCOVERY_BOARD             "T-Watch-S3"
+#else
+#define DISCOVERY_BOARD             "unknown"
+#endif
+
+typedef struct {
+    const char *chip;
+    uint8_t address;
+    uint8_t alt_address;        // second strap option, 0 for none
+    uint8_t id_reg;             // register holding a chip ID, read when id_mask is set
+    uint8_t id_mask;
+    uint8_t id_value;
+} i2c_chip_t;
+
+/*
+ * What the boards of this repo carry. A chip with an ID register is only
+ * named after it answered with its ID, the others are a hint from the
+ * address alone. 0x5A is the DRV2605 on T-Watch-S3 and the CST226SE touch
+ * elsewhere, the DRV2605 ID tells them apart.
+ */
+static const i2c_chip_t known_chips[] = {
+    {"GT911",     0x5D, 0x14, 0,    0,    0},
+    {"CST816",    0x15, 0,    0xA7, 0xFC, 0xB4},    // B4-B7 by variant, asleep it does not answer
+    {"BMA423",    0x19, 0,    0x00, 0xFF, 0x13},
+    {"XL9555",    0x20, 0,    0,    0,    0},
+    {"CHSC5816",  0x2E, 0,    0,    0,    0},
+    {"AXP2101",   0x34, 0,    0x03, 0xFF, 0x4A},
+    {"FT6X36",    0x38, 0,    0xA8, 0xFF, 0x11},    // FocalTech vendor ID
+    {"AXS15231B", 0x3B, 0,    0,    0,    0},
+    {"PCF8563",   0x51, 0,    0,    0,    0},
+    {"DRV2605",   0x5A, 0,    0x00, 0x60, 0x60},    // DEVICE_ID 3 (DRV2605) or 7 (DRV2605L)
+    {"CST226SE",  0x5A, 0,    0,    0,    0},
+    {"SY6970",    0x6A, 0,    0,    0,    0},
+};
+
+#define CHIP_COUNT  (sizeof(known_chips) / sizeof(known_chips[0]))
+
+typedef struct {
+    uint32_t board;             // FNV-1a of DISCOVERY_BOARD
+    uint8_t version;
+    uint8_t reserved[3];
+    uint32_t present[4];        // one bit per 7-bit address
+} i2c_map_record_t;
+
+typedef enum {
+    MAP_NONE,
+    MAP_CACHED,                 // last boot's map
+    MAP_SCANNED,
+} map_state_t;
+
+static const char *TAG = "i2c_discovery";
+
+static uint32_t present[4];
+static map_state_t map_state = MAP_NONE;
+static uint8_t chip_at[128];            // known_chips index + 1 of a chip that gave its ID
+static portMUX_TYPE map_lock = portMUX_INITIALIZER_UNLOCKED;
+static EventGroupHandle_t events = NULL;
+static int scan_dev = -1;
+static bool scan_started = false;
+
+static uint32_t board_hash(void)
+{
+    uint32_t h = 2166136261u;
+    for (const char *p = DISCOVERY_BOARD; *p; p++) {
+        h = (h ^ (uint8_t)*p) * 16777619u;
+    }
+    return h;
+}
+
+static bool map_bit(const uint32_t *map, uint8_t address)
+{
+    return map[address >> 5] & (1u << (address & 31));
+}
+
+static void map_set(uint32_t *map, uint8_t address, bool on)
+{
+    if (on) {
+        map[address >> 5] |= 1u << (address & 31);
+    } else {
+        map[address >> 5] &= ~(1u << (address & 31));
+    }
+}
+
+typedef struct {
+    uint8_t address;
+    bool found;
+} probe_t;
+
+// A NACK is an answer, not a bus error
+static int probe_cb(void *arg)
+{
+    probe_t *p = (probe_t *)arg;
+    p->found = i2c_master_probe(bus_handle, p->address, DISCOVERY_PROBE_TIMEOUT_MS) == ESP_OK;
+    return 0;
+}
+
+// Touch and IO jobs may take the bus between two addresses
+static bool probe_live(uint8_t address)
+{
+    probe_t p = {address, false};
+    return i2c_sched_call(scan_dev, I2C_SCHED_PRIO_TELEMETRY, probe_cb, &p) == ESP_OK && p.found;
+}
+
+static bool chip_at_address(const i2c_chip_t *chip, uint8_t address)
+{
+    return chip->address == address || (chip->alt_address && chip->alt_address == address);
+}
+
+typedef struct {
+    uint8_t address;
+    uint8_t reg;
+    uint8_t value;
+} id_read_t;
+
+static int id_read_cb(void *arg)
+{
+    id_read_t *r = (id_read_t *)arg;
+    i2c_device_config_t cfg = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = r->address,
+        .scl_speed_hz = DISCOVERY_ID_SPEED_HZ,
+    };
+    i2c_master_dev_handle_t dev;
+    if (i2c_master_bus_add_device(bus_handle, &cfg, &dev) != ESP_OK) {
+        return -1;
+    }
+    esp_err_t ret = i2c_master_transmit_receive(dev, &r->reg, 1, &r->value, 1, DISCOVERY_PROBE_TIMEOUT_MS);
+    i2c_master_bus_rm_device(dev);
+    return ret == ESP_OK ? 0 : -1;
+}
+
+// Index + 1 of the chip whose ID register matches, 0 when none does
+static uint8_t identify(uint8_t address)
+{
+    for (size_t i = 0; i < CHIP_COUNT; i++) {
+        const i2c_chip_t *chip = &known_chips[i];
+        if (!chip->id_mask || !chip_at_address(chip, address)) {
+            continue;
+        }
+        id_read_t r = {address, chip->id_reg, 0};
+        if (i2c_sched_call(scan_dev, I2C_SCHED_PRIO_TELEMETRY, id_read_cb, &r) == ESP_OK &&
+                (r.value & chip->id_mask) == chip->id_value) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static void discovery_task(void *arg)
+{
+    int64_t start = esp_timer_get_time();
+    uint32_t found[4] = {0};
+    uint8_t ids[128] = {0};
+    for (uint8_t address = DISCOVERY_FIRST_ADDRESS; address <= DISCOVERY_LAST_ADDRESS; address++) {
+        bool on = probe_live(address);
+        map_set(found, address, on);
+        if (on) {
+            ids[address] = identify(address);
+        }
+    }
+
+    taskENTER_CRITICAL(&map_lock);
+    uint32_t cached[4];
+    memcpy(cached, present, sizeof(cached));
+    memcpy(present, found, sizeof(found));
+    memcpy(chip_at, ids, sizeof(ids));
+    map_state_t was = map_state;
+    map_state = MAP_SCANNED;
+    taskEXIT_CRITICAL(&map_lock);
+    xEventGroupSetBits(events, DISCOVERY_DONE_BIT);
+
+    ESP_LOGI(TAG, "scan done in %lld ms", (long long)((esp_timer_get_time() - start) / 1000));
+    for (uint8_t address = DISCOVERY_FIRST_ADDRESS; was == MAP_CACHED && address <= DISCOVERY_LAST_ADDRESS; address++) {
+        if (map_bit(cached, address) != map_bit(found, address)) {
+            ESP_LOGW(TAG, "0x%02x %s since the last boot", address, map_bit(found, address) ? "appeared" : "is gone");
+        }
+    }
+    // No flash write when the map matches the stored one
+    i2c_map_record_t record = {.board = board_hash(), .version = DISCOVERY_VERSION};
+    memcpy(record.present, found, sizeof(found));
+    nvs_store_save(DISCOVERY_NS, DISCOVERY_KEY, &record, sizeof(record));
+    vTaskDelete(NULL);
+}
+
+static esp_err_t discovery_scan(void)
+{
+    taskENTER_CRITICAL(&map_lock);
+    bool started = scan_started;
+    scan_started = true;
+    taskEXIT_CRITICAL(&map_lock);
+    if (started) {
+        return ESP_OK;
+    }
+    if (xTaskCreate(discovery_task, "i2c_scan", DISCOVERY_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+        scan_started = false;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t i2c_discovery_start(void)
+{
+    if (events) {
+        return ESP_OK;
+    }
+    events = xEventGroupCreate();
+    if (!events) {
+        return ESP_ERR_NO_MEM;
+    }
+    scan_dev = i2c_sched_device("scan", 0, 0);
+
+    i2c_map_record_t record;
+    if (nvs_store_load(DISCOVERY_NS, DISCOVERY_KEY, &record, sizeof(record)) &&
+            record.version == DISCOVERY_VERSION && record.board == board_hash()) {
+        taskENTER_CRITICAL(&map_lock);
+        memcpy(present, record.present, sizeof(present));
+        map_state = MAP_CACHED;
+        taskEXIT_CRITICAL(&map_lock);
+    }
+
+#if CONFIG_LILYGO_I2C_DISCOVERY
+    return discovery_scan();
+#else
+    return ESP_OK;
+#endif
+}
+
+bool i2c_discovery_wait(uint32_t timeout_ms)
+{
+    if (!events) {
+        return false;
+    }
+    // Without the boot scan the first caller starts it
+    if (discovery_scan() != ESP_OK) {
+        return false;
+    }
+    return xEventGroupWaitBits(events, DISCOVERY_DONE_BIT, pdFALSE, pdTRUE, pdMS_TO_TICKS(timeout_ms)) &
+           DISCOVERY_DONE_BIT;
+}
+
+bool i2c_discovery_probe(uint8_t address)
+{
+    if (address > 0x7F) {
+        return false;
+    }
+    taskENTER_CRITICAL(&map_lock);
+    bool on = map_bit(present, address);
+    taskEXIT_CRITICAL(&map_lock);
+    if (on) {
+        return true;
+    }
+
+    // Absent may only mean asleep, unpowered or in reset when the map was taken
+    on = probe_live(address);
+    if (on) {
+        taskENTER_CRITICAL(&map_lock);
+        map_set(present, address, true);
+        taskEXIT_CRITICAL(&map_lock);
+    }
+    return on;
+}
+
+const char *i2c_discovery_chip(uint8_t address, bool *verified)
+{
+    *verified = false;
+    if (address > 0x7F) {
+        return NULL;
+    }
+    taskENTER_CRITICAL(&map_lock);
+    uint8_t id = chip_at[address];
+    taskEXIT_CRITICAL(&map_lock);
+    if (id) {
+        *verified = true;
+        return known_chips[id - 1].chip;
+    }
+    // No ID answered, the first chip without an ID register that can sit here
+    for (size_t i = 0; i < CHIP_COUNT; i++) {
+        if (!known_chips[i].id_mask && chip_at_address(&known_chips[i], address)) {
+            return known_chips[i].chip;
+        }
+    }
+    return NULL;
+}
+
+void i2c_discovery_print(FILE *out)
+{
+    uint32_t map[4];
+    taskENTER_CRITICAL(&map_lock);
+    memcpy(map, present, sizeof(map));
+    map_state_t state = map_state;
+    taskEXIT_CRITICAL(&map_lock);
+
+    fprintf(out, "%s bus map (%s):\n", DISCOVERY_BOARD,
+            state == MAP_SCANNED ? "scanned" : state == MAP_CACHED ? "cached" : "not scanned");
+    fprintf(out, "     0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f\n");
+    for (int i = 0; i < 128; i += 16) {
+        fprintf(out, "%02x: ", i);
+        for (int j = 0; j < 16; j++) {
+            if (map_bit(map, i + j)) {
+                fprintf(out, "%02x ", i + j);
+            } else {
+                fprintf(out, "-- ");
+            }
+        }
+        fprintf(out, "\n");
+    }
+    for (int address = 0; address < 128; address++) {
+        if (map_bit(map, address)) {
+            bool verified;
+            const char *chip = i2c_discovery_chip(address, &verified);
+            fprintf(out, "  0x%02x  %s%s\n", address, chip ? chip : "unknown", chip && !verified ? " (by address)" : "");
+        }
+    }
+}
+
+#else
+
+esp_err_t i2c_discovery_start(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+bool i2c_discovery_wait(uint32_t timeout_ms)
+{
+    return false;
+}
+
+bool i2c_discovery_probe(uint8_t address)
+{
+    return false;
+}
+
+const char *i2c_discovery_chip(uint8_t address, bool *verified)
+{
+    *verified = false;
+    return NULL;
+}
+
+void i2c_discovery_print(FILE *out)
+{
+    fputs("board has no I2C bus\n", out);
+}
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * @file      i2c_discovery.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Map of the devices on the board bus. The map of the last boot is loaded
+ * from NVS at start, then a low priority task rescans the bus with short
+ * probe timeouts through the I2C scheduler and stores the map again if it
+ * changed. Nothing of the scan runs on the boot path.
+ */
+esp_err_t i2c_discovery_start(void);
+
+// Wait for this boot's scan, false on timeout
+bool i2c_discovery_wait(uint32_t timeout_ms);
+
+/*
+ * Whether a device answers at address. A device in the map, scanned or
+ * cached, is taken as present. An absent one is probed live, it may have
+ * been asleep or unpowered when the map was taken.
+ */
+bool i2c_discovery_probe(uint8_t address);
+
+/*
+ * Likely chip at address, NULL if none is known there. verified is set when
+ * the chip answered this boot's scan with its ID register, otherwise the
+ * name is only what the boards of this repo carry at that address.
+ */
+const char *i2c_discovery_chip(uint8_t address, bool *verified);
+
+void i2c_discovery_print(FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
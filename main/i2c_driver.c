@@ -17,6 +17,9 @@
 #include "product_pins.h"
 #include "driver/i2c_master.h"
 #include "soc/clk_tree_defs.h"
+#include "axs_touch.h"
+#include "i2c_sched.h"
+#include "i2c_discovery.h"
 
 #ifdef BOARD_I2C_SDA
 
@@ -26,38 +29,23 @@
 #define I2C_MASTER_SDA_IO           (gpio_num_t) BOARD_I2C_SDA
 #define I2C_MASTER_SCL_IO           (gpio_num_t) BOARD_I2C_SCL
 
+#define I2C_SCAN_WAIT_MS            2000
+
 i2c_master_bus_handle_t bus_handle;
 
 
 
 void i2c_drv_scan()
 {
-    esp_err_t err = ESP_OK;
-    uint8_t address = 0x00;
-    printf("Scand I2C Devices:\n");
-    printf("     0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f\r\n");
-    for (int i = 0; i < 128; i += 16) {
-        printf("%02x: ", i);
-        for (int j = 0; j < 16; j++) {
-            fflush(stdout);
-            address = i + j;
-            err = i2c_master_probe(bus_handle, address, 1000);
-            if (err == ESP_OK) {
-                printf("%02x ", address);
-            } else if (err == ESP_ERR_TIMEOUT) {
-                printf("UU ");
-            } else {
-                printf("-- ");
-            }
-        }
-        printf("\r\n");
+    if (!i2c_discovery_wait(I2C_SCAN_WAIT_MS)) {
+        printf("I2C scan still running, showing the cached map\n");
     }
-    printf("\n\n\n");
+    i2c_discovery_print(stdout);
 }
 
 bool i2c_drv_probe(uint8_t devAddr)
 {
-    return ESP_OK == i2c_master_probe(bus_handle, devAddr, 1000);
+    return i2c_discovery_probe(devAddr);
 }
 
 
@@ -73,11 +61,33 @@ esp_err_t i2c_driver_init(void)
     i2c_bus_config.scl_io_num = I2C_MASTER_SCL_IO;
     i2c_bus_config.sda_io_num = I2C_MASTER_SDA_IO;
     i2c_bus_config.glitch_ignore_cnt = 7;
-    return i2c_new_master_bus(&i2c_bus_config, &bus_handle);
+#if CONFIG_LILYGO_T_DISPLAY_LONG
+    // Only the touch controller sits on this bus, its reads run asynchronously
+    i2c_bus_config.trans_queue_depth = AXS_TOUCH_QUEUE_DEPTH;
+#endif
+    esp_err_t ret = i2c_new_master_bus(&i2c_bus_config, &bus_handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = i2c_sched_start(bus_handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return i2c_discovery_start();
 }
 
 #else
 
+void i2c_drv_scan()
+{
+    i2c_discovery_print(stdout);
+}
+
+bool i2c_drv_probe(uint8_t devAddr)
+{
+    return false;
+}
+
 esp_err_t i2c_driver_init(void)
 {
     return ESP_OK;
@@ -16,6 +16,7 @@ extern "C" {
 
 esp_err_t i2c_driver_init(void);
 void i2c_drv_scan();
+bool i2c_drv_probe(uint8_t devAddr);
 
 extern i2c_master_bus_handle_t bus_handle;
 #ifdef __cplusplus
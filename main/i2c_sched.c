@@ -0,0 +1,394 @@
+/**
+ * @file      i2c_sched.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "i2c_sched.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include "trace_ring.h"
+#define SCHED_LOCK(s)       xSemaphoreTake((SemaphoreHandle_t)(s)->lock, portMAX_DELAY)
+#define SCHED_UNLOCK(s)     xSemaphoreGive((SemaphoreHandle_t)(s)->lock)
+#else
+#define SCHED_LOCK(s)
+#define SCHED_UNLOCK(s)
+#endif
+
+static bool job_before(const i2c_sched_job_t *a, const i2c_sched_job_t *b)
+{
+    if (a->priority != b->priority) {
+        return a->priority < b->priority;
+    }
+    int64_t da = a->deadline_us ? a->deadline_us : INT64_MAX;
+    int64_t db = b->deadline_us ? b->deadline_us : INT64_MAX;
+    if (da != db) {
+        return da < db;
+    }
+    return (int32_t)(a->seq - b->seq) < 0;
+}
+
+int i2c_sched_init(i2c_sched_t *s, const i2c_sched_bus_t *bus)
+{
+    memset(s, 0, sizeof(*s));
+    s->bus = *bus;
+#ifdef ESP_PLATFORM
+    s->lock = xSemaphoreCreateMutex();
+    if (!s->lock) {
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+int i2c_sched_add_device(i2c_sched_t *s, const char *name, uint8_t address)
+{
+    int id = -1;
+    SCHED_LOCK(s);
+    if (s->device_count < I2C_SCHED_MAX_DEVICES) {
+        id = s->device_count++;
+        s->stats[id].name = name;
+        s->stats[id].address = address;
+    }
+    SCHED_UNLOCK(s);
+    return id;
+}
+
+void i2c_sched_submit(i2c_sched_t *s, i2c_sched_job_t *job)
+{
+    job->result = 0;
+    job->next = 0;
+    job->submit_us = s->bus.now(s->bus.user);
+
+    SCHED_LOCK(s);
+    job->seq = s->seq++;
+    i2c_sched_job_t **p = &s->queue;
+    while (*p && !job_before(job, *p)) {
+        p = &(*p)->link;
+    }
+    job->link = *p;
+    *p = job;
+    SCHED_UNLOCK(s);
+}
+
+// Called with the lock held
+static void sched_unlink(i2c_sched_t *s, i2c_sched_job_t *job)
+{
+    for (i2c_sched_job_t **p = &s->queue; *p; p = &(*p)->link) {
+        if (*p == job) {
+            *p = job->link;
+            break;
+        }
+    }
+}
+
+static void sched_finish(i2c_sched_job_t *jobs)
+{
+    while (jobs) {
+        i2c_sched_job_t *next = jobs->link;
+        if (jobs->done) {
+            jobs->done(jobs);
+        }
+        jobs = next;
+    }
+}
+
+bool i2c_sched_step(i2c_sched_t *s)
+{
+    i2c_sched_job_t *missed = NULL;
+    i2c_sched_job_t *job;
+
+    SCHED_LOCK(s);
+    int64_t now = s->bus.now(s->bus.user);
+    // A job that could not start in time is dropped, a started batch always finishes
+    while ((job = s->queue) && !job->next && job->deadline_us && now > job->deadline_us) {
+        s->queue = job->link;
+        s->stats[job->device].missed++;
+        job->result = I2C_SCHED_MISSED;
+        job->link = missed;
+        missed = job;
+    }
+    if (job && s->last && s->last != job) {
+        s->stats[s->last->device].preempted++;
+    }
+    if (job && !job->next) {
+        i2c_sched_stats_t *st = &s->stats[job->device];
+        uint32_t wait = (uint32_t)(now - job->submit_us);
+        st->wait_us += wait;
+        if (wait > st->wait_max_us) {
+            st->wait_max_us = wait;
+        }
+    }
+    SCHED_UNLOCK(s);
+
+    if (!job) {
+        sched_finish(missed);
+        return missed != NULL;
+    }
+
+    // The bus is released to the queue between transfers unless the batch is atomic
+    size_t end = job->atomic ? job->count : job->next + 1;
+    uint32_t xfers = 0, bytes = 0;
+    int64_t start = s->bus.now(s->bus.user);
+    while (job->next < end) {
+        const i2c_sched_xfer_t *x = &job->xfers[job->next++];
+        int ret = s->bus.xfer(s->bus.user, job->device, x);
+        xfers++;
+        bytes += x->tx_len + x->rx_len;
+        if (ret != 0) {
+            job->result = ret;
+            break;
+        }
+    }
+    uint32_t busy = (uint32_t)(s->bus.now(s->bus.user) - start);
+
+    bool finished = job->result != 0 || job->next == job->count;
+    SCHED_LOCK(s);
+    // Counted under the lock, the console reads them from another task
+    i2c_sched_stats_t *st = &s->stats[job->device];
+    st->xfers += xfers;
+    st->bytes += bytes;
+    st->errors += job->result != 0;
+    st->busy_us += busy;
+    if (busy > st->busy_max_us) {
+        st->busy_max_us = busy;
+    }
+    if (finished) {
+        sched_unlink(s, job);
+        st->jobs++;
+        s->last = NULL;
+        job->link = missed;
+        missed = job;
+    } else {
+        s->last = job;
+    }
+    SCHED_UNLOCK(s);
+
+    sched_finish(missed);
+    return true;
+}
+
+void i2c_sched_get_stats(i2c_sched_t *s, uint8_t device, i2c_sched_stats_t *stats)
+{
+    SCHED_LOCK(s);
+    *stats = s->stats[device];
+    SCHED_UNLOCK(s);
+}
+
+void i2c_sched_print(i2c_sched_t *s, FILE *out)
+{
+    fprintf(out, "device      addr   jobs  xfers   bytes  err miss  pre  wait avg/max us  busy avg/max us\n");
+    for (uint8_t i = 0; i < s->device_count; i++) {
+        i2c_sched_stats_t st;
+        i2c_sched_get_stats(s, i, &st);
+        fprintf(out, "%-10s  0x%02x %6lu %6lu %7lu %4lu %4lu %4lu  %7lu/%-7lu  %7lu/%-7lu\n",
+                st.name, st.address, (unsigned long)st.jobs, (unsigned long)st.xfers, (unsigned long)st.bytes,
+                (unsigned long)st.errors, (unsigned long)st.missed, (unsigned long)st.preempted,
+                (unsigned long)(st.jobs ? st.wait_us / st.jobs : 0), (unsigned long)st.wait_max_us,
+                (unsigned long)(st.xfers ? st.busy_us / st.xfers : 0), (unsigned long)st.busy_max_us);
+    }
+}
+
+#ifdef ESP_PLATFORM
+
+#define I2C_SCHED_TIMEOUT_MS    50
+#define I2C_SCHED_STACK_SIZE    3072
+#define I2C_SCHED_PRIORITY      6       // above the touch reader
+
+static const char *TAG = "i2c_sched";
+
+static i2c_sched_t sched;
+static bool started = false;
+static i2c_master_bus_handle_t sched_bus = NULL;
+static i2c_master_dev_handle_t handles[I2C_SCHED_MAX_DEVICES];
+// Task running transfers right now, its own nested jobs skip the queue
+static TaskHandle_t bus_owner = NULL;
+#if CONFIG_LILYGO_I2C_SCHED
+static TaskHandle_t worker = NULL;
+#else
+static SemaphoreHandle_t runner = NULL;
+#endif
+
+static int i2c_sched_esp_xfer(void *user, uint8_t device, const i2c_sched_xfer_t *x)
+{
+    if (x->call) {
+        return x->call(x->arg);
+    }
+    i2c_master_dev_handle_t h = handles[device];
+    if (!h) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t ret;
+    if (x->tx_len && x->rx_len) {
+        ret = i2c_master_transmit_receive(h, x->tx, x->tx_len, x->rx, x->rx_len, I2C_SCHED_TIMEOUT_MS);
+    } else if (x->rx_len) {
+        ret = i2c_master_receive(h, x->rx, x->rx_len, I2C_SCHED_TIMEOUT_MS);
+    } else {
+        ret = i2c_master_transmit(h, x->tx, x->tx_len, I2C_SCHED_TIMEOUT_MS);
+    }
+    trace_i2c(sched.stats[device].address, x->tx_len ? x->tx[0] : 0, x->tx_len + x->rx_len, ret,
+              esp_timer_get_time() - start_us);
+    return ret;
+}
+
+static int64_t i2c_sched_esp_now(void *user)
+{
+    return esp_timer_get_time();
+}
+
+#if CONFIG_LILYGO_I2C_SCHED
+static void i2c_sched_task(void *arg)
+{
+    bus_owner = xTaskGetCurrentTaskHandle();
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (i2c_sched_step(&sched)) {
+        }
+    }
+}
+
+static void i2c_sched_wake(i2c_sched_job_t *job)
+{
+    xSemaphoreGive((SemaphoreHandle_t)job->user);
+}
+#endif
+
+esp_err_t i2c_sched_start(i2c_master_bus_handle_t bus)
+{
+    if (started) {
+        return ESP_OK;
+    }
+    i2c_sched_bus_t ops = {
+        .xfer = i2c_sched_esp_xfer,
+        .now = i2c_sched_esp_now,
+    };
+    if (i2c_sched_init(&sched, &ops) != 0) {
+        return ESP_ERR_NO_MEM;
+    }
+    sched_bus = bus;
+#if CONFIG_LILYGO_I2C_SCHED
+    if (xTaskCreate(i2c_sched_task, "i2c_sched", I2C_SCHED_STACK_SIZE, NULL, I2C_SCHED_PRIORITY, &worker) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+#else
+    runner = xSemaphoreCreateMutex();
+    if (!runner) {
+        return ESP_ERR_NO_MEM;
+    }
+#endif
+    started = true;
+    return ESP_OK;
+}
+
+int i2c_sched_device(const char *name, uint8_t address, uint32_t speed_hz)
+{
+    if (!started) {
+        return -1;
+    }
+    // Drivers retrying their init get the same slot back
+    for (int i = 0; i < sched.device_count; i++) {
+        if (sched.stats[i].address == address && !strcmp(sched.stats[i].name, name)) {
+            return i;
+        }
+    }
+    int id = i2c_sched_add_device(&sched, name, address);
+    if (id < 0 || !address) {
+        return id;
+    }
+    i2c_device_config_t cfg = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = address,
+        .scl_speed_hz = speed_hz,
+    };
+    esp_err_t ret = i2c_master_bus_add_device(sched_bus, &cfg, &handles[id]);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "add %s @0x%02x: %s", name, address, esp_err_to_name(ret));
+        handles[id] = NULL;
+        return -1;
+    }
+    return id;
+}
+
+esp_err_t i2c_sched_run(i2c_sched_job_t *job)
+{
+    if (!started || bus_owner == xTaskGetCurrentTaskHandle()) {
+        // No scheduler, or a call job that does its own transfers: the bus is already ours
+        for (size_t i = 0; i < job->count; i++) {
+            if (!started && !job->xfers[i].call) {
+                return ESP_ERR_INVALID_STATE;
+            }
+            int ret = i2c_sched_esp_xfer(NULL, job->device, &job->xfers[i]);
+            if (ret != 0) {
+                return ret;
+            }
+        }
+        return ESP_OK;
+    }
+
+#if CONFIG_LILYGO_I2C_SCHED
+    StaticSemaphore_t sem_buf;
+    SemaphoreHandle_t sem = xSemaphoreCreateBinaryStatic(&sem_buf);
+    job->done = i2c_sched_wake;
+    job->user = sem;
+    i2c_sched_submit(&sched, job);
+    xTaskNotifyGive(worker);
+    xSemaphoreTake(sem, portMAX_DELAY);
+    vSemaphoreDelete(sem);
+#else
+    job->done = NULL;
+    xSemaphoreTake(runner, portMAX_DELAY);
+    bus_owner = xTaskGetCurrentTaskHandle();
+    i2c_sched_submit(&sched, job);
+    while (i2c_sched_step(&sched)) {
+    }
+    bus_owner = NULL;
+    xSemaphoreGive(runner);
+#endif
+    return job->result == I2C_SCHED_MISSED ? ESP_ERR_TIMEOUT : job->result;
+}
+
+esp_err_t i2c_sched_read(int device, uint8_t priority, uint8_t reg, uint8_t *data, size_t len)
+{
+    i2c_sched_xfer_t xfer = {.tx = &reg, .tx_len = 1, .rx = data, .rx_len = len};
+    i2c_sched_job_t job = {.device = device, .priority = priority, .xfers = &xfer, .count = 1};
+    return i2c_sched_run(&job);
+}
+
+esp_err_t i2c_sched_write(int device, uint8_t priority, const uint8_t *data, size_t len)
+{
+    i2c_sched_xfer_t xfer = {.tx = data, .tx_len = len};
+    i2c_sched_job_t job = {.device = device, .priority = priority, .xfers = &xfer, .count = 1};
+    return i2c_sched_run(&job);
+}
+
+esp_err_t i2c_sched_call(int device, uint8_t priority, int (*call)(void *arg), void *arg)
+{
+    i2c_sched_xfer_t xfer = {.call = call, .arg = arg};
+    i2c_sched_job_t job = {.device = device < 0 ? 0 : device, .priority = priority, .xfers = &xfer, .count = 1};
+    if (device < 0) {
+        // Not registered, e.g. a board without the shared bus
+        return call(arg);
+    }
+    return i2c_sched_run(&job);
+}
+
+void i2c_sched_dump(FILE *out)
+{
+    if (!started) {
+        fputs("i2c scheduler not started\n", out);
+        return;
+    }
+    i2c_sched_print(&sched, out);
+}
+
+#endif
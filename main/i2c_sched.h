@@ -0,0 +1,137 @@
+/**
+ * @file      i2c_sched.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define I2C_SCHED_MAX_DEVICES   8
+#define I2C_SCHED_MISSED        (-2)    // job result when the deadline passed before it started
+
+typedef enum {
+    I2C_SCHED_PRIO_TOUCH,       // most urgent first
+    I2C_SCHED_PRIO_IO,
+    I2C_SCHED_PRIO_TELEMETRY,
+} i2c_sched_prio_t;
+
+/*
+ * One bus transaction: write tx then read rx with a repeated start, either
+ * may be empty. Drivers that talk to the bus themselves pass call instead,
+ * it runs with the bus to itself and returns 0 on success.
+ */
+typedef struct {
+    const uint8_t *tx;
+    size_t tx_len;
+    uint8_t *rx;
+    size_t rx_len;
+    int (*call)(void *arg);
+    void *arg;
+} i2c_sched_xfer_t;
+
+typedef struct i2c_sched_job {
+    uint8_t device;
+    uint8_t priority;
+    bool atomic;                // keep the batch together, no pre-emption between transfers
+    int64_t deadline_us;        // latest start, 0 for none
+    const i2c_sched_xfer_t *xfers;
+    size_t count;
+    void (*done)(struct i2c_sched_job *job);
+    void *user;
+
+    // Owned by the scheduler
+    int result;
+    size_t next;
+    uint32_t seq;
+    int64_t submit_us;
+    struct i2c_sched_job *link;
+} i2c_sched_job_t;
+
+// Performs one transfer for a device, returns 0 on success
+typedef struct {
+    int (*xfer)(void *user, uint8_t device, const i2c_sched_xfer_t *xfer);
+    int64_t (*now)(void *user);
+    void *user;
+} i2c_sched_bus_t;
+
+typedef struct {
+    const char *name;
+    uint8_t address;
+    uint32_t jobs;
+    uint32_t xfers;
+    uint32_t bytes;
+    uint32_t errors;
+    uint32_t missed;            // dropped, deadline passed before the first transfer
+    uint32_t preempted;         // times another job ran between two of its transfers
+    uint32_t wait_max_us;
+    uint32_t busy_max_us;
+    uint64_t wait_us;           // submit to first transfer
+    uint64_t busy_us;           // time on the bus
+} i2c_sched_stats_t;
+
+typedef struct {
+    i2c_sched_bus_t bus;
+    i2c_sched_job_t *queue;
+    i2c_sched_job_t *last;      // job of the previous transfer
+    uint32_t seq;
+    uint8_t device_count;
+    i2c_sched_stats_t stats[I2C_SCHED_MAX_DEVICES];
+    void *lock;
+} i2c_sched_t;
+
+/*
+ * Jobs queue by priority, then earliest deadline, then submission order.
+ * Each step runs one transfer of the front job, so a touch read submitted
+ * while telemetry is mid-batch goes next. Atomic batches run in one step.
+ * Jobs live in caller memory until done() is called.
+ */
+int i2c_sched_init(i2c_sched_t *s, const i2c_sched_bus_t *bus);
+
+// Stats slot and transfer target, returns the device id or -1 when full
+int i2c_sched_add_device(i2c_sched_t *s, const char *name, uint8_t address);
+
+void i2c_sched_submit(i2c_sched_t *s, i2c_sched_job_t *job);
+
+// Run one transfer, false when nothing was queued
+bool i2c_sched_step(i2c_sched_t *s);
+
+void i2c_sched_get_stats(i2c_sched_t *s, uint8_t device, i2c_sched_stats_t *stats);
+void i2c_sched_print(i2c_sched_t *s, FILE *out);
+
+#ifdef ESP_PLATFORM
+#include "esp_err.h"
+#include "driver/i2c_master.h"
+
+/*
+ * The board bus. With CONFIG_LILYGO_I2C_SCHED a worker task drains the
+ * queue, otherwise jobs run in the caller one at a time.
+ */
+esp_err_t i2c_sched_start(i2c_master_bus_handle_t bus);
+
+// Add a device to the bus, address 0 keeps a stats slot for call-only users
+int i2c_sched_device(const char *name, uint8_t address, uint32_t speed_hz);
+
+// Submit and wait for completion. Without a started scheduler call jobs run inline.
+esp_err_t i2c_sched_run(i2c_sched_job_t *job);
+
+esp_err_t i2c_sched_read(int device, uint8_t priority, uint8_t reg, uint8_t *data, size_t len);
+esp_err_t i2c_sched_write(int device, uint8_t priority, const uint8_t *data, size_t len);
+esp_err_t i2c_sched_call(int device, uint8_t priority, int (*call)(void *arg), void *arg);
+
+void i2c_sched_dump(FILE *out);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
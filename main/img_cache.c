@@ -0,0 +1,236 @@
+/**
+ * @file      img_cache.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <sdkconfig.h>
+#include <string.h>
+#include "esp_log.h"
+#include "img_cache.h"
+
+#if CONFIG_LILYGO_IMG_CACHE
+
+#define IMG_CACHE_MAX_ENTRIES   64
+
+enum {
+    IMG_KEY_VARIABLE = 1,
+    IMG_KEY_FILE,
+};
+
+static const char *TAG = "IMG_CACHE";
+static cache_store_t img_store;
+static lv_img_decoder_t *img_decoder = NULL;
+// img_cache_pin() pins, kept apart from the pins open decoders hold
+static cache_key_t user_pins[IMG_CACHE_MAX_ENTRIES];
+static uint16_t user_pin_count = 0;
+
+static bool img_cache_make_key(cache_key_t *key, const void *src, lv_color_t color)
+{
+    memset(key, 0, sizeof(*key));
+    switch (lv_img_src_get_type(src)) {
+    case LV_IMG_SRC_VARIABLE: {
+        uint64_t p = (uintptr_t)src;
+        key->w[0] = IMG_KEY_VARIABLE;
+        key->w[1] = (uint32_t)p;
+        key->w[2] = (uint32_t)(p >> 32);
+        break;
+    }
+    case LV_IMG_SRC_FILE: {
+        // The path string is usually not static, key on its content. The
+        // entry keeps the full path too, a hash match alone is not trusted.
+        const char *path = (const char *)src;
+        uint32_t h = 5381;
+        size_t len = 0;
+        while (path[len]) {
+            h = (h * 33) ^ (uint8_t)path[len++];
+        }
+        key->w[0] = IMG_KEY_FILE;
+        key->w[1] = h;
+        key->w[2] = (uint32_t)len;
+        break;
+    }
+    default:
+        return false;
+    }
+    key->w[3] = color.full;
+    return true;
+}
+
+static size_t img_cache_decoded_size(const lv_img_header_t *header)
+{
+    switch (header->cf) {
+    case LV_IMG_CF_TRUE_COLOR:
+    case LV_IMG_CF_TRUE_COLOR_ALPHA:
+    case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+        // read_line() hands out the raw pixels for these formats
+        return (size_t)header->w * header->h * (lv_img_cf_get_px_size(header->cf) >> 3);
+    case LV_IMG_CF_INDEXED_1BIT:
+    case LV_IMG_CF_INDEXED_2BIT:
+    case LV_IMG_CF_INDEXED_4BIT:
+    case LV_IMG_CF_INDEXED_8BIT:
+    case LV_IMG_CF_ALPHA_1BIT:
+    case LV_IMG_CF_ALPHA_2BIT:
+    case LV_IMG_CF_ALPHA_4BIT:
+        return (size_t)header->w * header->h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    case LV_IMG_CF_ALPHA_8BIT:
+        // Drawn from img_data as one byte per pixel, not the colour + alpha read_line() hands out
+        return 0;
+    default:
+        return 0;
+    }
+}
+
+static bool img_cache_fill(void *buf, size_t size, void *user_data)
+{
+    lv_img_decoder_dsc_t *dsc = (lv_img_decoder_dsc_t *)user_data;
+    size_t stride = size / dsc->header.h;
+    uint8_t *p = (uint8_t *)buf;
+    for (lv_coord_t y = 0; y < (lv_coord_t)dsc->header.h; y++) {
+        if (lv_img_decoder_built_in_read_line(dsc->decoder, dsc, 0, y, dsc->header.w, p) != LV_RES_OK) {
+            return false;
+        }
+        p += stride;
+    }
+    return true;
+}
+
+static lv_res_t img_cache_decoder_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    lv_res_t res = lv_img_decoder_built_in_open(decoder, dsc);
+    if (res != LV_RES_OK || dsc->img_data != NULL) {
+        // Failed, or the pixels can be addressed directly (e.g. C arrays in flash)
+        return res;
+    }
+
+    cache_key_t key;
+    size_t size = img_cache_decoded_size(&dsc->header);
+    if (size == 0 || !img_cache_make_key(&key, dsc->src, dsc->color)) {
+        return res;
+    }
+
+    // File entries end with their path, checked on every hit
+    const char *path = lv_img_src_get_type(dsc->src) == LV_IMG_SRC_FILE ? (const char *)dsc->src : "";
+    size_t path_len = path[0] ? strlen(path) + 1 : 0;
+    size_t cached = 0;
+    uint8_t *data = (uint8_t *)cache_store_lookup(&img_store, &key, &cached);
+    if (data) {
+        if (cached != size + path_len || memcmp(data + size, path, path_len) != 0) {
+            // Another path with the same hash holds the entry, decode this one line by line
+            return res;
+        }
+    } else {
+        data = (uint8_t *)cache_store_insert(&img_store, &key, size + path_len);
+        if (!data) {
+            // Fall back to line by line decoding
+            return res;
+        }
+        if (!img_cache_fill(data, size, dsc)) {
+            cache_store_remove(&img_store, &key);
+            return res;
+        }
+        memcpy(data + size, path, path_len);
+    }
+
+    // Hold the entry until LVGL closes the image
+    cache_store_pin(&img_store, &key);
+    lv_img_decoder_built_in_close(decoder, dsc);
+    dsc->img_data = data;
+    return LV_RES_OK;
+}
+
+static void img_cache_decoder_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    if (dsc->img_data && cache_store_unpin_data(&img_store, dsc->img_data)) {
+        dsc->img_data = NULL;
+        return;
+    }
+    lv_img_decoder_built_in_close(decoder, dsc);
+}
+
+bool img_cache_init(size_t capacity)
+{
+    if (img_decoder) {
+        return true;
+    }
+    if (!cache_store_init(&img_store, "image", capacity, IMG_CACHE_MAX_ENTRIES, CACHE_STORE_CAPS_PSRAM)) {
+        ESP_LOGE(TAG, "No memory for cache table");
+        return false;
+    }
+    img_decoder = lv_img_decoder_create();
+    if (!img_decoder) {
+        cache_store_deinit(&img_store);
+        return false;
+    }
+    lv_img_decoder_set_info_cb(img_decoder, lv_img_decoder_built_in_info);
+    lv_img_decoder_set_open_cb(img_decoder, img_cache_decoder_open);
+    lv_img_decoder_set_read_line_cb(img_decoder, lv_img_decoder_built_in_read_line);
+    lv_img_decoder_set_close_cb(img_decoder, img_cache_decoder_close);
+    ESP_LOGI(TAG, "Decoded image cache %u KB", (unsigned)(capacity / 1024));
+    return true;
+}
+
+bool img_cache_pin(const void *src, lv_color_t color)
+{
+    cache_key_t key;
+    if (!img_decoder || user_pin_count == IMG_CACHE_MAX_ENTRIES || !img_cache_make_key(&key, src, color)) {
+        return false;
+    }
+    // Opening through the decoder chain loads the entry if it is not cached yet
+    lv_img_decoder_dsc_t dsc;
+    if (lv_img_decoder_open(&dsc, src, color, 0) != LV_RES_OK) {
+        return false;
+    }
+    // Served line by line when another path holds the entry, nothing to pin then
+    bool pinned = dsc.img_data && cache_store_pin(&img_store, &key);
+    lv_img_decoder_close(&dsc);
+    if (pinned) {
+        user_pins[user_pin_count++] = key;
+    }
+    return pinned;
+}
+
+void img_cache_unpin_all()
+{
+    // Images still open keep their decoder pin
+    for (uint16_t i = 0; i < user_pin_count; i++) {
+        cache_store_unpin(&img_store, &user_pins[i]);
+    }
+    user_pin_count = 0;
+}
+
+void img_cache_invalidate(const void *src)
+{
+    cache_key_t key;
+    if (!img_decoder || !img_cache_make_key(&key, src, lv_color_black())) {
+        return;
+    }
+    // Drop every colour variant of the source
+    for (uint16_t i = 0; i < img_store.max_entries; i++) {
+        cache_entry_t *e = &img_store.entries[i];
+        if (e->used && !e->pins && memcmp(e->key.w, key.w, 3 * sizeof(uint32_t)) == 0) {
+            cache_key_t victim = e->key;
+            cache_store_remove(&img_store, &victim);
+        }
+    }
+}
+
+void img_cache_get_stats(cache_stats_t *stats)
+{
+    if (img_decoder) {
+        cache_store_get_stats(&img_store, stats);
+    } else {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+void img_cache_dump()
+{
+    if (img_decoder) {
+        cache_store_dump(&img_store);
+    }
+}
+
+#endif
@@ -0,0 +1,41 @@
+/**
+ * @file      img_cache.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "lvgl.h"
+#include "cache_store.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Decoded image cache.
+ * Registers an image decoder in front of the LVGL built-in one. Images that
+ * the built-in decoder can only read line by line (indexed, alpha-only, file
+ * sources) are decoded once into PSRAM and served from there afterwards.
+ * All functions must be called with the LVGL lock held.
+ */
+bool img_cache_init(size_t capacity);
+
+bool img_cache_pin(const void *src, lv_color_t color);
+
+void img_cache_unpin_all();
+
+void img_cache_invalidate(const void *src);
+
+void img_cache_get_stats(cache_stats_t *stats);
+
+void img_cache_dump();
+
+#ifdef __cplusplus
+}
+#endif
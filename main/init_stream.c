@@ -0,0 +1,97 @@
+/**
+ * @file      init_stream.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include "init_stream.h"
+#include "boot_trace.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#else
+#include <time.h>
+#endif
+
+const uint8_t *init_stream_decode(const uint8_t *p, init_stream_item_t *item)
+{
+    uint8_t op = *p++;
+    if (op == INIT_STREAM_OP_END) {
+        item->op = INIT_STREAM_END;
+        return p - 1;
+    }
+    if (op == INIT_STREAM_OP_DELAY) {
+        item->op = INIT_STREAM_DELAY;
+        item->delay_ms = *p++;
+        return p;
+    }
+    item->op = INIT_STREAM_CMD;
+    item->len = op;
+    item->cmd = *p++;
+    item->param = p;
+    return p + op;
+}
+
+static void init_stream_delay(const init_stream_ops_t *ops, uint32_t ms)
+{
+    if (ops->delay) {
+        ops->delay(ops->user, ms);
+        return;
+    }
+#ifdef ESP_PLATFORM
+    vTaskDelay(pdMS_TO_TICKS(ms));
+#else
+    struct timespec ts = {ms / 1000, (long)(ms % 1000) * 1000000L};
+    nanosleep(&ts, NULL);
+#endif
+}
+
+uint32_t init_stream_run(const init_stream_t *stream, const init_stream_ops_t *ops)
+{
+    const uint8_t *p = stream->data;
+    init_stream_item_t item;
+    uint32_t sent = 0;
+    int span = boot_trace_begin("init_stream");
+
+    // Commands between two delays go out back to back, the driver may queue them
+    for (;;) {
+        p = init_stream_decode(p, &item);
+        if (item.op == INIT_STREAM_CMD) {
+            ops->write(ops->user, item.cmd, item.param, item.len);
+            sent++;
+            continue;
+        }
+        if (ops->flush) {
+            ops->flush(ops->user);
+        }
+        if (item.op == INIT_STREAM_END) {
+            break;
+        }
+        init_stream_delay(ops, item.delay_ms);
+    }
+    boot_trace_end(span);
+    return sent;
+}
+
+bool init_stream_find(const init_stream_t *stream, uint8_t cmd, const uint8_t **param, uint8_t *len)
+{
+    const uint8_t *p = stream->data;
+    init_stream_item_t item;
+    bool found = false;
+
+    for (;;) {
+        p = init_stream_decode(p, &item);
+        if (item.op == INIT_STREAM_END) {
+            break;
+        }
+        if (item.op == INIT_STREAM_CMD && item.cmd == cmd) {
+            *param = item.param;
+            *len = item.len;
+            found = true;
+        }
+    }
+    return found;
+}
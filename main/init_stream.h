@@ -0,0 +1,159 @@
+/**
+ * @file      init_stream.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Packed panel init stream:
+ *
+ *   n cmd p0 .. pn-1     command with n (0..INIT_STREAM_MAX_PARAMS) parameters
+ *   0xFE ms              delay ms milliseconds
+ *   0xFF                 end of stream
+ */
+#define INIT_STREAM_MAX_PARAMS  (32)
+#define INIT_STREAM_OP_DELAY    (0xFE)
+#define INIT_STREAM_OP_END      (0xFF)
+
+typedef struct {
+    const uint8_t *data;
+    uint16_t size;
+    uint16_t cmds;
+} init_stream_t;
+
+typedef enum {
+    INIT_STREAM_CMD,
+    INIT_STREAM_DELAY,
+    INIT_STREAM_END,
+} init_stream_op_t;
+
+typedef struct {
+    init_stream_op_t op;
+    uint8_t cmd;
+    uint8_t len;
+    const uint8_t *param;
+    uint16_t delay_ms;
+} init_stream_item_t;
+
+typedef struct {
+    // Send or queue one command, param is only valid during the call
+    void (*write)(void *user, uint8_t cmd, const uint8_t *param, uint8_t len);
+    // Wait for queued commands, called before every delay and at the end. Optional
+    void (*flush)(void *user);
+    // Defaults to vTaskDelay when NULL
+    void (*delay)(void *user, uint32_t ms);
+    void *user;
+} init_stream_ops_t;
+
+const uint8_t *init_stream_decode(const uint8_t *p, init_stream_item_t *item);
+
+uint32_t init_stream_run(const init_stream_t *stream, const init_stream_ops_t *ops);
+
+// Parameters of the last occurrence of cmd in the stream
+bool init_stream_find(const init_stream_t *stream, uint8_t cmd, const uint8_t **param, uint8_t *len);
+
+#ifdef __cplusplus
+}
+
+#include <array>
+
+/*
+ * Compile time packing of readable lcd_cmd_t style tables. Every driver used
+ * to give the length byte its own flag meanings, the layout spells them out.
+ */
+namespace init_stream
+{
+
+struct layout {
+    uint8_t cmd_shift;          // QSPI tables keep the command in bits 15..8
+    uint8_t len_mask;
+    bool len_has_cmd;           // length counts the command byte as well
+    uint8_t delay_flag[2];
+    uint8_t delay_ms[2];
+};
+
+// Not constexpr, so reaching it fails the compile time evaluation
+inline void entry_has_too_many_params() {}
+
+template <typename T, size_t N>
+constexpr size_t packed_size(const T (&tbl)[N], const layout &l)
+{
+    size_t size = 1;
+    for (size_t i = 0; i < N; i++) {
+        if (tbl[i].len == 0xFF) {
+            break;
+        }
+        uint32_t n = tbl[i].len & l.len_mask;
+        if (l.len_has_cmd && n) {
+            n--;
+        }
+        size += 2 + n;
+        for (int d = 0; d < 2; d++) {
+            if (l.delay_flag[d] && (tbl[i].len & l.delay_flag[d])) {
+                size += 2;
+            }
+        }
+    }
+    return size;
+}
+
+template <typename T, size_t N>
+constexpr uint16_t command_count(const T (&tbl)[N])
+{
+    uint16_t count = 0;
+    for (size_t i = 0; i < N && tbl[i].len != 0xFF; i++) {
+        count++;
+    }
+    return count;
+}
+
+template <size_t S, typename T, size_t N>
+constexpr std::array<uint8_t, S> pack(const T (&tbl)[N], const layout &l)
+{
+    std::array<uint8_t, S> out{};
+    size_t o = 0;
+    for (size_t i = 0; i < N; i++) {
+        if (tbl[i].len == 0xFF) {
+            break;
+        }
+        uint32_t n = tbl[i].len & l.len_mask;
+        if (l.len_has_cmd && n) {
+            n--;
+        }
+        if (n > INIT_STREAM_MAX_PARAMS || n > sizeof(tbl[i].param)) {
+            entry_has_too_many_params();
+        }
+        out[o++] = (uint8_t)n;
+        out[o++] = (uint8_t)(tbl[i].addr >> l.cmd_shift);
+        for (uint32_t k = 0; k < n; k++) {
+            out[o++] = tbl[i].param[k];
+        }
+        for (int d = 0; d < 2; d++) {
+            if (l.delay_flag[d] && (tbl[i].len & l.delay_flag[d])) {
+                out[o++] = INIT_STREAM_OP_DELAY;
+                out[o++] = l.delay_ms[d];
+            }
+        }
+    }
+    out[o++] = INIT_STREAM_OP_END;
+    return out;
+}
+
+} // namespace init_stream
+
+#define INIT_STREAM_PACK(tbl, layout) \
+    init_stream::pack<init_stream::packed_size(tbl, layout)>(tbl, layout)
+
+#endif
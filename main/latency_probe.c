@@ -0,0 +1,198 @@
+/**
+ * @file      latency_probe.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "latency_probe.h"
+
+#if !defined(ESP_PLATFORM) || CONFIG_LILYGO_LATENCY_PROBE
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+static portMUX_TYPE probe_lock = portMUX_INITIALIZER_UNLOCKED;
+#define PROBE_LOCK()        portENTER_CRITICAL_SAFE(&probe_lock)
+#define PROBE_UNLOCK()      portEXIT_CRITICAL_SAFE(&probe_lock)
+#define PROBE_IRAM          IRAM_ATTR
+#else
+#define PROBE_LOCK()
+#define PROBE_UNLOCK()
+#define PROBE_IRAM
+#endif
+
+#define HISTOGRAM_WIDTH     40
+
+typedef enum {
+    PROBE_IDLE,
+    PROBE_TOUCHED,
+    PROBE_TAGGED,
+    PROBE_FLUSHING,
+} probe_state_t;
+
+static struct {
+    probe_state_t state;
+    int64_t touch_us;
+    int16_t x;
+    int16_t y;
+    int16_t tag[4];
+    bool final;
+} probe;
+
+static latency_stats_t stats = {.min_us = UINT32_MAX};
+
+static bool area_has_point(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x, int16_t y)
+{
+    return x >= x1 && x <= x2 && y >= y1 && y <= y2;
+}
+
+static bool area_overlaps_tag(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+    return x1 <= probe.tag[2] && x2 >= probe.tag[0] && y1 <= probe.tag[3] && y2 >= probe.tag[1];
+}
+
+// Called with the lock held
+static bool probe_expired(int64_t now_us)
+{
+    if (probe.state != PROBE_IDLE && now_us - probe.touch_us > LATENCY_PROBE_TIMEOUT_US) {
+        probe.state = PROBE_IDLE;
+        stats.dropped++;
+        return true;
+    }
+    return false;
+}
+
+void latency_probe_touch(int64_t time_us, int16_t x, int16_t y)
+{
+    PROBE_LOCK();
+    probe_expired(time_us);
+    if (probe.state == PROBE_IDLE) {
+        probe.state = PROBE_TOUCHED;
+        probe.touch_us = time_us;
+        probe.x = x;
+        probe.y = y;
+        probe.final = false;
+    }
+    PROBE_UNLOCK();
+}
+
+void latency_probe_invalidate(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+    PROBE_LOCK();
+    if (probe.state == PROBE_TOUCHED && area_has_point(x1, y1, x2, y2, probe.x, probe.y)) {
+        probe.state = PROBE_TAGGED;
+        probe.tag[0] = x1;
+        probe.tag[1] = y1;
+        probe.tag[2] = x2;
+        probe.tag[3] = y2;
+    }
+    PROBE_UNLOCK();
+}
+
+void latency_probe_flush_start(int64_t time_us, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool last)
+{
+    PROBE_LOCK();
+    if (!probe_expired(time_us)) {
+        if ((probe.state == PROBE_TAGGED && area_overlaps_tag(x1, y1, x2, y2)) ||
+                (probe.state == PROBE_TOUCHED && area_has_point(x1, y1, x2, y2, probe.x, probe.y))) {
+            probe.state = PROBE_FLUSHING;
+        }
+        if (probe.state == PROBE_FLUSHING && last) {
+            probe.final = true;
+        }
+    }
+    PROBE_UNLOCK();
+}
+
+void PROBE_IRAM latency_probe_flush_done(int64_t time_us)
+{
+    PROBE_LOCK();
+    if (probe.state == PROBE_FLUSHING && probe.final) {
+        int64_t dt = time_us - probe.touch_us;
+        uint32_t us = dt < 0 ? 0 : dt > UINT32_MAX ? UINT32_MAX : (uint32_t)dt;
+        uint32_t b = us / LATENCY_PROBE_BUCKET_US;
+        stats.bucket[b < LATENCY_PROBE_BUCKETS ? b : LATENCY_PROBE_BUCKETS - 1]++;
+        stats.count++;
+        stats.sum_us += us;
+        if (us < stats.min_us) {
+            stats.min_us = us;
+        }
+        if (us > stats.max_us) {
+            stats.max_us = us;
+        }
+        probe.state = PROBE_IDLE;
+    }
+    PROBE_UNLOCK();
+}
+
+void latency_probe_get(latency_stats_t *out)
+{
+    PROBE_LOCK();
+    *out = stats;
+    PROBE_UNLOCK();
+}
+
+uint32_t latency_stats_percentile(const latency_stats_t *s, int pct)
+{
+    if (!s->count) {
+        return 0;
+    }
+    uint64_t want = ((uint64_t)s->count * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (int i = 0; i < LATENCY_PROBE_BUCKETS - 1; i++) {
+        seen += s->bucket[i];
+        if (seen >= want) {
+            return (i + 1) * LATENCY_PROBE_BUCKET_US;
+        }
+    }
+    return s->max_us;
+}
+
+void latency_probe_print(FILE *out)
+{
+    latency_stats_t s;
+    latency_probe_get(&s);
+    fprintf(out, "touch to photon: %lu samples, %lu dropped\n", (unsigned long)s.count, (unsigned long)s.dropped);
+    if (!s.count) {
+        return;
+    }
+    fprintf(out, "  min %.1f  mean %.1f  p50 <%.0f  p95 <%.0f  max %.1f ms\n", s.min_us / 1000.0,
+            (double)s.sum_us / s.count / 1000.0, latency_stats_percentile(&s, 50) / 1000.0,
+            latency_stats_percentile(&s, 95) / 1000.0, s.max_us / 1000.0);
+
+    uint32_t peak = 0;
+    for (int i = 0; i < LATENCY_PROBE_BUCKETS; i++) {
+        if (s.bucket[i] > peak) {
+            peak = s.bucket[i];
+        }
+    }
+    for (int i = 0; i < LATENCY_PROBE_BUCKETS; i++) {
+        if (!s.bucket[i]) {
+            continue;
+        }
+        int bar = (int)((uint64_t)s.bucket[i] * HISTOGRAM_WIDTH / peak);
+        if (i == LATENCY_PROBE_BUCKETS - 1) {
+            fprintf(out, "  %3d+    ms |", i * LATENCY_PROBE_BUCKET_US / 1000);
+        } else {
+            fprintf(out, "  %3d-%-3d ms |", i * LATENCY_PROBE_BUCKET_US / 1000, (i + 1) * LATENCY_PROBE_BUCKET_US / 1000);
+        }
+        for (int j = 0; j < bar; j++) {
+            fputc('#', out);
+        }
+        fprintf(out, " %lu\n", (unsigned long)s.bucket[i]);
+    }
+}
+
+void latency_probe_reset(void)
+{
+    PROBE_LOCK();
+    memset(&stats, 0, sizeof(stats));
+    stats.min_us = UINT32_MAX;
+    probe.state = PROBE_IDLE;
+    PROBE_UNLOCK();
+}
+
+#endif
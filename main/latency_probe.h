@@ -0,0 +1,85 @@
+/**
+ * @file      latency_probe.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LATENCY_PROBE_BUCKET_US     4000
+#define LATENCY_PROBE_BUCKETS       32          // the last one takes everything slower
+#define LATENCY_PROBE_TIMEOUT_US    1000000     // a touch that drew nothing by then is dropped
+
+typedef struct {
+    uint32_t count;
+    uint32_t dropped;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint32_t bucket[LATENCY_PROBE_BUCKETS];
+} latency_stats_t;
+
+#if !defined(ESP_PLATFORM) || CONFIG_LILYGO_LATENCY_PROBE
+
+/*
+ * Touch to photon latency, one probe in flight at a time:
+ *   touch        a pressed sample as read, the probe starts if idle
+ *   invalidate   the first invalidated area holding the touch point is tagged
+ *   flush_start  a flush over the tagged area (or over the point, when full
+ *                refresh skips invalidation) arms the probe, last marks the
+ *                final flush of that refresh
+ *   flush_done   the final flush leaving the panel IO stops the clock
+ * All times are passed in, so the same pipeline runs on host with a fake
+ * touch source and display. flush_done is safe from ISRs.
+ */
+void latency_probe_touch(int64_t time_us, int16_t x, int16_t y);
+void latency_probe_invalidate(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+void latency_probe_flush_start(int64_t time_us, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool last);
+void latency_probe_flush_done(int64_t time_us);
+
+void latency_probe_get(latency_stats_t *stats);
+
+// Upper bound in us of the bucket holding the pct percentile, 0 with no samples
+uint32_t latency_stats_percentile(const latency_stats_t *stats, int pct);
+
+void latency_probe_print(FILE *out);
+void latency_probe_reset(void);
+
+#else
+
+static inline void latency_probe_touch(int64_t time_us, int16_t x, int16_t y) {}
+static inline void latency_probe_invalidate(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {}
+static inline void latency_probe_flush_start(int64_t time_us, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                             bool last) {}
+static inline void latency_probe_flush_done(int64_t time_us) {}
+static inline void latency_probe_get(latency_stats_t *stats)
+{
+    latency_stats_t empty = {0};
+    *stats = empty;
+}
+static inline uint32_t latency_stats_percentile(const latency_stats_t *stats, int pct)
+{
+    return 0;
+}
+static inline void latency_probe_print(FILE *out) {}
+static inline void latency_probe_reset(void) {}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -114,7 +114,8 @@
 
     /*Allow buffering some shadow calculation.
     *LV_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-    *Caching has LV_SHADOW_CACHE_SIZE^2 RAM cost*/
+    *Caching has LV_SHADOW_CACHE_SIZE^2 RAM cost
+    *Left at 0, CONFIG_LILYGO_RENDER_CACHE keeps many shadows in PSRAM (render_cache.c)*/
     #define LV_SHADOW_CACHE_SIZE 0
 
     /* Set number of maximally cached circle data.
@@ -149,14 +150,15 @@
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
-#define LV_GRADIENT_MAX_STOPS 2
+#define LV_GRADIENT_MAX_STOPS 4
 
 /*Default gradient buffer size.
  *When LVGL calculates the gradient "maps" it can save them into a cache to avoid calculating them again.
  *LV_GRAD_CACHE_DEF_SIZE sets the size of this cache in bytes.
  *If the cache is too small the map will be allocated only while it's required for the drawing.
- *0 mean no caching.*/
-#define LV_GRAD_CACHE_DEF_SIZE 0
+ *0 mean no caching.
+ *With CONFIG_LILYGO_RENDER_CACHE the maps are cached in PSRAM instead and this one stays unallocated*/
+#define LV_GRAD_CACHE_DEF_SIZE (4 * 1024)
 
 /*Allow dithering the gradients (to achieve visual smooth color gradients on limited color depth display)
  *LV_DITHER_GRADIENT implies allocating one or two more lines of the object's rendering surface
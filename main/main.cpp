@@ -24,11 +24,26 @@
 #include "lv_conf.h"
 #include "amoled_driver.h"
 #include "touch_driver.h"
+#include "touch_input.h"
+#include "gesture.h"
+#include "touch_filter.h"
 #include "i2c_driver.h"
 #include "power_driver.h"
+#include "pmu_telemetry.h"
 #include "demos/lv_demos.h"
 #include "tft_driver.h"
 #include "product_pins.h"
+#include "img_cache.h"
+#include "render_cache.h"
+#include "glyph_cache.h"
+#include "boot_stages.h"
+#include "digit_label.h"
+#include "boot_splash.h"
+#include "app_console.h"
+#include "boot_trace.h"
+#include "trace_ring.h"
+#include "latency_probe.h"
+#include "display_pm.h"
 // #define LV_LVGL_H_INCLUDE_SIMPLE 1
 // #include "fonts/industry_black_100.c"
 // #include "fonts/industry_black_60.c"
@@ -45,6 +60,7 @@ static const char *TAG = "main";
 
 #define USB_SYMBOL "\xEF\x8A\x87"
 #define WIFI_SYMBOL "\xEF\x87\xAB"
+#define BATTERY_UPDATE_MS 1000      // picks up the telemetry cache, which refreshes at its own period
 
 static SemaphoreHandle_t lvgl_mux = NULL;
 
@@ -57,41 +73,141 @@ extern "C" {
 
 static void example_lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
+    latency_probe_flush_start(esp_timer_get_time(), area->x1, area->y1, area->x2, area->y2, lv_disp_flush_is_last(drv));
 #if DISPLAY_FULLRESH
     uint32_t w = ( area->x2 - area->x1 + 1 );
     uint32_t h = ( area->y2 - area->y1 + 1 );
+    trace_flush_start(area->x1, area->y1, w, h);
     display_push_colors(area->x1, area->y1, w, h, (uint16_t *)color_map);
+    trace_flush_end();
+    latency_probe_flush_done(esp_timer_get_time());
     lv_disp_flush_ready( drv );
 #else
     int offsetx1 = area->x1;
     int offsetx2 = area->x2;
     int offsety1 = area->y1;
     int offsety2 = area->y2;
+    trace_flush_start(offsetx1, offsety1, offsetx2 - offsetx1 + 1, offsety2 - offsety1 + 1);
     display_push_colors(offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, (uint16_t *)color_map);
 #endif
 }
 
 
 #if BOARD_HAS_TOUCH
+#if CONFIG_LILYGO_TOUCH_FILTER
+static touch_filter_t touch_filter;
+
+// Move a filtered point to where the finger should be when the frame reaches the panel
+static void touch_predict(int16_t *x, int16_t *y)
+{
+    touch_filter_predict(&touch_filter, esp_timer_get_time() + CONFIG_LILYGO_TOUCH_PREDICT_MS * 1000, x, y);
+}
+#endif
+
+// A press that woke the display is held back from the UI until it lifts
+static void touch_wake_filter(lv_indev_data_t *data)
+{
+    static bool swallow = false;
+    if (data->state == LV_INDEV_STATE_PRESSED) {
+        swallow |= display_pm_touch();
+    } else {
+        swallow = false;
+    }
+    if (swallow) {
+        data->state = LV_INDEV_STATE_RELEASED;
+    }
+}
+
 static void example_lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data)
 {
+    if (touch_input_active()) {
+        // Samples come from the IRQ driven reader, the last one holds until the next arrives
+        static touch_sample_t last;
+        touch_sample_t sample;
+        bool more = false;
+        bool fresh = touch_input_read(&sample, &more);
+        if (fresh) {
+            last = sample;
+#if CONFIG_LILYGO_TOUCH_FILTER
+            if (last.count) {
+                touch_filter_update(&touch_filter, last.time_us, &last.points[0].x, &last.points[0].y);
+            } else {
+                touch_filter_reset(&touch_filter);
+            }
+#endif
+        }
+        int16_t x = last.points[0].x;
+        int16_t y = last.points[0].y;
+#if CONFIG_LILYGO_TOUCH_FILTER
+        // Samples still queued are history already, only the newest one is moved ahead
+        if (last.count && !more) {
+            touch_predict(&x, &y);
+        }
+#endif
+        if (fresh && last.count) {
+            latency_probe_touch(last.time_us, x, y);
+        }
+        data->point.x = x;
+        data->point.y = y;
+        data->state = last.count ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+        data->continue_reading = more;
+        touch_wake_filter(data);
+        return;
+    }
+
     int16_t touchpad_x[1] = {0};
     int16_t touchpad_y[1] = {0};
     uint8_t touchpad_cnt = 0;
 
     /* Get coordinates */
+    int64_t read_us = esp_timer_get_time();
     touchpad_cnt = touch_get_data(touchpad_x, touchpad_y, 1);
 
     if (touchpad_cnt > 0) {
+#if CONFIG_LILYGO_TOUCH_FILTER
+        touch_filter_update(&touch_filter, read_us, &touchpad_x[0], &touchpad_y[0]);
+        touch_predict(&touchpad_x[0], &touchpad_y[0]);
+#endif
+        latency_probe_touch(read_us, touchpad_x[0], touchpad_y[0]);
         data->point.x = touchpad_x[0];
         data->point.y = touchpad_y[0];
         data->state = LV_INDEV_STATE_PRESSED;
     } else {
+#if CONFIG_LILYGO_TOUCH_FILTER
+        touch_filter_reset(&touch_filter);
+#endif
         data->state = LV_INDEV_STATE_RELEASED;
     }
+    touch_wake_filter(data);
 }
 #endif
 
+#if CONFIG_LILYGO_LATENCY_PROBE
+static void (*latency_prev_rounder)(lv_disp_drv_t *drv, lv_area_t *area);
+
+// Every invalidated area passes the rounder, the probe tags the one under the touch
+static void latency_rounder_cb(lv_disp_drv_t *drv, lv_area_t *area)
+{
+    if (latency_prev_rounder) {
+        latency_prev_rounder(drv, area);
+    }
+    latency_probe_invalidate(area->x1, area->y1, area->x2, area->y2);
+}
+#endif
+
+static void touch_gesture_cb(const gesture_event_t *e, void *user)
+{
+    // Pinch and rotate repeat on every two finger read, they only go to the trace ring
+    if (e->type == GESTURE_PINCH) {
+        trace_gesture(e->type, e->x, e->y, (int16_t)(e->scale * 100.0f + 0.5f));
+    } else if (e->type == GESTURE_ROTATE) {
+        trace_gesture(e->type, e->x, e->y, (int16_t)e->angle_deg);
+    } else {
+        trace_gesture(e->type, e->x, e->y, 0);
+        ESP_LOGI(TAG, "gesture %s at %d,%d", gesture_name(e->type), e->x, e->y);
+    }
+}
+
 static void example_increase_lvgl_tick(void *arg)
 {
     /* Tell LVGL how many milliseconds has elapsed */
@@ -145,6 +261,8 @@ static lv_obj_t *icon_label;
 static lv_obj_t *current_unit_label;
 static lv_obj_t *target_unit_label;
 static lv_obj_t *heat_status_label;
+static lv_obj_t *heat_level_label;
+static lv_obj_t *battery_label;
 
 static lv_style_t current_temp_style;
 static lv_style_t subtitle_text_style;
@@ -161,10 +279,36 @@ static void set_temp(void * bar, int32_t level)
 {
     lv_bar_set_value((lv_obj_t *)bar, level, LV_ANIM_ON);
     // ESP_LOGI(TAG, "Set bar value: %d", (int) level);
-    // Update the label with the heat level e.g. "HEAT\n50%", "HEAT\n%d%" -> level
-    char temp_str[20];
-    snprintf(temp_str, sizeof(temp_str), "HEAT\n%d%%", (int)level);
-    lv_label_set_text(heat_status_label, temp_str);
+    // Only the digits that changed are redrawn
+    digit_label_set_value(heat_level_label, level);
+}
+
+// Served from the telemetry cache, the UI never reads the PMU itself
+static void battery_update_cb(lv_timer_t *timer)
+{
+    pmu_status_t st;
+    if (!pmu_telemetry_get(&st)) {
+        lv_obj_add_flag(battery_label, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    const char *symbol = LV_SYMBOL_USB;
+    if (st.charging) {
+        symbol = LV_SYMBOL_CHARGE;
+    } else if (st.battery_present && !st.vbus_in) {
+        int p = st.battery_percent >= 0 ? st.battery_percent : 50;
+        symbol = p > 80 ? LV_SYMBOL_BATTERY_FULL : p > 55 ? LV_SYMBOL_BATTERY_3 : p > 30 ? LV_SYMBOL_BATTERY_2 :
+                 p > 10 ? LV_SYMBOL_BATTERY_1 : LV_SYMBOL_BATTERY_EMPTY;
+    }
+    if (st.battery_present && st.battery_percent >= 0) {
+        lv_label_set_text_fmt(battery_label, "%s %d%%", symbol, st.battery_percent);
+    } else if (st.battery_present) {
+        lv_label_set_text_fmt(battery_label, "%s %u.%02uV", symbol, (unsigned)(st.vbat_mv / 1000),
+                              (unsigned)(st.vbat_mv % 1000 / 10));
+    } else {
+        lv_label_set_text_fmt(battery_label, "%s %u.%02uV", symbol, (unsigned)(st.vbus_mv / 1000),
+                              (unsigned)(st.vbus_mv % 1000 / 10));
+    }
+    lv_obj_clear_flag(battery_label, LV_OBJ_FLAG_HIDDEN);
 }
 
 void ui_init() {
@@ -218,9 +362,10 @@ void ui_init() {
     // lv_style_set_bg_grad_color(&style_indic, lv_palette_main(LV_PALETTE_RED));
     // lv_style_set_bg_grad_dir(&style_indic, LV_GRAD_DIR_VER);
 
-    current_temp_label = lv_label_create(screen);
+    current_temp_label = digit_label_create(screen);
     lv_obj_add_style(current_temp_label, &current_temp_style, 0);
-    lv_label_set_text(current_temp_label, "89.5");
+    digit_label_set_format(current_temp_label, 2, 1);
+    digit_label_set_value(current_temp_label, 895);
     lv_obj_align(current_temp_label, LV_ALIGN_TOP_MID, -20, 1);
 
     current_unit_label = lv_label_create(screen);
@@ -263,12 +408,25 @@ void ui_init() {
     lv_label_set_text(wifi_label, WIFI_SYMBOL);
     lv_obj_align(wifi_label, LV_ALIGN_TOP_LEFT, 5, 5);
 
+    battery_label = lv_label_create(screen);
+    lv_obj_add_style(battery_label, &subtitle_text_style, 0);
+    lv_obj_set_style_text_font(battery_label, &lv_font_montserrat_14, 0);
+    lv_obj_align_to(battery_label, wifi_label, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 4);
+    lv_obj_add_flag(battery_label, LV_OBJ_FLAG_HIDDEN);
+    lv_timer_create(battery_update_cb, BATTERY_UPDATE_MS, NULL);
+
     heat_status_label = lv_label_create(screen);
     lv_obj_add_style(heat_status_label, &heat_status_style, 0);
-    lv_label_set_text(heat_status_label, "HEAT\nPOWER");
+    lv_label_set_text(heat_status_label, "HEAT");
     lv_obj_align(heat_status_label, LV_ALIGN_TOP_RIGHT, -3, 0);
     lv_obj_set_style_text_align(heat_status_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
 
+    heat_level_label = digit_label_create(screen);
+    lv_obj_add_style(heat_level_label, &heat_status_style, 0);
+    digit_label_set_format(heat_level_label, 3, 0);
+    digit_label_set_suffix(heat_level_label, "%");
+    lv_obj_align_to(heat_level_label, heat_status_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
+
     lv_obj_t * bar = lv_bar_create(screen);
     lv_obj_remove_style_all(bar);  /*To have a clean start*/
     lv_obj_add_style(bar, &style_bg, 0);
@@ -294,9 +452,7 @@ void ui_init() {
 void ui_update() {
     static int current_temp = 80;
     static int time = 0;
-    char temp_str[20];
-    snprintf(temp_str, sizeof(temp_str), "%d.%d", current_temp, 5);
-    lv_label_set_text(current_temp_label, temp_str);
+    digit_label_set_value(current_temp_label, current_temp * 10 + 5);
 
     current_temp++;
     time++;
@@ -308,27 +464,74 @@ void ui_update() {
     }
 }
 
-extern "C" void app_main(void)
+static void boot_stage_i2c()
 {
-
     ESP_LOGI(TAG, "------ Initialize I2C.");
     i2c_driver_init();
+}
 
+static void boot_stage_power()
+{
     ESP_LOGI(TAG, "------ Initialize PMU.");
     if (!power_driver_init()) {
         ESP_LOGE(TAG, "ERROR :No find PMU ....");
     }
+}
 
+static void boot_stage_touch()
+{
     ESP_LOGI(TAG, "------ Initialize TOUCH.");
-    touch_init();
+#if BOARD_HAS_TOUCH && CONFIG_LILYGO_TOUCH_FILTER
+#if CONFIG_LILYGO_T_HMI
+    touch_filter_config_t filter_cfg = TOUCH_FILTER_CONFIG_RESISTIVE();
+#else
+    touch_filter_config_t filter_cfg = TOUCH_FILTER_CONFIG_DEFAULT();
+#endif
+    filter_cfg.median = CONFIG_LILYGO_TOUCH_MEDIAN;
+    touch_filter_init(&touch_filter, &filter_cfg);
+#endif
+    if (touch_init() && touch_input_start()) {
+        touch_input_set_gesture_cb(touch_gesture_cb, NULL);
+    }
+}
 
+#if CONFIG_LILYGO_BOOT_SPLASH
+extern const uint8_t boot_splash_bin_start[] asm("_binary_boot_splash_bin_start");
+extern const uint8_t boot_splash_bin_end[] asm("_binary_boot_splash_bin_end");
+#endif
+
+static void boot_stage_display()
+{
     ESP_LOGI(TAG, "------ Initialize DISPLAY.");
     display_init();
+#if CONFIG_LILYGO_BOOT_SPLASH
+    int span = boot_trace_begin("boot_splash");
+    boot_splash_show(boot_splash_bin_start, boot_splash_bin_end - boot_splash_bin_start);
+    boot_trace_end(span);
+#endif
+}
 
-
+static void boot_stage_lvgl()
+{
     ESP_LOGI(TAG, "Initialize LVGL library");
+    int span = boot_trace_begin("lv_init");
     lv_init();
+    boot_trace_end(span);
 
+#if CONFIG_LILYGO_IMG_CACHE
+    img_cache_init(CONFIG_LILYGO_IMG_CACHE_SIZE_KB * 1024);
+#endif
+#if CONFIG_LILYGO_RENDER_CACHE
+    render_cache_init(CONFIG_LILYGO_RENDER_CACHE_SIZE_KB * 1024);
+#endif
+#if CONFIG_LILYGO_GLYPH_CACHE
+    glyph_cache_init(CONFIG_LILYGO_GLYPH_CACHE_SIZE_KB * 1024, CONFIG_LILYGO_GLYPH_CACHE_MIN_HEIGHT,
+#if CONFIG_LILYGO_GLYPH_CACHE_IN_PSRAM
+                     CACHE_STORE_CAPS_PSRAM);
+#else
+                     CACHE_STORE_CAPS_INTERNAL);
+#endif
+#endif
 
     // alloc draw buffers used by LVGL
     // it's recommended to choose the size of the draw buffer(s) to be at least 1/10 screen sized
@@ -358,14 +561,73 @@ extern "C" void app_main(void)
     assert(buf2);
     lv_disp_draw_buf_init(&disp_buf, buf1, buf2, AMOLED_HEIGHT * 20);
 #endif
+}
+
+enum {
+    BOOT_STAGE_I2C,
+    BOOT_STAGE_POWER,
+    BOOT_STAGE_TOUCH,
+    BOOT_STAGE_DISPLAY,
+    BOOT_STAGE_LVGL,
+};
+
+#if CONFIG_LILYGO_T_RGB
+// The touch probe selects the panel init table
+#define BOOT_TOUCH_DEPS     (BOOT_STAGE_DEP(BOOT_STAGE_POWER))
+#define BOOT_DISPLAY_DEPS   (BOOT_STAGE_DEP(BOOT_STAGE_POWER) | BOOT_STAGE_DEP(BOOT_STAGE_TOUCH))
+#elif CONFIG_LILYGO_T_DISPLAY_LONG
+// Touch and panel share the reset line, let the panel reset finish first
+#define BOOT_TOUCH_DEPS     (BOOT_STAGE_DEP(BOOT_STAGE_POWER) | BOOT_STAGE_DEP(BOOT_STAGE_DISPLAY))
+#define BOOT_DISPLAY_DEPS   (BOOT_STAGE_DEP(BOOT_STAGE_POWER))
+#else
+#define BOOT_TOUCH_DEPS     (BOOT_STAGE_DEP(BOOT_STAGE_POWER))
+#define BOOT_DISPLAY_DEPS   (BOOT_STAGE_DEP(BOOT_STAGE_POWER))
+#endif
+
+static boot_stage_t boot_stages[] = {
+    {"i2c",     boot_stage_i2c,     0},
+    {"power",   boot_stage_power,   BOOT_STAGE_DEP(BOOT_STAGE_I2C)},
+    {"touch",   boot_stage_touch,   BOOT_TOUCH_DEPS},
+    {"display", boot_stage_display, BOOT_DISPLAY_DEPS},
+    {"lvgl",    boot_stage_lvgl,    0},
+};
+
+extern "C" void app_main(void)
+{
+    const size_t stage_count = sizeof(boot_stages) / sizeof(boot_stages[0]);
+    int app_span = boot_trace_begin("app_main");
+#if CONFIG_LILYGO_PARALLEL_BOOT
+    boot_stages_run(boot_stages, stage_count, true);
+#else
+    boot_stages_run(boot_stages, stage_count, false);
+#endif
+    boot_stages_report(boot_stages, stage_count);
+
+#if CONFIG_LILYGO_T_HMI && CONFIG_LILYGO_HMI_TOUCH_CALIBRATE
+    // Runs on the bare panel, LVGL is not up yet
+    if (board_hmi_touch_calib_wanted()) {
+        board_hmi_touch_calibrate();
+    }
+#endif
 
     ESP_LOGI(TAG, "Register display driver to LVGL");
+    int span = boot_trace_begin("lvgl_register");
     lv_disp_drv_init(&disp_drv);
     disp_drv.hor_res = AMOLED_HEIGHT;
     disp_drv.ver_res = AMOLED_WIDTH;
     disp_drv.flush_cb = example_lvgl_flush_cb;
     disp_drv.draw_buf = &disp_buf;
     disp_drv.full_refresh = DISPLAY_FULLRESH;
+#if CONFIG_LILYGO_RENDER_CACHE
+    render_cache_install(&disp_drv);
+#endif
+#if CONFIG_LILYGO_GLYPH_CACHE
+    glyph_cache_install(&disp_drv);
+#endif
+#if CONFIG_LILYGO_LATENCY_PROBE
+    latency_prev_rounder = disp_drv.rounder_cb;
+    disp_drv.rounder_cb = latency_rounder_cb;
+#endif
     lv_disp_drv_register(&disp_drv);
 
     ESP_LOGI(TAG, "Install LVGL tick timer");
@@ -392,13 +654,19 @@ extern "C" void app_main(void)
 
     lvgl_mux = xSemaphoreCreateRecursiveMutex();
     assert(lvgl_mux);
+    boot_trace_end(span);
 
 
     ESP_LOGI(TAG, "Display LVGL");
     // Lock the mutex due to the LVGL APIs are not thread-safe
     if (example_lvgl_lock(-1)) {
         ESP_LOGI(TAG, "Initialize UI");
+        span = boot_trace_begin("ui_init");
         ui_init();
+        boot_trace_end(span);
+#if CONFIG_LILYGO_DISPLAY_PM
+        display_pm_start();
+#endif
         // Release the mutex
         example_lvgl_unlock();
     }
@@ -416,4 +684,11 @@ extern "C" void app_main(void)
     esp_timer_create(&ui_timer_args, &ui_timer);
     esp_timer_start_periodic(ui_timer, 1000000); // 1 second
 
+    boot_trace_end(app_span);
+    boot_trace_report();
+
+#if CONFIG_LILYGO_CONSOLE
+    app_console_start();
+#endif
+
 }
@@ -0,0 +1,110 @@
+/**
+ * @file      nvs_store.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "esp_log.h"
+#include "nvs_store.h"
+
+#define NVS_STORE_MAX_RECORD    (64)
+
+static const char *TAG = "nvs_store";
+static esp_err_t init_result = ESP_ERR_INVALID_STATE;
+static portMUX_TYPE init_lock = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t init_mutex = NULL;
+
+esp_err_t nvs_store_init(void)
+{
+    // Boot stages may race here, only one of them brings the partition up
+    portENTER_CRITICAL(&init_lock);
+    if (!init_mutex) {
+        init_mutex = xSemaphoreCreateMutex();
+    }
+    portEXIT_CRITICAL(&init_lock);
+
+    xSemaphoreTake(init_mutex, portMAX_DELAY);
+    if (init_result != ESP_OK) {
+        esp_err_t ret = nvs_flash_init();
+        if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+            ESP_LOGW(TAG, "NVS partition is full or outdated, erasing");
+            nvs_flash_erase();
+            ret = nvs_flash_init();
+        }
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "nvs_flash_init failed: %s", esp_err_to_name(ret));
+        }
+        init_result = ret;
+    }
+    xSemaphoreGive(init_mutex);
+    return init_result;
+}
+
+bool nvs_store_load(const char *ns, const char *key, void *data, size_t len)
+{
+    if (nvs_store_init() != ESP_OK) {
+        return false;
+    }
+    nvs_handle_t handle;
+    if (nvs_open(ns, NVS_READONLY, &handle) != ESP_OK) {
+        return false;
+    }
+    size_t size = len;
+    esp_err_t ret = nvs_get_blob(handle, key, data, &size);
+    nvs_close(handle);
+    return ret == ESP_OK && size == len;
+}
+
+esp_err_t nvs_store_save(const char *ns, const char *key, const void *data, size_t len)
+{
+    if (len <= NVS_STORE_MAX_RECORD) {
+        uint8_t current[NVS_STORE_MAX_RECORD];
+        if (nvs_store_load(ns, key, current, len) && memcmp(current, data, len) == 0) {
+            return ESP_OK;
+        }
+    }
+    esp_err_t ret = nvs_store_init();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    nvs_handle_t handle;
+    ret = nvs_open(ns, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_set_blob(handle, key, data, len);
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "saving %s/%s failed: %s", ns, key, esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+esp_err_t nvs_store_erase(const char *ns, const char *key)
+{
+    esp_err_t ret = nvs_store_init();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    nvs_handle_t handle;
+    ret = nvs_open(ns, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_erase_key(handle, key);
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    return ret;
+}
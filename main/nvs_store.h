@@ -0,0 +1,36 @@
+/**
+ * @file      nvs_store.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Small fixed-size records kept in the default NVS partition, e.g. probe
+ * results that let the next boot skip detection. The partition is brought
+ * up on first use and erased if it was written by an incompatible version.
+ */
+esp_err_t nvs_store_init(void);
+
+// True only if the record exists and has exactly len bytes
+bool nvs_store_load(const char *ns, const char *key, void *data, size_t len);
+
+// Skips the flash write when the stored record is already identical
+esp_err_t nvs_store_save(const char *ns, const char *key, const void *data, size_t len);
+
+esp_err_t nvs_store_erase(const char *ns, const char *key);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,101 @@
+/**
+ * @file      pmu_decode.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include "pmu_decode.h"
+
+static uint16_t axp_dc1_mv(uint8_t v)
+{
+    return 1500 + (v & 0x1F) * 100;
+}
+
+// DC2 stops at 87, DC4 keeps 20 mV steps above it, DC3 switches to 100 mV
+static uint16_t axp_dc23_mv(uint8_t v)
+{
+    v &= 0x7F;
+    if (v <= 70) {
+        return 500 + v * 10;
+    }
+    if (v <= 87) {
+        return 1220 + (v - 71) * 20;
+    }
+    return 1600 + (v - 88) * 100;
+}
+
+static uint16_t axp_dc4_mv(uint8_t v)
+{
+    v &= 0x7F;
+    return v <= 70 ? 500 + v * 10 : 1220 + (v - 71) * 20;
+}
+
+static uint16_t axp_dc5_mv(uint8_t v)
+{
+    return 1400 + (v & 0x1F) * 100;
+}
+
+static uint16_t axp_ldo100_mv(uint8_t v)
+{
+    return 500 + (v & 0x1F) * 100;
+}
+
+static uint16_t axp_ldo50_mv(uint8_t v)
+{
+    return 500 + (v & 0x1F) * 50;
+}
+
+const axp2101_rail_t axp2101_rails[] = {
+    {"DC1",     0x80, 0, 0x82, axp_dc1_mv},
+    {"DC2",     0x80, 1, 0x83, axp_dc23_mv},
+    {"DC3",     0x80, 2, 0x84, axp_dc23_mv},
+    {"DC4",     0x80, 3, 0x85, axp_dc4_mv},
+    {"DC5",     0x80, 4, 0x86, axp_dc5_mv},
+    {"ALDO1",   0x90, 0, 0x92, axp_ldo100_mv},
+    {"ALDO2",   0x90, 1, 0x93, axp_ldo100_mv},
+    {"ALDO3",   0x90, 2, 0x94, axp_ldo100_mv},
+    {"ALDO4",   0x90, 3, 0x95, axp_ldo100_mv},
+    {"BLDO1",   0x90, 4, 0x96, axp_ldo100_mv},
+    {"BLDO2",   0x90, 5, 0x97, axp_ldo100_mv},
+    {"CPUSLDO", 0x90, 6, 0x98, axp_ldo50_mv},
+    {"DLDO1",   0x90, 7, 0x99, axp_ldo100_mv},
+    {"DLDO2",   0x91, 0, 0x9A, axp_ldo50_mv},
+};
+
+const size_t axp2101_rail_count = sizeof(axp2101_rails) / sizeof(axp2101_rails[0]);
+
+bool axp2101_rail_on(const axp2101_rail_t *rail, const uint8_t *regs)
+{
+    return regs[rail->enable_reg - AXP2101_REG_DC_ONOFF] & (1 << rail->enable_bit);
+}
+
+uint16_t axp2101_rail_mv(const axp2101_rail_t *rail, const uint8_t *regs)
+{
+    return rail->mv(regs[rail->voltage_reg - AXP2101_REG_DC_ONOFF]);
+}
+
+void axp2101_decode_status(const uint8_t *status, const uint8_t *adc, uint8_t percent, pmu_status_t *st)
+{
+    st->battery_present = status[0] & 0x08;
+    st->vbus_in = (status[0] & 0x20) && !(status[1] & 0x08);
+    st->charging = ((status[1] >> 5) & 0x03) == 0x01;
+    st->vbat_mv = st->battery_present ? ((adc[0] & 0x1F) << 8) | adc[1] : 0;
+    st->vbus_mv = st->vbus_in ? ((adc[4] & 0x3F) << 8) | adc[5] : 0;
+    st->vsys_mv = ((adc[6] & 0x3F) << 8) | adc[7];
+    st->battery_percent = st->battery_present ? (int8_t)percent : -1;
+}
+
+void sy6970_decode_status(const uint8_t *regs, pmu_status_t *st)
+{
+    // Status, fault, VINDPM, BATV, SYSV, TSPCT, VBUSV, ICHGR
+    uint8_t chrg_stat = (regs[0] >> 3) & 0x03;
+    st->battery_present = regs[3] & 0x7F;
+    st->vbus_in = regs[6] & 0x80;
+    st->charging = chrg_stat == 0x01 || chrg_stat == 0x02;
+    st->vbat_mv = st->battery_present ? 2304 + (regs[3] & 0x7F) * 20 : 0;
+    st->vsys_mv = 2304 + (regs[4] & 0x7F) * 20;
+    st->vbus_mv = st->vbus_in ? 2600 + (regs[6] & 0x7F) * 100 : 0;
+    st->battery_percent = -1;
+}
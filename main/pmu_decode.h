@@ -0,0 +1,73 @@
+/**
+ * @file      pmu_decode.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AXP2101_REG_STATUS1     0x00
+#define AXP2101_REG_ADC_VBAT_H  0x34
+#define AXP2101_REG_DC_ONOFF    0x80
+#define AXP2101_REG_DLDO2_VOL   0x9A
+#define AXP2101_REG_BAT_PERCENT 0xA4
+
+#define AXP2101_STATUS_REGS     2
+#define AXP2101_ADC_REGS        8       // VBAT, TS, VBUS, VSYS
+#define AXP2101_RAIL_REGS       (AXP2101_REG_DLDO2_VOL - AXP2101_REG_DC_ONOFF + 1)
+
+#define SY6970_REG_FIRST        0x00
+#define SY6970_REG_STATUS       0x0B
+#define SY6970_REG_LAST         0x14
+
+#define SY6970_STATUS_REGS      8       // 0x0B-0x12
+
+typedef struct {
+    uint16_t vbat_mv;
+    uint16_t vbus_mv;
+    uint16_t vsys_mv;
+    int8_t battery_percent;     // -1 when the PMU has no gauge or no battery
+    bool battery_present;
+    bool vbus_in;
+    bool charging;
+    int64_t updated_us;         // esp_timer time of the read
+} pmu_status_t;
+
+typedef struct {
+    const char *name;
+    uint8_t enable_reg;
+    uint8_t enable_bit;
+    uint8_t voltage_reg;
+    uint16_t (*mv)(uint8_t);
+} axp2101_rail_t;
+
+// DC1-DC5, ALDO1-4, BLDO1-2, CPUSLDO, DLDO1-2
+extern const axp2101_rail_t axp2101_rails[];
+extern const size_t axp2101_rail_count;
+
+/*
+ * Register bursts as read from the chip, decoded without touching the bus:
+ *   rail       regs holds 0x80-0x9A
+ *   AXP2101    status holds 0x00-0x01, adc 0x34-0x3B, percent 0xA4
+ *   SY6970     regs holds 0x0B-0x12
+ * updated_us is left to the caller.
+ */
+bool axp2101_rail_on(const axp2101_rail_t *rail, const uint8_t *regs);
+uint16_t axp2101_rail_mv(const axp2101_rail_t *rail, const uint8_t *regs);
+
+void axp2101_decode_status(const uint8_t *status, const uint8_t *adc, uint8_t percent, pmu_status_t *st);
+void sy6970_decode_status(const uint8_t *regs, pmu_status_t *st);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,213 @@
+/**
+ * @file      pmu_telemetry.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "product_pins.h"
+#include "pmu_telemetry.h"
+#include "i2c_sched.h"
+
+#if CONFIG_PMU_AXP2101 || CONFIG_PMU_SY6970
+
+#define PMU_I2C_SPEED_HZ        400000
+#define PMU_TASK_STACK_SIZE     3072
+
+static const char *TAG = "pmu";
+
+static int pmu_dev = -1;
+static uint32_t pmu_period_ms = 0;
+static pmu_status_t cache;
+static bool cache_valid = false;
+static portMUX_TYPE cache_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static esp_err_t pmu_read(uint8_t reg, uint8_t *data, size_t len)
+{
+    return i2c_sched_read(pmu_dev, I2C_SCHED_PRIO_TELEMETRY, reg, data, len);
+}
+
+// Deadline for a background refresh, a read older than the next one is pointless
+static int64_t pmu_deadline(void)
+{
+    return pmu_period_ms ? esp_timer_get_time() + pmu_period_ms * 1000LL : 0;
+}
+
+#if CONFIG_PMU_AXP2101
+
+#define PMU_ADDRESS             0x34
+
+static esp_err_t pmu_read_status(pmu_status_t *st)
+{
+    uint8_t status[AXP2101_STATUS_REGS], adc[AXP2101_ADC_REGS], percent;
+    static const uint8_t regs[] = {AXP2101_REG_STATUS1, AXP2101_REG_ADC_VBAT_H, AXP2101_REG_BAT_PERCENT};
+    // One batch, touch may still take the bus between the reads
+    const i2c_sched_xfer_t xfers[] = {
+        {.tx = &regs[0], .tx_len = 1, .rx = status, .rx_len = sizeof(status)},
+        {.tx = &regs[1], .tx_len = 1, .rx = adc, .rx_len = sizeof(adc)},
+        {.tx = &regs[2], .tx_len = 1, .rx = &percent, .rx_len = 1},
+    };
+    i2c_sched_job_t job = {
+        .device = pmu_dev,
+        .priority = I2C_SCHED_PRIO_TELEMETRY,
+        .deadline_us = pmu_deadline(),
+        .xfers = xfers,
+        .count = sizeof(xfers) / sizeof(xfers[0]),
+    };
+    esp_err_t ret = i2c_sched_run(&job);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    axp2101_decode_status(status, adc, percent, st);
+    return ESP_OK;
+}
+
+static esp_err_t pmu_dump_rails(void)
+{
+    uint8_t regs[AXP2101_RAIL_REGS];
+    esp_err_t ret = pmu_read(AXP2101_REG_DC_ONOFF, regs, sizeof(regs));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    for (size_t i = 0; i < axp2101_rail_count; i++) {
+        const axp2101_rail_t *rail = &axp2101_rails[i];
+        ESP_LOGI(TAG, "%-7s: %s   Voltage:%u mV", rail->name, axp2101_rail_on(rail, regs) ? "+" : "-",
+                 axp2101_rail_mv(rail, regs));
+    }
+    return ESP_OK;
+}
+
+#else
+
+#define PMU_ADDRESS             0x6A
+
+static esp_err_t pmu_read_status(pmu_status_t *st)
+{
+    uint8_t regs[SY6970_STATUS_REGS];
+    esp_err_t ret = pmu_read(SY6970_REG_STATUS, regs, sizeof(regs));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    sy6970_decode_status(regs, st);
+    return ESP_OK;
+}
+
+static esp_err_t pmu_dump_rails(void)
+{
+    uint8_t regs[SY6970_REG_LAST - SY6970_REG_FIRST + 1];
+    esp_err_t ret = pmu_read(SY6970_REG_FIRST, regs, sizeof(regs));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ESP_LOG_BUFFER_HEX_LEVEL(TAG, regs, sizeof(regs), ESP_LOG_INFO);
+    return ESP_OK;
+}
+
+#endif
+
+esp_err_t pmu_telemetry_refresh(void)
+{
+    if (pmu_dev < 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    pmu_status_t st = {0};
+    esp_err_t ret = pmu_read_status(&st);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    st.updated_us = esp_timer_get_time();
+    taskENTER_CRITICAL(&cache_lock);
+    cache = st;
+    cache_valid = true;
+    taskEXIT_CRITICAL(&cache_lock);
+    return ESP_OK;
+}
+
+bool pmu_telemetry_get(pmu_status_t *status)
+{
+    taskENTER_CRITICAL(&cache_lock);
+    bool valid = cache_valid;
+    if (valid) {
+        *status = cache;
+    }
+    taskEXIT_CRITICAL(&cache_lock);
+    return valid;
+}
+
+esp_err_t pmu_telemetry_dump(void)
+{
+    if (pmu_dev < 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t ret = pmu_dump_rails();
+    if (ret == ESP_OK) {
+        ret = pmu_telemetry_refresh();
+    }
+    pmu_status_t st;
+    if (ret != ESP_OK || !pmu_telemetry_get(&st)) {
+        ESP_LOGE(TAG, "PMU read failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ESP_LOGI(TAG, "VBAT:%u mV %d%%%s  VBUS:%u mV%s  VSYS:%u mV", st.vbat_mv, st.battery_percent,
+             st.battery_present ? (st.charging ? " charging" : "") : " (no battery)",
+             st.vbus_mv, st.vbus_in ? "" : " (absent)", st.vsys_mv);
+    return ESP_OK;
+}
+
+static void pmu_telemetry_task(void *arg)
+{
+    const TickType_t period = pdMS_TO_TICKS((uint32_t)(uintptr_t)arg);
+    pmu_telemetry_dump();
+    TickType_t wake = xTaskGetTickCount();
+    while (1) {
+        vTaskDelayUntil(&wake, period);
+        pmu_telemetry_refresh();
+    }
+}
+
+esp_err_t pmu_telemetry_init(uint32_t period_ms)
+{
+    if (pmu_dev >= 0) {
+        return ESP_OK;
+    }
+    pmu_dev = i2c_sched_device("pmu", PMU_ADDRESS, PMU_I2C_SPEED_HZ);
+    if (pmu_dev < 0) {
+        return ESP_FAIL;
+    }
+    pmu_period_ms = period_ms;
+    if (period_ms && xTaskCreate(pmu_telemetry_task, "pmu", PMU_TASK_STACK_SIZE,
+                                 (void *)(uintptr_t)period_ms, tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+#else
+
+esp_err_t pmu_telemetry_init(uint32_t period_ms)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t pmu_telemetry_refresh(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+bool pmu_telemetry_get(pmu_status_t *status)
+{
+    return false;
+}
+
+esp_err_t pmu_telemetry_dump(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif
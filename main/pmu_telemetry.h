@@ -0,0 +1,41 @@
+/**
+ * @file      pmu_telemetry.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "pmu_decode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Boards with an AXP2101 or SY6970 only, elsewhere every call reports
+ * ESP_ERR_NOT_SUPPORTED or false. With a non-zero refresh period a
+ * background task logs the rail dump once and then refreshes the status
+ * cache, so nothing of this runs on the boot path. Reads go through the
+ * I2C scheduler at telemetry priority, background refreshes are dropped
+ * when they cannot start within one period.
+ */
+esp_err_t pmu_telemetry_init(uint32_t period_ms);
+
+// Read the status registers now, a few burst transactions
+esp_err_t pmu_telemetry_refresh(void);
+
+// Last cached status, never touches the bus. False before the first refresh.
+bool pmu_telemetry_get(pmu_status_t *status);
+
+// Log rail enables and voltages plus the current status
+esp_err_t pmu_telemetry_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -12,6 +12,7 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "i2c_driver.h"
+#include "pmu_telemetry.h"
 #include "product_pins.h"
 #include "driver/gpio.h"
 
@@ -27,7 +28,8 @@ XPowersAXP2101 PMU;
 
 bool power_driver_init()
 {
-    if (PMU.begin(bus_handle, AXP2101_SLAVE_ADDRESS)) {
+    // A short probe answers for an absent PMU without a driver init timing out
+    if (i2c_drv_probe(AXP2101_SLAVE_ADDRESS) && PMU.begin(bus_handle, AXP2101_SLAVE_ADDRESS)) {
         ESP_LOGI(TAG, "Init PMU SUCCESS!");
     } else {
         ESP_LOGE(TAG, "Init PMU FAILED!");
@@ -106,26 +108,8 @@ bool power_driver_init()
     PMU.enableBattVoltageMeasure();
 #endif
 
-    ESP_LOGI(TAG, "DCDC========================");
-    ESP_LOGI(TAG, "DC1  : %s   Voltage:%u mV ",  PMU.isEnableDC1()  ? "+" : "-", PMU.getDC1Voltage());
-    ESP_LOGI(TAG, "DC2  : %s   Voltage:%u mV ",  PMU.isEnableDC2()  ? "+" : "-", PMU.getDC2Voltage());
-    ESP_LOGI(TAG, "DC3  : %s   Voltage:%u mV ",  PMU.isEnableDC3()  ? "+" : "-", PMU.getDC3Voltage());
-    ESP_LOGI(TAG, "DC4  : %s   Voltage:%u mV ",  PMU.isEnableDC4()  ? "+" : "-", PMU.getDC4Voltage());
-    ESP_LOGI(TAG, "DC5  : %s   Voltage:%u mV ",  PMU.isEnableDC5()  ? "+" : "-", PMU.getDC5Voltage());
-    ESP_LOGI(TAG, "ALDO========================");
-    ESP_LOGI(TAG, "ALDO1: %s   Voltage:%u mV",  PMU.isEnableALDO1()  ? "+" : "-", PMU.getALDO1Voltage());
-    ESP_LOGI(TAG, "ALDO2: %s   Voltage:%u mV",  PMU.isEnableALDO2()  ? "+" : "-", PMU.getALDO2Voltage());
-    ESP_LOGI(TAG, "ALDO3: %s   Voltage:%u mV",  PMU.isEnableALDO3()  ? "+" : "-", PMU.getALDO3Voltage());
-    ESP_LOGI(TAG, "ALDO4: %s   Voltage:%u mV",  PMU.isEnableALDO4()  ? "+" : "-", PMU.getALDO4Voltage());
-    ESP_LOGI(TAG, "BLDO========================");
-    ESP_LOGI(TAG, "BLDO1: %s   Voltage:%u mV",  PMU.isEnableBLDO1()  ? "+" : "-", PMU.getBLDO1Voltage());
-    ESP_LOGI(TAG, "BLDO2: %s   Voltage:%u mV",  PMU.isEnableBLDO2()  ? "+" : "-", PMU.getBLDO2Voltage());
-    ESP_LOGI(TAG, "CPUSLDO========================");
-    ESP_LOGI(TAG, "CPUSLDO: %s Voltage:%u mV",  PMU.isEnableCPUSLDO() ? "+" : "-", PMU.getCPUSLDOVoltage());
-    ESP_LOGI(TAG, "DLDO========================");
-    ESP_LOGI(TAG, "DLDO1: %s   Voltage:%u mV",  PMU.isEnableDLDO1()  ? "+" : "-", PMU.getDLDO1Voltage());
-    ESP_LOGI(TAG, "DLDO2: %s   Voltage:%u mV",  PMU.isEnableDLDO2()  ? "+" : "-", PMU.getDLDO2Voltage());
-    ESP_LOGI(TAG, "============================");
+    // The rail dump and battery readings are served off the boot path
+    pmu_telemetry_init(CONFIG_LILYGO_PMU_TELEMETRY_PERIOD_MS);
 
 
     return true;
@@ -139,7 +123,8 @@ PowersSY6970 PMU;
 
 bool power_driver_init()
 {
-    if (PMU.begin(bus_handle, SY6970_SLAVE_ADDRESS)) {
+    // A short probe answers for an absent PMU without a driver init timing out
+    if (i2c_drv_probe(SY6970_SLAVE_ADDRESS) && PMU.begin(bus_handle, SY6970_SLAVE_ADDRESS)) {
         ESP_LOGI(TAG, "Init PMU SUCCESS!");
     } else {
         ESP_LOGE(TAG, "Init PMU FAILED!");
@@ -148,6 +133,8 @@ bool power_driver_init()
     PMU.enableADCMeasure();
     PMU.disableOTG();
 
+    pmu_telemetry_init(CONFIG_LILYGO_PMU_TELEMETRY_PERIOD_MS);
+
     return true;
 }
 #else
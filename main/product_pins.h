@@ -44,8 +44,7 @@
 #define AMOLED_EN_PIN       (-1)
 
 
-#define AMOLED_INIT_CMD     sh8501_cmd
-#define AMOLED_INIT_CMD_LEN SH8501_INIT_SEQUENCE_LENGHT
+#define AMOLED_INIT_STREAM  (&sh8501_init)
 
 #define CONFIG_PMU_AXP2101  (1)
 #define BOARD_HAS_TOUCH      1
@@ -77,8 +76,7 @@
 #define AMOLED_HEIGHT       536
 #define AMOLED_EN_PIN       (-1)
 
-#define AMOLED_INIT_CMD     rm67162_cmd
-#define AMOLED_INIT_CMD_LEN RM67162_INIT_SEQUENCE_LENGHT
+#define AMOLED_INIT_STREAM  (&rm67162_init)
 #define BOARD_HAS_TOUCH      0
 #define DISPLAY_BUFFER_SIZE  (AMOLED_WIDTH * AMOLED_HEIGHT)
 #define DISPLAY_FULLRESH     true
@@ -111,8 +109,7 @@
 #define AMOLED_HEIGHT       536
 #define AMOLED_EN_PIN       (38)
 
-#define AMOLED_INIT_CMD     rm67162_cmd
-#define AMOLED_INIT_CMD_LEN RM67162_INIT_SEQUENCE_LENGHT
+#define AMOLED_INIT_STREAM  (&rm67162_init)
 #define BOARD_HAS_TOUCH      1
 
 #define DISPLAY_BUFFER_SIZE  (AMOLED_WIDTH * AMOLED_HEIGHT)
@@ -150,8 +147,7 @@
 
 #define AMOLED_EN_PIN       (9)
 
-#define AMOLED_INIT_CMD     rm690b0_cmd
-#define AMOLED_INIT_CMD_LEN RM690B0_INIT_SEQUENCE_LENGHT
+#define AMOLED_INIT_STREAM  (&rm690b0_init)
 
 #define CONFIG_PMU_SY6970   (1)
 
@@ -168,8 +164,7 @@
 
 #define AMOLED_EN_PIN       (-1)
 
-#define AMOLED_INIT_CMD     jd9613_cmd
-#define AMOLED_INIT_CMD_LEN JD9613_INIT_SEQUENCE_LENGHT
+#define AMOLED_INIT_STREAM  (&jd9613_init)
 
 #define BOARD_HAS_TOUCH      0
 #define DISPLAY_BUFFER_SIZE  (AMOLED_WIDTH * AMOLED_HEIGHT)
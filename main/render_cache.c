@@ -0,0 +1,419 @@
+/**
+ * @file      render_cache.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <sdkconfig.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "render_cache.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include "src/draw/sw/lv_draw_sw_gradient.h"
+
+#if CONFIG_LILYGO_RENDER_CACHE
+
+#define RENDER_CACHE_MAX_ENTRIES    64
+#define GRAD_HEADER_SIZE            ((sizeof(lv_grad_t) + 3) & ~3u)
+
+enum {
+    RENDER_KEY_SHADOW = 1,
+    RENDER_KEY_GRAD,
+};
+
+#if LV_GRADIENT_MAX_STOPS > CACHE_KEY_WORDS - 2
+#error "Gradient stops do not fit the render cache key"
+#endif
+
+/*
+ * A cached shadow is a per-row span table followed by an A8 mask of the whole
+ * shadow area. Each row keeps two spans so the transparent part below the
+ * object is skipped when blending.
+ */
+typedef struct {
+    uint16_t x0, x1;
+    uint16_t x2, x3;
+} shadow_span_t;
+
+typedef struct {
+    const lv_draw_rect_dsc_t *dsc;
+    const lv_area_t *coords;
+    lv_area_t area;
+    bool rendered;
+} shadow_job_t;
+
+/*
+ * A cached gradient is an lv_grad_t header followed by its colour map, so
+ * the blob itself is what lv_gradient_get() returns. It stays pinned until
+ * lv_gradient_cleanup().
+ */
+typedef struct {
+    const lv_grad_dsc_t *dsc;
+    lv_coord_t size;
+    bool rendered;
+} grad_job_t;
+
+static const char *TAG = "RENDER_CACHE";
+static cache_store_t render_store;
+static bool render_ready = false;
+static render_cache_stats_t counters;       // LVGL task only
+static render_cache_stats_t published;
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static void (*render_prev_ctx_init)(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx);
+
+static void shadow_area_get(const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords, lv_area_t *area)
+{
+    // Same bounding box as lv_draw_sw_rect() uses for the blurred shadow
+    area->x1 = coords->x1 + dsc->shadow_ofs_x - dsc->shadow_spread - dsc->shadow_width / 2 - 1;
+    area->x2 = coords->x2 + dsc->shadow_ofs_x + dsc->shadow_spread + dsc->shadow_width / 2 + 1;
+    area->y1 = coords->y1 + dsc->shadow_ofs_y - dsc->shadow_spread - dsc->shadow_width / 2 - 1;
+    area->y2 = coords->y2 + dsc->shadow_ofs_y + dsc->shadow_spread + dsc->shadow_width / 2 + 1;
+}
+
+static void shadow_key_make(cache_key_t *key, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords)
+{
+    lv_coord_t w = lv_area_get_width(coords);
+    lv_coord_t h = lv_area_get_height(coords);
+    lv_coord_t r = LV_MIN(dsc->radius, LV_MIN(w, h) / 2);
+
+    memset(key, 0, sizeof(*key));
+    key->w[0] = RENDER_KEY_SHADOW;
+    key->w[1] = (uint32_t)w;
+    key->w[2] = (uint32_t)h;
+    key->w[3] = (uint32_t)r;
+    key->w[4] = (uint32_t)dsc->shadow_width;
+    key->w[5] = (uint32_t)dsc->shadow_spread;
+    key->w[6] = (uint32_t)dsc->shadow_ofs_x;
+    key->w[7] = (uint32_t)dsc->shadow_ofs_y;
+}
+
+static void shadow_spans_build(const lv_opa_t *row, lv_coord_t w, shadow_span_t *span)
+{
+    lv_coord_t first = 0, last = w - 1;
+    while (first < w && row[first] == 0) first++;
+    while (last > first && row[last] == 0) last--;
+
+    memset(span, 0, sizeof(*span));
+    if (first >= w) {
+        return;
+    }
+
+    // Longest transparent run inside [first, last]
+    lv_coord_t gap_start = 0, gap_len = 0;
+    for (lv_coord_t x = first; x <= last;) {
+        if (row[x]) {
+            x++;
+            continue;
+        }
+        lv_coord_t start = x;
+        while (x <= last && row[x] == 0) x++;
+        if (x - start > gap_len) {
+            gap_start = start;
+            gap_len = x - start;
+        }
+    }
+
+    span->x0 = first;
+    if (gap_len > 0) {
+        span->x1 = gap_start;
+        span->x2 = gap_start + gap_len;
+    } else {
+        span->x1 = last + 1;
+        span->x2 = last + 1;
+    }
+    span->x3 = last + 1;
+}
+
+static bool shadow_fill(void *buf, size_t size, void *user_data)
+{
+    shadow_job_t *job = (shadow_job_t *)user_data;
+    lv_coord_t w = lv_area_get_width(&job->area);
+    lv_coord_t h = lv_area_get_height(&job->area);
+    shadow_span_t *spans = (shadow_span_t *)buf;
+    lv_opa_t *mask = (lv_opa_t *)buf + h * sizeof(shadow_span_t);
+
+    lv_color_t *px = (lv_color_t *)heap_caps_malloc(w * h * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+    if (!px) {
+        return false;
+    }
+    memset(px, 0, w * h * sizeof(lv_color_t));
+
+    // Render a white shadow over black with the stock renderer, its brightness is the coverage
+    lv_draw_sw_ctx_t ctx;
+    lv_draw_sw_init_ctx(NULL, (lv_draw_ctx_t *)&ctx);
+    ctx.base_draw.buf = px;
+    ctx.base_draw.buf_area = &job->area;
+    ctx.base_draw.clip_area = &job->area;
+
+    job->rendered = true;
+    lv_draw_rect_dsc_t d;
+    lv_draw_rect_dsc_init(&d);
+    d.radius = job->dsc->radius;
+    d.bg_opa = LV_OPA_TRANSP;
+    d.bg_img_opa = LV_OPA_TRANSP;
+    d.border_opa = LV_OPA_TRANSP;
+    d.outline_opa = LV_OPA_TRANSP;
+    d.shadow_color = lv_color_white();
+    d.shadow_opa = LV_OPA_COVER;
+    d.shadow_width = job->dsc->shadow_width;
+    d.shadow_spread = job->dsc->shadow_spread;
+    d.shadow_ofs_x = job->dsc->shadow_ofs_x;
+    d.shadow_ofs_y = job->dsc->shadow_ofs_y;
+    lv_draw_sw_rect((lv_draw_ctx_t *)&ctx, &d, job->coords);
+
+    for (lv_coord_t y = 0; y < h; y++) {
+        lv_opa_t *row = mask + y * w;
+        const lv_color_t *src = px + y * w;
+        for (lv_coord_t x = 0; x < w; x++) {
+            row[x] = lv_color_brightness(src[x]);
+        }
+        shadow_spans_build(row, w, &spans[y]);
+    }
+
+    heap_caps_free(px);
+    return true;
+}
+
+static void grad_key_make(cache_key_t *key, const lv_grad_dsc_t *dsc, lv_coord_t size)
+{
+    memset(key, 0, sizeof(*key));
+    key->w[0] = RENDER_KEY_GRAD | (uint32_t)dsc->dir << 8 | (uint32_t)dsc->stops_count << 16;
+    key->w[1] = (uint32_t)size;
+    for (uint8_t i = 0; i < dsc->stops_count && i < LV_GRADIENT_MAX_STOPS; i++) {
+        key->w[2 + i] = (uint32_t)dsc->stops[i].color.full | (uint32_t)dsc->stops[i].frac << 24;
+    }
+}
+
+static bool grad_fill(void *buf, size_t size, void *user_data)
+{
+    grad_job_t *job = (grad_job_t *)user_data;
+    lv_grad_t *grad = (lv_grad_t *)buf;
+
+    memset(grad, 0, sizeof(*grad));
+    grad->map = (lv_color_t *)((uint8_t *)buf + GRAD_HEADER_SIZE);
+    grad->alloc_size = job->size;
+    grad->size = job->size;
+    grad->filled = 1;
+    for (lv_coord_t i = 0; i < job->size; i++) {
+        grad->map[i] = lv_gradient_calculate(job->dsc, job->size, i);
+    }
+    job->rendered = true;
+    return true;
+}
+
+// Called after each store access in the LVGL task, readers only see the copy
+static void stats_publish(void)
+{
+    cache_stats_t store;
+    cache_store_get_stats(&render_store, &store);
+    taskENTER_CRITICAL(&stats_lock);
+    published = counters;
+    published.store = store;
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+static void shadow_blend_span(lv_draw_ctx_t *draw_ctx, lv_draw_sw_blend_dsc_t *blend, lv_opa_t *line,
+                              const lv_opa_t *row, const lv_area_t *sh, lv_coord_t y,
+                              lv_coord_t x1, lv_coord_t x2)
+{
+    // x1/x2 are relative to the shadow area, clip them to the draw area
+    lv_coord_t ax1 = LV_MAX(sh->x1 + x1, draw_ctx->clip_area->x1);
+    lv_coord_t ax2 = LV_MIN(sh->x1 + x2 - 1, draw_ctx->clip_area->x2);
+    if (ax1 > ax2) {
+        return;
+    }
+    lv_area_t area = {ax1, y, ax2, y};
+    lv_memcpy(line, row + (ax1 - sh->x1), ax2 - ax1 + 1);
+    blend->blend_area = &area;
+    blend->mask_area = &area;
+    blend->mask_buf = line;
+    blend->mask_res = LV_DRAW_MASK_RES_CHANGED;
+    lv_draw_sw_blend(draw_ctx, blend);
+}
+
+static bool render_cache_draw_shadow(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords)
+{
+    // Degenerate shadow, lv_draw_sw_rect() would not draw it either
+    if (dsc->shadow_width == 1 && dsc->shadow_spread <= 0 &&
+            dsc->shadow_ofs_x == 0 && dsc->shadow_ofs_y == 0) {
+        return true;
+    }
+
+    shadow_job_t job = {dsc, coords};
+    shadow_area_get(dsc, coords, &job.area);
+
+    lv_area_t draw_area;
+    if (!_lv_area_intersect(&draw_area, &job.area, draw_ctx->clip_area)) {
+        return true;
+    }
+
+    // Clip masks (e.g. rounded parents) would not be part of the cached mask
+    if (lv_draw_mask_is_any(&job.area)) {
+        counters.shadow_bypass++;
+        stats_publish();
+        return false;
+    }
+
+    lv_coord_t w = lv_area_get_width(&job.area);
+    lv_coord_t h = lv_area_get_height(&job.area);
+    size_t size = h * sizeof(shadow_span_t) + (size_t)w * h;
+
+    cache_key_t key;
+    shadow_key_make(&key, dsc, coords);
+    uint8_t *blob = (uint8_t *)cache_store_get(&render_store, &key, size, shadow_fill, &job);
+    if (!blob) {
+        counters.shadow_bypass++;
+        stats_publish();
+        return false;
+    }
+    if (job.rendered) {
+        counters.shadow_renders++;
+    } else {
+        counters.shadow_hits++;
+    }
+    stats_publish();
+
+    const shadow_span_t *spans = (const shadow_span_t *)blob;
+    const lv_opa_t *mask = blob + h * sizeof(shadow_span_t);
+    lv_opa_t *line = (lv_opa_t *)lv_mem_buf_get(lv_area_get_width(&draw_area));
+
+    lv_draw_sw_blend_dsc_t blend;
+    lv_memset_00(&blend, sizeof(blend));
+    blend.color = dsc->shadow_color;
+    blend.opa = dsc->shadow_opa;
+    blend.blend_mode = dsc->blend_mode;
+
+    for (lv_coord_t y = draw_area.y1; y <= draw_area.y2; y++) {
+        lv_coord_t ry = y - job.area.y1;
+        const shadow_span_t *s = &spans[ry];
+        const lv_opa_t *row = mask + ry * w;
+        if (s->x0 < s->x1) {
+            shadow_blend_span(draw_ctx, &blend, line, row, &job.area, y, s->x0, s->x1);
+        }
+        if (s->x2 < s->x3) {
+            shadow_blend_span(draw_ctx, &blend, line, row, &job.area, y, s->x2, s->x3);
+        }
+    }
+
+    lv_mem_buf_release(line);
+    return true;
+}
+
+lv_grad_t *__real_lv_gradient_get(const lv_grad_dsc_t *dsc, lv_coord_t w, lv_coord_t h);
+void __real_lv_gradient_cleanup(lv_grad_t *grad);
+
+// Replaces LVGL's gradient cache, which lives in the LV_MEM pool
+lv_grad_t *__wrap_lv_gradient_get(const lv_grad_dsc_t *dsc, lv_coord_t w, lv_coord_t h)
+{
+    if (dsc->dir == LV_GRAD_DIR_NONE) {
+        return NULL;
+    }
+#if LV_DITHER_GRADIENT
+    // Dithered maps carry per-frame error buffers, nothing to share
+    return __real_lv_gradient_get(dsc, w, h);
+#else
+    if (!render_ready) {
+        return __real_lv_gradient_get(dsc, w, h);
+    }
+    grad_job_t job = {dsc, dsc->dir == LV_GRAD_DIR_HOR ? w : h};
+    cache_key_t key;
+    grad_key_make(&key, dsc, job.size);
+    lv_grad_t *grad = (lv_grad_t *)cache_store_get(&render_store, &key,
+                      GRAD_HEADER_SIZE + job.size * sizeof(lv_color_t), grad_fill, &job);
+    if (!grad) {
+        counters.grad_bypass++;
+        stats_publish();
+        return __real_lv_gradient_get(dsc, w, h);
+    }
+    cache_store_pin(&render_store, &key);
+    if (job.rendered) {
+        counters.grad_renders++;
+    } else {
+        counters.grad_hits++;
+    }
+    stats_publish();
+    return grad;
+#endif
+}
+
+void __wrap_lv_gradient_cleanup(lv_grad_t *grad)
+{
+    if (!grad) {
+        return;
+    }
+    if (!render_ready || !cache_store_unpin_data(&render_store, grad)) {
+        __real_lv_gradient_cleanup(grad);
+    }
+}
+
+static void render_cache_draw_rect(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords)
+{
+    if (dsc->shadow_width && dsc->shadow_opa > LV_OPA_MIN &&
+            render_cache_draw_shadow(draw_ctx, dsc, coords)) {
+        lv_draw_rect_dsc_t rest = *dsc;
+        rest.shadow_opa = LV_OPA_TRANSP;
+        lv_draw_sw_rect(draw_ctx, &rest, coords);
+        return;
+    }
+    lv_draw_sw_rect(draw_ctx, dsc, coords);
+}
+
+static void render_cache_draw_ctx_init(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx)
+{
+    render_prev_ctx_init(drv, draw_ctx);
+    draw_ctx->draw_rect = render_cache_draw_rect;
+}
+
+bool render_cache_init(size_t capacity)
+{
+    if (render_ready) {
+        return true;
+    }
+    if (!cache_store_init(&render_store, "render", capacity, RENDER_CACHE_MAX_ENTRIES, CACHE_STORE_CAPS_PSRAM)) {
+        ESP_LOGE(TAG, "No memory for cache table");
+        return false;
+    }
+    render_ready = true;
+    ESP_LOGI(TAG, "Shadow and gradient render cache %u KB", (unsigned)(capacity / 1024));
+    return true;
+}
+
+void render_cache_install(lv_disp_drv_t *drv)
+{
+    if (!render_ready || drv->draw_ctx_init == render_cache_draw_ctx_init) {
+        return;
+    }
+    // Chain on top of whatever lv_disp_drv_init() or another hook installed
+    render_prev_ctx_init = drv->draw_ctx_init;
+    drv->draw_ctx_init = render_cache_draw_ctx_init;
+}
+
+void render_cache_get_stats(render_cache_stats_t *stats)
+{
+    taskENTER_CRITICAL(&stats_lock);
+    *stats = published;
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+void render_cache_dump(FILE *out)
+{
+    render_cache_stats_t st;
+    render_cache_get_stats(&st);
+    if (!render_ready) {
+        fputs("render cache not started\n", out);
+        return;
+    }
+    fprintf(out, "render cache: %u entries, %u pinned, %u/%u bytes (peak %u), %lu evictions, %lu rejects\n",
+            st.store.entries, st.store.pinned, (unsigned)st.store.bytes_used, (unsigned)render_store.capacity,
+            (unsigned)st.store.bytes_peak, (unsigned long)st.store.evictions, (unsigned long)st.store.rejects);
+    fprintf(out, "  shadow    hits:%lu renders:%lu bypass:%lu\n", (unsigned long)st.shadow_hits,
+            (unsigned long)st.shadow_renders, (unsigned long)st.shadow_bypass);
+    fprintf(out, "  gradient  hits:%lu renders:%lu bypass:%lu\n", (unsigned long)st.grad_hits,
+            (unsigned long)st.grad_renders, (unsigned long)st.grad_bypass);
+}
+
+#endif
@@ -0,0 +1,50 @@
+/**
+ * @file      render_cache.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "lvgl.h"
+#include "cache_store.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    cache_stats_t store;
+    uint32_t shadow_hits;
+    uint32_t shadow_renders;
+    uint32_t shadow_bypass;
+    uint32_t grad_hits;
+    uint32_t grad_renders;
+    uint32_t grad_bypass;
+} render_cache_stats_t;
+
+/*
+ * Render cache for the software renderer, one PSRAM store for both kinds.
+ * Blurred shadow masks are rendered once per geometry/style and blended
+ * from there on later redraws. Gradient colour maps are keyed by direction,
+ * length and stops and handed to LVGL in place of its own gradient cache,
+ * the component links with --wrap=lv_gradient_get/lv_gradient_cleanup.
+ */
+bool render_cache_init(size_t capacity);
+
+// Hook the draw context of `drv`, call after lv_disp_drv_init()
+void render_cache_install(lv_disp_drv_t *drv);
+
+// Snapshot published by the LVGL task, safe to call from any task
+void render_cache_get_stats(render_cache_stats_t *stats);
+
+void render_cache_dump(FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
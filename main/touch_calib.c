@@ -0,0 +1,120 @@
+/**
+ * @file      touch_calib.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <math.h>
+#include <stdlib.h>
+#include "touch_calib.h"
+
+#define OVERSAMPLE_MAX      16
+
+static int64_t calib_det(const touch_calib_point_t p[TOUCH_CALIB_POINTS])
+{
+    return (int64_t)(p[0].x - p[2].x) * (p[1].y - p[2].y) - (int64_t)(p[1].x - p[2].x) * (p[0].y - p[2].y);
+}
+
+static int32_t calib_q16(double v)
+{
+    return (int32_t)llround(v * TOUCH_CALIB_ONE);
+}
+
+bool touch_calib_solve(const touch_calib_point_t raw[TOUCH_CALIB_POINTS],
+                       const touch_calib_point_t target[TOUCH_CALIB_POINTS], touch_calib_t *out)
+{
+    int64_t det = calib_det(raw);
+    int64_t target_det = calib_det(target);
+    if (det == 0 || llabs(det) * 4 < llabs(target_det)) {
+        return false;
+    }
+
+    // Cramer's rule, once per output axis
+    const double d = (double)det;
+    for (int axis = 0; axis < 2; axis++) {
+        double t0 = axis ? target[0].y : target[0].x;
+        double t1 = axis ? target[1].y : target[1].x;
+        double t2 = axis ? target[2].y : target[2].x;
+        double a = ((t0 - t2) * (raw[1].y - raw[2].y) - (t1 - t2) * (raw[0].y - raw[2].y)) / d;
+        double b = ((raw[0].x - raw[2].x) * (t1 - t2) - (raw[1].x - raw[2].x) * (t0 - t2)) / d;
+        double c = t2 - a * raw[2].x - b * raw[2].y;
+        if (fabs(a) > 32767 || fabs(b) > 32767 || fabs(c) > 32767) {
+            return false;
+        }
+        out->m[axis * 3 + 0] = calib_q16(a);
+        out->m[axis * 3 + 1] = calib_q16(b);
+        out->m[axis * 3 + 2] = calib_q16(c);
+    }
+    return true;
+}
+
+static int16_t calib_round(int64_t v)
+{
+    v = (v + TOUCH_CALIB_ONE / 2) >> 16;
+    return v < INT16_MIN ? INT16_MIN : v > INT16_MAX ? INT16_MAX : (int16_t)v;
+}
+
+void touch_calib_apply(const touch_calib_t *cal, int32_t x, int32_t y, int16_t *out_x, int16_t *out_y)
+{
+    *out_x = calib_round((int64_t)cal->m[0] * x + (int64_t)cal->m[1] * y + cal->m[2]);
+    *out_y = calib_round((int64_t)cal->m[3] * x + (int64_t)cal->m[4] * y + cal->m[5]);
+}
+
+static int cmp_u16(const void *a, const void *b)
+{
+    return (int)*(const uint16_t *)a - (int)*(const uint16_t *)b;
+}
+
+bool touch_oversample(const touch_raw_sample_t *samples, size_t count, uint16_t max_dev, uint16_t *x, uint16_t *y)
+{
+    if (count > OVERSAMPLE_MAX) {
+        count = OVERSAMPLE_MAX;
+    }
+    uint16_t peak = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (samples[i].z > peak) {
+            peak = samples[i].z;
+        }
+    }
+    if (!peak) {
+        return false;
+    }
+
+    const touch_raw_sample_t *kept[OVERSAMPLE_MAX];
+    uint16_t xs[OVERSAMPLE_MAX], ys[OVERSAMPLE_MAX];
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        if ((uint32_t)samples[i].z * 4 >= (uint32_t)peak * 3) {
+            kept[n] = &samples[i];
+            xs[n] = samples[i].x;
+            ys[n] = samples[i].y;
+            n++;
+        }
+    }
+    size_t need = (count + 1) / 2;
+    if (n < need) {
+        return false;
+    }
+
+    qsort(xs, n, sizeof(xs[0]), cmp_u16);
+    qsort(ys, n, sizeof(ys[0]), cmp_u16);
+    int mx = xs[n / 2], my = ys[n / 2];
+
+    uint32_t sx = 0, sy = 0;
+    size_t used = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (abs(kept[i]->x - mx) <= max_dev && abs(kept[i]->y - my) <= max_dev) {
+            sx += kept[i]->x;
+            sy += kept[i]->y;
+            used++;
+        }
+    }
+    if (used < need) {
+        return false;
+    }
+    *x = (sx + used / 2) / used;
+    *y = (sy + used / 2) / used;
+    return true;
+}
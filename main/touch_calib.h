@@ -0,0 +1,64 @@
+/**
+ * @file      touch_calib.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TOUCH_CALIB_POINTS      3
+#define TOUCH_CALIB_ONE         (1 << 16)
+
+/*
+ * Affine map in Q16, stored as is in NVS:
+ *   x' = (m[0] * x + m[1] * y + m[2]) >> 16
+ *   y' = (m[3] * x + m[4] * y + m[5]) >> 16
+ */
+typedef struct {
+    int32_t m[6];
+} touch_calib_t;
+
+#define TOUCH_CALIB_IDENTITY() { .m = {TOUCH_CALIB_ONE, 0, 0, 0, TOUCH_CALIB_ONE, 0} }
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+} touch_calib_point_t;
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t z;             // pressure, larger is firmer
+} touch_raw_sample_t;
+
+/*
+ * Map that takes the three raw taps onto the three targets. False when the
+ * taps are too close to a line, or cover less than a quarter of the target
+ * triangle, which means a missed or repeated tap rather than a skewed panel.
+ */
+bool touch_calib_solve(const touch_calib_point_t raw[TOUCH_CALIB_POINTS],
+                       const touch_calib_point_t target[TOUCH_CALIB_POINTS], touch_calib_t *out);
+
+void touch_calib_apply(const touch_calib_t *cal, int32_t x, int32_t y, int16_t *out_x, int16_t *out_y);
+
+/*
+ * Merge a burst of reads into one point. Samples pressed lighter than 3/4
+ * of the firmest are dropped first, they are the edge of a press and the
+ * noisiest. Then anything further than max_dev from the median goes, and
+ * the rest is averaged. False when fewer than half the samples survive.
+ */
+bool touch_oversample(const touch_raw_sample_t *samples, size_t count, uint16_t max_dev, uint16_t *x, uint16_t *y);
+
+#ifdef __cplusplus
+}
+#endif
@@ -10,7 +10,10 @@
 #include "esp_err.h"
 #include "esp_log.h"
 #include "i2c_driver.h"
+#include "i2c_sched.h"
 #include "product_pins.h"
+#include "touch_driver.h"
+#include "trace_ring.h"
 #include "freertos/FreeRTOS.h"
 
 #if BOARD_HAS_TOUCH
@@ -35,16 +38,8 @@ TouchClassCST226 touch;
 #define TOUCH_ADDRESS   CST226SE_SLAVE_ADDRESS
 
 #elif defined(CONFIG_LILYGO_T_DISPLAY_LONG)
-
-#include "driver/i2c.h"
-
-#define AXS_GET_POINT_NUM(buf) buf[1]
-#define AXS_GET_GESTURE_TYPE(buf)  buf[0]
-#define AXS_GET_POINT_X(buf,point_index) (((uint16_t)(buf[6*point_index+2] & 0x0F) <<8) + (uint16_t)buf[6*point_index+3])
-#define AXS_GET_POINT_Y(buf,point_index) (((uint16_t)(buf[6*point_index+4] & 0x0F) <<8) + (uint16_t)buf[6*point_index+5])
-#define AXS_GET_POINT_EVENT(buf,point_index) (buf[6*point_index+2] >> 6)
-#define TOUCH_ADDRESS               0x3B
-i2c_master_dev_handle_t             i2c_device;
+#include "axs_touch.h"
+#include "touch_input.h"
 
 #elif defined(CONFIG_LILYGO_T_HMI)
 extern "C" {
@@ -57,13 +52,36 @@ extern "C" {
 
 extern "C" {
     void board_rgb_touch_init();
-    uint8_t board_rgb_get_point(uint16_t *x, uint16_t *y);
+    uint8_t board_rgb_get_point(int16_t *x, int16_t *y, uint8_t point_num);
 }
 
 #endif
 
 static bool _init_success = false;
 
+#if !defined(CONFIG_LILYGO_T_DISPLAY_LONG) && !defined(CONFIG_LILYGO_T_HMI)
+// Controller drivers own their transfers, the scheduler only decides when they run
+static int touch_dev = -1;
+
+typedef struct {
+    int16_t *x;
+    int16_t *y;
+    uint8_t point_num;
+    uint8_t touched;
+} touch_read_t;
+
+static int touch_read_cb(void *arg)
+{
+    touch_read_t *r = (touch_read_t *)arg;
+#if defined(CONFIG_LILYGO_T_RGB)
+    r->touched = board_rgb_get_point(r->x, r->y, r->point_num);
+#else
+    r->touched = touch.getPoint(r->x, r->y, r->point_num);
+#endif
+    return 0;
+}
+#endif
+
 
 void touch_home_button_callback(void *args)
 {
@@ -77,13 +95,10 @@ bool touch_init()
 
 #if defined(CONFIG_LILYGO_T_DISPLAY_LONG)
 
-    extern i2c_master_bus_handle_t bus_handle;
-    i2c_device_config_t i2c_dev_conf = {
-        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-        .device_address = TOUCH_ADDRESS,
-        .scl_speed_hz = 100000,
-    };
-    i2c_master_bus_add_device(bus_handle, &i2c_dev_conf, &i2c_device);
+    if (axs_touch_init(bus_handle) != ESP_OK) {
+        ESP_LOGE(TAG, "Touch init failed!");
+        return false;
+    }
 #elif defined(CONFIG_LILYGO_T_HMI)
 
     board_hmi_touch_init();
@@ -91,6 +106,7 @@ bool touch_init()
 #elif defined(CONFIG_LILYGO_T_RGB)
 
     board_rgb_touch_init();
+    touch_dev = i2c_sched_device("touch", 0, 0);
 
 #else
     touch.setPins(BOARD_TOUCH_RST, BOARD_TOUCH_IRQ);
@@ -119,6 +135,7 @@ bool touch_init()
 #elif defined(CONFIG_LILYGO_T_QT_C6)
     touch.setMirrorXY(false, true);
 #endif
+    touch_dev = i2c_sched_device("touch", 0, 0);
 
 
 
@@ -134,32 +151,20 @@ uint8_t touch_get_data(int16_t *x, int16_t *y, uint8_t point_num)
     uint8_t touched = 0;
 
 #if defined(CONFIG_LILYGO_T_DISPLAY_LONG)
-    uint16_t pointX;
-    uint16_t pointY;
-    uint16_t type = 0;
-
-    uint8_t cmd[11] = {0xb5, 0xab, 0xa5, 0x5a, 0x0, 0x0, 0x0, 0x8};
-    uint8_t buffer[20] = {0};
-
-    if (ESP_OK != i2c_master_transmit_receive(
-                i2c_device,
-                cmd,
-                sizeof(cmd) / sizeof(*cmd),
-                buffer,
-                20,
-                -1)) {
-        return 0 ;
+    // The IRQ reader task may wait for the bus, an LVGL poll never does. A read that did
+    // not finish in time repeats the last report, it must not look like a release.
+    axs_touch_report_t report;
+    esp_err_t ret = axs_touch_read(&report, touch_input_active() ? AXS_TOUCH_TIMEOUT_MS : 0);
+    if (ret != ESP_OK && ret != ESP_ERR_TIMEOUT) {
+        return 0;
     }
-
-    type = AXS_GET_GESTURE_TYPE(buffer);
-    pointX = AXS_GET_POINT_X(buffer, 0);
-    pointY = AXS_GET_POINT_Y(buffer, 0);
-
-    if (!type && (pointX || pointY)) {
-        *x = pointY;
-        *y = 640 - pointX;
-        ESP_LOGI(TAG, "T:%d X:%d Y:%d", type, *x, *y);
-        touched = 1;
+    for (uint8_t i = 0; i < report.count && touched < point_num; i++) {
+        x[touched] = report.points[i].y;
+        y[touched] = 640 - report.points[i].x;
+        touched++;
+    }
+    if (touched) {
+        trace_touch(x[0], y[0], touched, report.gesture);
     }
 
 #elif defined(CONFIG_LILYGO_T_HMI)
@@ -173,20 +178,18 @@ uint8_t touch_get_data(int16_t *x, int16_t *y, uint8_t point_num)
 
     }
 #elif defined(CONFIG_LILYGO_T_RGB)
-    uint16_t pointX;
-    uint16_t pointY;
-    touched = board_rgb_get_point(&pointX, &pointY);
-    if (touched) {
-        *x = pointX;
-        *y = pointY;
-
-    }
+    touch_read_t r = {x, y, point_num, 0};
+    i2c_sched_call(touch_dev, I2C_SCHED_PRIO_TOUCH, touch_read_cb, &r);
+    touched = r.touched;
 #else
 
     if (!_init_success)return 0;
-    touched =  touch.getPoint(x, y, point_num);
+    // No deadline, a dropped read would look like a release
+    touch_read_t r = {x, y, point_num, 0};
+    i2c_sched_call(touch_dev, I2C_SCHED_PRIO_TOUCH, touch_read_cb, &r);
+    touched = r.touched;
     if (touched) {
-        ESP_LOGI(TAG, "X:%d Y:%d touched:%d\n", *x, *y, touched);
+        trace_touch(x[0], y[0], touched, 0);
     }
 
 #endif
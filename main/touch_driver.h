@@ -9,18 +9,37 @@
 
 #pragma once
 #include <stdbool.h>
+#include <stdint.h>
 #include <sdkconfig.h>
+#include "esp_err.h"
 #include "product_pins.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #if defined(BOARD_HAS_TOUCH)
 
 bool touch_init();
 uint8_t touch_get_data(int16_t *x, int16_t *y, uint8_t point_num);
 
+#if CONFIG_LILYGO_T_HMI
+// Three-point calibration of the resistive panel, kept in NVS
+bool board_hmi_touch_calibrated(void);
+// Not calibrated and not skipped before, or the panel is held at boot
+bool board_hmi_touch_calib_wanted(void);
+esp_err_t board_hmi_touch_calibrate(void);
+esp_err_t board_hmi_touch_calib_erase(void);
+#endif
+
 #else
 bool touch_init();
 #endif
 
+#ifdef __cplusplus
+}
+#endif
+
 
 
 
@@ -0,0 +1,134 @@
+/**
+ * @file      touch_filter.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <math.h>
+#include <string.h>
+#include "touch_filter.h"
+
+#define FILTER_PI           3.14159265f
+#define FILTER_MIN_DT       0.001f
+
+void touch_filter_init(touch_filter_t *f, const touch_filter_config_t *cfg)
+{
+    memset(f, 0, sizeof(*f));
+    if (cfg) {
+        f->cfg = *cfg;
+    } else {
+        touch_filter_config_t def = TOUCH_FILTER_CONFIG_DEFAULT();
+        f->cfg = def;
+    }
+    if (f->cfg.median < 1) {
+        f->cfg.median = 1;
+    } else if (f->cfg.median > TOUCH_FILTER_MAX_MEDIAN) {
+        f->cfg.median = TOUCH_FILTER_MAX_MEDIAN;
+    }
+}
+
+void touch_filter_reset(touch_filter_t *f)
+{
+    f->active = false;
+    f->history_len = 0;
+    f->history_pos = 0;
+}
+
+static float filter_alpha(float cutoff_hz, float dt)
+{
+    float tau = 1.0f / (2.0f * FILTER_PI * cutoff_hz);
+    return 1.0f / (1.0f + tau / dt);
+}
+
+static int16_t filter_median(const int16_t *values, uint8_t n)
+{
+    int16_t sorted[TOUCH_FILTER_MAX_MEDIAN];
+    memcpy(sorted, values, n * sizeof(*values));
+    for (uint8_t i = 1; i < n; i++) {
+        int16_t v = sorted[i];
+        int j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+    }
+    return sorted[n / 2];
+}
+
+static float filter_one_euro(const touch_filter_config_t *cfg, touch_filter_axis_t *a, float raw, float dt)
+{
+    float speed = (raw - a->value) / dt;
+    a->speed += filter_alpha(cfg->d_cutoff_hz, dt) * (speed - a->speed);
+    if (cfg->min_cutoff_hz <= 0) {
+        a->value = raw;
+        return raw;
+    }
+    float cutoff = cfg->min_cutoff_hz + cfg->beta * fabsf(a->speed);
+    a->value += filter_alpha(cutoff, dt) * (raw - a->value);
+    return a->value;
+}
+
+void touch_filter_update(touch_filter_t *f, int64_t time_us, int16_t *x, int16_t *y)
+{
+    int16_t raw[2] = {*x, *y};
+    int64_t value_us = time_us;
+
+    if (f->cfg.median > 1) {
+        f->history[0][f->history_pos] = raw[0];
+        f->history[1][f->history_pos] = raw[1];
+        f->history_us[f->history_pos] = time_us;
+        f->history_pos = (f->history_pos + 1) % f->cfg.median;
+        if (f->history_len < f->cfg.median) {
+            f->history_len++;
+        }
+        raw[0] = filter_median(f->history[0], f->history_len);
+        raw[1] = filter_median(f->history[1], f->history_len);
+        // On a steady drag the median is the middle sample of the window
+        uint8_t back = (f->history_len - 1) / 2 + 1;
+        value_us = f->history_us[(f->history_pos + f->cfg.median - back) % f->cfg.median];
+    }
+
+    if (!f->active) {
+        // First contact is taken as is, there is nothing to smooth against
+        f->active = true;
+        f->last_us = time_us;
+        f->value_us = value_us;
+        for (int i = 0; i < 2; i++) {
+            f->axis[i].value = raw[i];
+            f->axis[i].speed = 0;
+        }
+        *x = raw[0];
+        *y = raw[1];
+        return;
+    }
+
+    float dt = (time_us - f->last_us) / 1000000.0f;
+    if (dt < FILTER_MIN_DT) {
+        dt = FILTER_MIN_DT;
+    }
+    f->last_us = time_us;
+    f->value_us = value_us;
+    *x = (int16_t)lroundf(filter_one_euro(&f->cfg, &f->axis[0], raw[0], dt));
+    *y = (int16_t)lroundf(filter_one_euro(&f->cfg, &f->axis[1], raw[1], dt));
+}
+
+void touch_filter_predict(const touch_filter_t *f, int64_t time_us, int16_t *x, int16_t *y)
+{
+    if (!f->active || !f->cfg.predict_max_us) {
+        return;
+    }
+    int64_t ahead_us = time_us - f->value_us;
+    int64_t max_us = f->cfg.predict_max_us + (f->last_us - f->value_us);
+    if (ahead_us <= 0) {
+        return;
+    }
+    if (ahead_us > max_us) {
+        ahead_us = max_us;
+    }
+    float ahead = ahead_us / 1000000.0f;
+    *x = (int16_t)lroundf(f->axis[0].value + f->axis[0].speed * ahead);
+    *y = (int16_t)lroundf(f->axis[1].value + f->axis[1].speed * ahead);
+}
@@ -0,0 +1,85 @@
+/**
+ * @file      touch_filter.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TOUCH_FILTER_MAX_MEDIAN     7
+
+typedef struct {
+    uint8_t median;             // window of the median stage, 1 turns it off
+    float min_cutoff_hz;        // one-euro cutoff at rest, 0 turns the stage off
+    float beta;                 // cutoff increase per px/s of speed
+    float d_cutoff_hz;          // cutoff of the speed estimate
+    uint32_t predict_max_us;    // longest extrapolation, 0 turns prediction off
+} touch_filter_config_t;
+
+#define TOUCH_FILTER_CONFIG_DEFAULT() { \
+    .median = 1,                        \
+    .min_cutoff_hz = 1.0f,              \
+    .beta = 0.05f,                      \
+    .d_cutoff_hz = 10.0f,               \
+    .predict_max_us = 30000,            \
+}
+
+// Resistive panels: a median for the spikes, a faster cutoff on drags to win back some of its lag
+#define TOUCH_FILTER_CONFIG_RESISTIVE() { \
+    .median = 3,                        \
+    .min_cutoff_hz = 1.0f,              \
+    .beta = 0.1f,                       \
+    .d_cutoff_hz = 10.0f,               \
+    .predict_max_us = 30000,            \
+}
+
+typedef struct {
+    float value;
+    float speed;                // px/s, low passed
+} touch_filter_axis_t;
+
+typedef struct {
+    touch_filter_config_t cfg;
+    touch_filter_axis_t axis[2];
+    int16_t history[2][TOUCH_FILTER_MAX_MEDIAN];
+    int64_t history_us[TOUCH_FILTER_MAX_MEDIAN];
+    uint8_t history_len;
+    uint8_t history_pos;
+    int64_t last_us;
+    int64_t value_us;           // time the filtered point stands for, behind last_us by the median lag
+    bool active;
+} touch_filter_t;
+
+/*
+ * Smoothing for one pointer: median of the last N raw positions, then a
+ * one-euro filter that follows fast drags closely and damps jitter at
+ * rest, then optional linear prediction. Works from the sample
+ * timestamps only, so it runs the same on host.
+ */
+void touch_filter_init(touch_filter_t *f, const touch_filter_config_t *cfg);
+
+// Forget the stroke, call on release
+void touch_filter_reset(touch_filter_t *f);
+
+// Filter a pressed sample in place
+void touch_filter_update(touch_filter_t *f, int64_t time_us, int16_t *x, int16_t *y);
+
+/*
+ * Position the stroke should have at time_us, extrapolated from the last
+ * filtered sample and its speed. The median lag is made up as well, on top
+ * of at most predict_max_us past the last sample.
+ */
+void touch_filter_predict(const touch_filter_t *f, int64_t time_us, int16_t *x, int16_t *y);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,190 @@
+/**
+ * @file      touch_input.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "product_pins.h"
+#include "touch_driver.h"
+#include "touch_input.h"
+#include "gesture.h"
+
+#if BOARD_HAS_TOUCH && defined(BOARD_TOUCH_IRQ) && CONFIG_LILYGO_TOUCH_IRQ
+
+#define TOUCH_TASK_STACK_SIZE   3072
+#define TOUCH_TASK_PRIORITY     5
+
+static const char *TAG = "touch_in";
+
+static touch_ring_t ring;
+static TaskHandle_t reader = NULL;
+static gesture_t gestures;
+static touch_gesture_cb_t gesture_cb = NULL;
+static void *gesture_user = NULL;
+
+static void IRAM_ATTR touch_input_isr(void *arg)
+{
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(reader, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void touch_input_gestures(int count, const gesture_event_t *events)
+{
+    touch_gesture_cb_t cb = gesture_cb;
+    for (int i = 0; cb && i < count; i++) {
+        cb(&events[i], gesture_user);
+    }
+}
+
+static bool touch_input_sample(touch_sample_t *s)
+{
+    int16_t x[TOUCH_INPUT_MAX_POINTS], y[TOUCH_INPUT_MAX_POINTS];
+    uint8_t count = touch_get_data(x, y, TOUCH_INPUT_MAX_POINTS);
+    if (count > TOUCH_INPUT_MAX_POINTS) {
+        count = TOUCH_INPUT_MAX_POINTS;
+    }
+    s->time_us = esp_timer_get_time();
+    s->count = count;
+    for (int i = 0; i < count; i++) {
+        s->points[i].x = x[i];
+        s->points[i].y = y[i];
+    }
+    return count;
+}
+
+static void touch_input_task(void *arg)
+{
+    gesture_event_t events[GESTURE_MAX_EVENTS];
+    touch_sample_t s = {0};
+    bool down = false;
+
+    while (1) {
+        // Idle until the controller interrupts or a gesture timer is due, follow the finger until it lifts
+        TickType_t wait = portMAX_DELAY;
+        if (down) {
+            wait = pdMS_TO_TICKS(TOUCH_INPUT_POLL_MS);
+        } else {
+            int64_t deadline = gesture_next_deadline(&gestures);
+            if (deadline >= 0) {
+                int64_t left_us = deadline - esp_timer_get_time();
+                wait = left_us > 0 ? pdMS_TO_TICKS(left_us / 1000) + 1 : 0;
+            }
+        }
+        bool irq = ulTaskNotifyTake(pdTRUE, wait) > 0;
+        if (!down && !irq) {
+            touch_input_gestures(gesture_poll(&gestures, esp_timer_get_time(), events), events);
+            continue;
+        }
+
+        // A release keeps the points of the last press, LVGL reports them with the released state
+        if (touch_input_sample(&s)) {
+            down = true;
+        } else if (down) {
+            down = false;
+        } else {
+            continue;
+        }
+        touch_ring_push(&ring, &s);
+        touch_input_gestures(gesture_feed(&gestures, &s, events), events);
+    }
+}
+
+bool touch_input_start(void)
+{
+    if (reader) {
+        return true;
+    }
+    if ((int)BOARD_TOUCH_IRQ < 0) {
+        return false;
+    }
+
+    gesture_init(&gestures, NULL);
+    if (xTaskCreate(touch_input_task, "touch", TOUCH_TASK_STACK_SIZE, NULL, TOUCH_TASK_PRIORITY, &reader) != pdPASS) {
+        ESP_LOGE(TAG, "no memory for the touch task");
+        reader = NULL;
+        return false;
+    }
+
+    gpio_config_t io_conf = {
+        .pin_bit_mask = 1ULL << BOARD_TOUCH_IRQ,
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_NEGEDGE,
+    };
+    esp_err_t ret = gpio_config(&io_conf);
+    if (ret == ESP_OK) {
+        // Someone else may have installed the service already
+        ret = gpio_install_isr_service(0);
+        if (ret == ESP_ERR_INVALID_STATE) {
+            ret = ESP_OK;
+        }
+    }
+    if (ret == ESP_OK) {
+        ret = gpio_isr_handler_add(BOARD_TOUCH_IRQ, touch_input_isr, NULL);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "touch IRQ unavailable (%s), polling instead", esp_err_to_name(ret));
+        gpio_set_intr_type(BOARD_TOUCH_IRQ, GPIO_INTR_DISABLE);
+        vTaskDelete(reader);
+        reader = NULL;
+        return false;
+    }
+
+    // A touch that started before the handler was attached has no edge left to catch
+    xTaskNotifyGive(reader);
+    ESP_LOGI(TAG, "touch reads gated by IRQ on GPIO%d", (int)BOARD_TOUCH_IRQ);
+    return true;
+}
+
+bool touch_input_active(void)
+{
+    return reader != NULL;
+}
+
+bool touch_input_read(touch_sample_t *sample, bool *more)
+{
+    bool ok = touch_ring_pop(&ring, sample);
+    *more = touch_ring_count(&ring) != 0;
+    return ok;
+}
+
+void touch_input_set_gesture_cb(touch_gesture_cb_t cb, void *user)
+{
+    gesture_user = user;
+    gesture_cb = cb;
+}
+
+#else
+
+bool touch_input_start(void)
+{
+    return false;
+}
+
+bool touch_input_active(void)
+{
+    return false;
+}
+
+bool touch_input_read(touch_sample_t *sample, bool *more)
+{
+    *more = false;
+    return false;
+}
+
+void touch_input_set_gesture_cb(touch_gesture_cb_t cb, void *user)
+{
+}
+
+#endif
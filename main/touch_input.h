@@ -0,0 +1,93 @@
+/**
+ * @file      touch_input.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TOUCH_INPUT_RING_SIZE   16      // power of two
+#define TOUCH_INPUT_POLL_MS     15      // read period while a finger is down
+#define TOUCH_INPUT_MAX_POINTS  5
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+} touch_point_t;
+
+typedef struct {
+    touch_point_t points[TOUCH_INPUT_MAX_POINTS];
+    uint8_t count;          // 0 is a release
+    int64_t time_us;
+} touch_sample_t;
+
+/*
+ * Single producer, single consumer ring. The reader task pushes, the LVGL
+ * read callback pops, neither side takes a lock. A full ring drops the
+ * new sample.
+ */
+typedef struct {
+    touch_sample_t slot[TOUCH_INPUT_RING_SIZE];
+    uint32_t head;          // written by the producer
+    uint32_t tail;          // written by the consumer
+} touch_ring_t;
+
+static inline bool touch_ring_push(touch_ring_t *r, const touch_sample_t *s)
+{
+    uint32_t head = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+    if (head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) == TOUCH_INPUT_RING_SIZE) {
+        return false;
+    }
+    r->slot[head & (TOUCH_INPUT_RING_SIZE - 1)] = *s;
+    __atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static inline bool touch_ring_pop(touch_ring_t *r, touch_sample_t *s)
+{
+    uint32_t tail = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+    if (__atomic_load_n(&r->head, __ATOMIC_ACQUIRE) == tail) {
+        return false;
+    }
+    *s = r->slot[tail & (TOUCH_INPUT_RING_SIZE - 1)];
+    __atomic_store_n(&r->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static inline uint32_t touch_ring_count(touch_ring_t *r)
+{
+    return __atomic_load_n(&r->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+}
+
+struct gesture_event;
+typedef void (*touch_gesture_cb_t)(const struct gesture_event *event, void *user);
+
+/*
+ * Read the touch controller from a task woken by its interrupt line
+ * instead of polling it from LVGL. While a finger is down the task keeps
+ * reading every TOUCH_INPUT_POLL_MS until the release, idle panels cause
+ * no bus traffic. Call after touch_init(), false keeps the polling path.
+ */
+bool touch_input_start(void);
+
+// True once touch_input_start() succeeded
+bool touch_input_active(void);
+
+// Oldest unread sample, *more tells whether others are queued behind it
+bool touch_input_read(touch_sample_t *sample, bool *more);
+
+// Gestures recognised from the samples, called from the reader task
+void touch_input_set_gesture_cb(touch_gesture_cb_t cb, void *user);
+
+#ifdef __cplusplus
+}
+#endif
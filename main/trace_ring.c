@@ -0,0 +1,156 @@
+/**
+ * @file      trace_ring.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "trace_ring.h"
+
+#if !defined(ESP_PLATFORM) || CONFIG_LILYGO_TRACE_RING
+
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#include "esp_timer.h"
+#define TRACE_IRAM      IRAM_ATTR
+#else
+#include <time.h>
+#define TRACE_IRAM
+#endif
+
+#define TRACE_MASK      (TRACE_RING_SIZE - 1)
+
+_Static_assert((TRACE_RING_SIZE & TRACE_MASK) == 0, "trace ring size must be a power of two");
+
+static trace_event_t ring[TRACE_RING_SIZE];
+static uint32_t head;
+
+static TRACE_IRAM uint32_t trace_now_us(void)
+{
+#ifdef ESP_PLATFORM
+    return (uint32_t)esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+#endif
+}
+
+void TRACE_IRAM trace_ring_record(uint8_t type, uint8_t arg, int16_t a, int16_t b, int16_t c, uint32_t d)
+{
+    uint32_t index = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+    trace_event_t *e = &ring[index & TRACE_MASK];
+
+    // Readers skip the slot until seq matches again
+    __atomic_store_n(&e->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    e->time_us = trace_now_us();
+    e->type = type;
+    e->arg = arg;
+    e->a = a;
+    e->b = b;
+    e->c = c;
+    e->d = d;
+    __atomic_store_n(&e->seq, index + 1, __ATOMIC_RELEASE);
+}
+
+size_t trace_ring_snapshot(trace_event_t *out, size_t max)
+{
+    uint32_t end = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    uint32_t count = end < TRACE_RING_SIZE ? end : TRACE_RING_SIZE;
+    if (count > max) {
+        count = max;
+    }
+    size_t n = 0;
+    for (uint32_t index = end - count; index != end; index++) {
+        const trace_event_t *e = &ring[index & TRACE_MASK];
+        if (__atomic_load_n(&e->seq, __ATOMIC_ACQUIRE) != index + 1) {
+            continue;
+        }
+        out[n] = *e;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        // Overwritten while it was copied
+        if (__atomic_load_n(&e->seq, __ATOMIC_RELAXED) != index + 1) {
+            continue;
+        }
+        out[n].seq = index + 1;
+        n++;
+    }
+    return n;
+}
+
+void trace_ring_clear(void)
+{
+    for (size_t i = 0; i < TRACE_RING_SIZE; i++) {
+        __atomic_store_n(&ring[i].seq, 0, __ATOMIC_RELAXED);
+    }
+}
+
+static trace_event_t *trace_take(size_t *count)
+{
+    trace_event_t *events = malloc(TRACE_RING_SIZE * sizeof(*events));
+    *count = events ? trace_ring_snapshot(events, TRACE_RING_SIZE) : 0;
+    return events;
+}
+
+void trace_ring_dump(FILE *out)
+{
+    size_t count;
+    trace_event_t *events = trace_take(&count);
+    if (!events) {
+        fputs("trace: no memory\n", out);
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        const trace_event_t *e = &events[i];
+        fprintf(out, "%10lu ", (unsigned long)e->time_us);
+        switch (e->type) {
+        case TRACE_EV_TOUCH:
+            fprintf(out, "touch   x %d y %d points %d type %u\n", e->a, e->b, e->c, e->arg);
+            break;
+        case TRACE_EV_FLUSH_START:
+            fprintf(out, "flush   %d,%d %dx%lu\n", e->a, e->b, e->c, (unsigned long)e->d);
+            break;
+        case TRACE_EV_FLUSH_END:
+            fputs("flushed\n", out);
+            break;
+        case TRACE_EV_I2C:
+            fprintf(out, "i2c     0x%02x reg 0x%02x len %d err 0x%x %lu us\n", e->arg, (uint8_t)e->a, e->b,
+                    (unsigned)(uint16_t)e->c, (unsigned long)e->d);
+            break;
+        case TRACE_EV_GESTURE:
+            fprintf(out, "gesture %u at %d,%d value %d\n", e->arg, e->a, e->b, e->c);
+            break;
+        default:
+            fprintf(out, "type %u %u %d %d %d %lu\n", e->type, e->arg, e->a, e->b, e->c, (unsigned long)e->d);
+            break;
+        }
+    }
+    fprintf(out, "%u records, %lu written\n", (unsigned)count, (unsigned long)__atomic_load_n(&head, __ATOMIC_RELAXED));
+    free(events);
+}
+
+void trace_ring_export(FILE *out)
+{
+    size_t count;
+    trace_event_t *events = trace_take(&count);
+    if (!events) {
+        fputs("trace: no memory\n", out);
+        return;
+    }
+    fprintf(out, "--- trace_ring %u %u ---\n", (unsigned)sizeof(trace_event_t), (unsigned)count);
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *p = (const uint8_t *)&events[i];
+        for (size_t j = 0; j < sizeof(trace_event_t); j++) {
+            fprintf(out, "%02x", p[j]);
+        }
+        fputc('\n', out);
+    }
+    fputs("--- end trace_ring ---\n", out);
+    free(events);
+}
+
+#endif
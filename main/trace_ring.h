@@ -0,0 +1,109 @@
+/**
+ * @file      trace_ring.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CONFIG_LILYGO_TRACE_RING_SIZE
+#define TRACE_RING_SIZE     CONFIG_LILYGO_TRACE_RING_SIZE
+#else
+#define TRACE_RING_SIZE     256
+#endif
+
+typedef enum {
+    TRACE_EV_TOUCH = 1,         // a = x, b = y, c = points, arg = gesture/type byte
+    TRACE_EV_FLUSH_START,       // a = x, b = y, c = width, d = height
+    TRACE_EV_FLUSH_END,
+    TRACE_EV_I2C,               // arg = address, a = register, b = length, c = esp_err_t, d = duration us
+    TRACE_EV_GESTURE,           // arg = gesture_type_t, a = x, b = y, c = pinch scale x100 or rotation degrees
+} trace_ev_type_t;
+
+// 20 bytes, the layout tools/trace_decode.py reads
+typedef struct {
+    uint32_t seq;               // index + 1, written last
+    uint32_t time_us;           // low 32 bits of the esp_timer time
+    uint8_t type;
+    uint8_t arg;
+    int16_t a;
+    int16_t b;
+    int16_t c;
+    uint32_t d;
+} trace_event_t;
+
+#if !defined(ESP_PLATFORM) || CONFIG_LILYGO_TRACE_RING
+
+/*
+ * Fixed ring of typed binary records, the oldest are overwritten. Recording
+ * is one atomic add and a 20 byte store, no formatting and no lock, so it
+ * is safe from any task and from ISRs.
+ */
+void trace_ring_record(uint8_t type, uint8_t arg, int16_t a, int16_t b, int16_t c, uint32_t d);
+
+// Consistent copy of the records still in the ring, oldest first
+size_t trace_ring_snapshot(trace_event_t *out, size_t max);
+
+// One line per record
+void trace_ring_dump(FILE *out);
+
+// Hex block for tools/trace_decode.py, paste a captured log into it
+void trace_ring_export(FILE *out);
+
+void trace_ring_clear(void);
+
+#else
+
+static inline void trace_ring_record(uint8_t type, uint8_t arg, int16_t a, int16_t b, int16_t c, uint32_t d) {}
+static inline size_t trace_ring_snapshot(trace_event_t *out, size_t max)
+{
+    return 0;
+}
+static inline void trace_ring_dump(FILE *out) {}
+static inline void trace_ring_export(FILE *out) {}
+static inline void trace_ring_clear(void) {}
+
+#endif
+
+static inline void trace_touch(int16_t x, int16_t y, uint8_t points, uint8_t type)
+{
+    trace_ring_record(TRACE_EV_TOUCH, type, x, y, points, 0);
+}
+
+static inline void trace_flush_start(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    trace_ring_record(TRACE_EV_FLUSH_START, 0, x, y, w, (uint32_t)h);
+}
+
+static inline void trace_flush_end(void)
+{
+    trace_ring_record(TRACE_EV_FLUSH_END, 0, 0, 0, 0, 0);
+}
+
+static inline void trace_i2c(uint8_t address, uint8_t reg, uint16_t len, int err, uint32_t duration_us)
+{
+    trace_ring_record(TRACE_EV_I2C, address, reg, (int16_t)len, (int16_t)err, duration_us);
+}
+
+static inline void trace_gesture(uint8_t type, int16_t x, int16_t y, int16_t value)
+{
+    trace_ring_record(TRACE_EV_GESTURE, type, x, y, value, 0);
+}
+
+#ifdef __cplusplus
+}
+#endif
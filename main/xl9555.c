@@ -0,0 +1,261 @@
+/**
+ * @file      xl9555.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "xl9555.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#define XL9555_LOCK(dev)    xSemaphoreTakeRecursive((SemaphoreHandle_t)(dev)->lock, portMAX_DELAY)
+#define XL9555_UNLOCK(dev)  xSemaphoreGiveRecursive((SemaphoreHandle_t)(dev)->lock)
+#else
+#define XL9555_LOCK(dev)
+#define XL9555_UNLOCK(dev)
+#endif
+
+#define PIN_PORT(pin)   ((pin) >> 3)
+#define PIN_MASK(pin)   (1U << ((pin) & 7))
+
+#define DIRTY_OUT       0x01
+#define DIRTY_CFG       0x02
+
+// Chip select low, two states per bit, chip select high
+#define SPI9_STATES_PER_WORD    (1 + 9 * 2 + 1)
+
+static int xl9555_write_pair(xl9555_t *dev, uint8_t reg, const uint8_t *value)
+{
+    uint8_t buf[3] = {reg, value[0], value[1]};
+    return dev->bus.write(dev->bus.user, buf, sizeof(buf));
+}
+
+static int xl9555_flush_locked(xl9555_t *dev)
+{
+    int ret = 0;
+    if (dev->dirty & DIRTY_OUT) {
+        ret = xl9555_write_pair(dev, XL9555_REG_OUTPUT0, dev->out);
+    }
+    if (ret == 0 && (dev->dirty & DIRTY_CFG)) {
+        ret = xl9555_write_pair(dev, XL9555_REG_CONFIG0, dev->cfg);
+    }
+    if (ret == 0) {
+        dev->dirty = 0;
+    }
+    return ret;
+}
+
+int xl9555_sync(xl9555_t *dev)
+{
+    XL9555_LOCK(dev);
+    int ret = dev->bus.read(dev->bus.user, XL9555_REG_OUTPUT0, dev->out, 2);
+    if (ret == 0) {
+        ret = dev->bus.read(dev->bus.user, XL9555_REG_CONFIG0, dev->cfg, 2);
+    }
+    dev->dirty = 0;
+    XL9555_UNLOCK(dev);
+    return ret;
+}
+
+int xl9555_init(xl9555_t *dev, const xl9555_bus_t *bus)
+{
+    memset(dev, 0, sizeof(*dev));
+    dev->bus = *bus;
+#ifdef ESP_PLATFORM
+    dev->lock = xSemaphoreCreateRecursiveMutex();
+    if (!dev->lock) {
+        return -1;
+    }
+#endif
+    int ret = xl9555_sync(dev);
+#ifdef ESP_PLATFORM
+    // Callers retry with the same struct, each attempt creates its own lock
+    if (ret != 0) {
+        vSemaphoreDelete((SemaphoreHandle_t)dev->lock);
+        dev->lock = NULL;
+    }
+#endif
+    return ret;
+}
+
+int xl9555_pin_mode(xl9555_t *dev, uint8_t pin, bool output)
+{
+    if (pin >= XL9555_PIN_COUNT) {
+        return -1;
+    }
+    int ret = 0;
+    XL9555_LOCK(dev);
+    uint8_t cfg = output ? dev->cfg[PIN_PORT(pin)] & ~PIN_MASK(pin) : dev->cfg[PIN_PORT(pin)] | PIN_MASK(pin);
+    if (cfg != dev->cfg[PIN_PORT(pin)]) {
+        dev->cfg[PIN_PORT(pin)] = cfg;
+        dev->dirty |= DIRTY_CFG;
+        if (!dev->batch) {
+            ret = xl9555_flush_locked(dev);
+        }
+    }
+    XL9555_UNLOCK(dev);
+    return ret;
+}
+
+int xl9555_write(xl9555_t *dev, uint8_t pin, bool level)
+{
+    if (pin >= XL9555_PIN_COUNT) {
+        return -1;
+    }
+    int ret = 0;
+    XL9555_LOCK(dev);
+    uint8_t out = level ? dev->out[PIN_PORT(pin)] | PIN_MASK(pin) : dev->out[PIN_PORT(pin)] & ~PIN_MASK(pin);
+    if (out != dev->out[PIN_PORT(pin)]) {
+        dev->out[PIN_PORT(pin)] = out;
+        dev->dirty |= DIRTY_OUT;
+        if (!dev->batch) {
+            ret = xl9555_flush_locked(dev);
+        }
+    }
+    XL9555_UNLOCK(dev);
+    return ret;
+}
+
+int xl9555_read(xl9555_t *dev, uint8_t pin)
+{
+    if (pin >= XL9555_PIN_COUNT) {
+        return -1;
+    }
+    uint8_t in = 0;
+    XL9555_LOCK(dev);
+    int ret = xl9555_flush_locked(dev);
+    if (ret == 0) {
+        ret = dev->bus.read(dev->bus.user, XL9555_REG_INPUT0 + PIN_PORT(pin), &in, 1);
+    }
+    XL9555_UNLOCK(dev);
+    if (ret != 0) {
+        return -1;
+    }
+    return (in & PIN_MASK(pin)) ? 1 : 0;
+}
+
+void xl9555_batch_begin(xl9555_t *dev)
+{
+    XL9555_LOCK(dev);
+    dev->batch++;
+    XL9555_UNLOCK(dev);
+}
+
+int xl9555_batch_end(xl9555_t *dev)
+{
+    int ret = 0;
+    XL9555_LOCK(dev);
+    if (dev->batch && --dev->batch == 0) {
+        ret = xl9555_flush_locked(dev);
+    }
+    XL9555_UNLOCK(dev);
+    return ret;
+}
+
+int xl9555_flush(xl9555_t *dev)
+{
+    XL9555_LOCK(dev);
+    int ret = xl9555_flush_locked(dev);
+    XL9555_UNLOCK(dev);
+    return ret;
+}
+
+int xl9555_spi9_begin(xl9555_t *dev, const xl9555_spi9_t *spi)
+{
+    if (PIN_PORT(spi->cs) != PIN_PORT(spi->sclk) || PIN_PORT(spi->cs) != PIN_PORT(spi->mosi)) {
+        return -1;
+    }
+    // Idle: deselected, clock low
+    xl9555_batch_begin(dev);
+    xl9555_write(dev, spi->cs, true);
+    xl9555_write(dev, spi->sclk, false);
+    xl9555_pin_mode(dev, spi->cs, true);
+    xl9555_pin_mode(dev, spi->sclk, true);
+    xl9555_pin_mode(dev, spi->mosi, true);
+    return xl9555_batch_end(dev);
+}
+
+int xl9555_spi9_write(xl9555_t *dev, const xl9555_spi9_t *spi, const uint16_t *words, size_t count)
+{
+    const uint8_t port = PIN_PORT(spi->cs);
+    const uint8_t cs = PIN_MASK(spi->cs);
+    const uint8_t sclk = PIN_MASK(spi->sclk);
+    const uint8_t mosi = PIN_MASK(spi->mosi);
+
+    XL9555_LOCK(dev);
+    int ret = xl9555_flush_locked(dev);
+    const uint8_t other = dev->out[port ^ 1];
+
+    // Register pairs alternate on every data byte, so each state is followed by the other port unchanged
+    uint8_t buf[1 + XL9555_SPI9_BURST_WORDS * SPI9_STATES_PER_WORD * 2];
+    uint8_t state = dev->out[port];
+
+    while (ret == 0 && count) {
+        size_t n = count < XL9555_SPI9_BURST_WORDS ? count : XL9555_SPI9_BURST_WORDS;
+        uint8_t *p = buf;
+        *p++ = XL9555_REG_OUTPUT0 + port;
+
+        for (size_t w = 0; w < n; w++) {
+            uint16_t word = words[w];
+            state &= ~cs;
+            *p++ = state;
+            *p++ = other;
+            for (int bit = 8; bit >= 0; bit--) {
+                state &= ~sclk;
+                state = (word >> bit) & 1 ? state | mosi : state & ~mosi;
+                *p++ = state;
+                *p++ = other;
+                state |= sclk;
+                *p++ = state;
+                *p++ = other;
+            }
+            state = (state | cs) & ~sclk;
+            *p++ = state;
+            *p++ = other;
+        }
+
+        ret = dev->bus.write(dev->bus.user, buf, p - buf);
+        if (ret == 0) {
+            dev->out[port] = state;
+        }
+        words += n;
+        count -= n;
+    }
+    XL9555_UNLOCK(dev);
+    return ret;
+}
+
+#ifdef ESP_PLATFORM
+#include "i2c_sched.h"
+
+#define XL9555_I2C_SPEED_HZ     400000
+
+static int xl9555_i2c_write(void *user, const uint8_t *data, size_t len)
+{
+    return i2c_sched_write((intptr_t)user, I2C_SCHED_PRIO_IO, data, len);
+}
+
+static int xl9555_i2c_read(void *user, uint8_t reg, uint8_t *data, size_t len)
+{
+    return i2c_sched_read((intptr_t)user, I2C_SCHED_PRIO_IO, reg, data, len);
+}
+
+int xl9555_init_i2c(xl9555_t *dev, uint8_t address)
+{
+    int device = i2c_sched_device("xl9555", address, XL9555_I2C_SPEED_HZ);
+    if (device < 0) {
+        return ESP_FAIL;
+    }
+    xl9555_bus_t ops = {
+        .write = xl9555_i2c_write,
+        .read = xl9555_i2c_read,
+        .user = (void *)(intptr_t)device,
+    };
+    return xl9555_init(dev, &ops);
+}
+
+#endif
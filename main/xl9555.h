@@ -0,0 +1,98 @@
+/**
+ * @file      xl9555.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define XL9555_REG_INPUT0       0x00
+#define XL9555_REG_OUTPUT0      0x02
+#define XL9555_REG_CONFIG0      0x06
+
+#define XL9555_PIN_COUNT        16
+#define XL9555_ADDR_DEFAULT     0x20
+
+// 9-bit words queued per I2C burst, each word takes 40 bytes on the bus
+#define XL9555_SPI9_BURST_WORDS 8
+
+/*
+ * I2C transport. write() gets the register address in data[0],
+ * both return 0 on success.
+ */
+typedef struct {
+    int (*write)(void *user, const uint8_t *data, size_t len);
+    int (*read)(void *user, uint8_t reg, uint8_t *data, size_t len);
+    void *user;
+} xl9555_bus_t;
+
+/*
+ * Output and configuration registers are shadowed, so setting a pin is a
+ * single register write instead of an I2C read-modify-write, and writes
+ * that change nothing never reach the bus.
+ */
+typedef struct {
+    xl9555_bus_t bus;
+    uint8_t out[2];
+    uint8_t cfg[2];         // 1 = input
+    uint8_t dirty;
+    uint8_t batch;
+    void *lock;
+} xl9555_t;
+
+// 3-wire SPI (9-bit words, data/command flag first) bit-banged on expander pins of one port
+typedef struct {
+    uint8_t cs;
+    uint8_t sclk;
+    uint8_t mosi;
+} xl9555_spi9_t;
+
+int xl9555_init(xl9555_t *dev, const xl9555_bus_t *bus);
+
+// Reload the shadows after something else wrote the expander
+int xl9555_sync(xl9555_t *dev);
+
+int xl9555_pin_mode(xl9555_t *dev, uint8_t pin, bool output);
+
+int xl9555_write(xl9555_t *dev, uint8_t pin, bool level);
+
+// Input level of the pin, pending changes are flushed first
+int xl9555_read(xl9555_t *dev, uint8_t pin);
+
+/*
+ * Between begin and end, pin changes only touch the shadows. end() sends
+ * them with at most one write per register pair, outputs before directions
+ * so a pin switched to output starts at its new level. Calls may nest.
+ */
+void xl9555_batch_begin(xl9555_t *dev);
+int xl9555_batch_end(xl9555_t *dev);
+
+// Send pending shadow changes now, also inside a batch
+int xl9555_flush(xl9555_t *dev);
+
+int xl9555_spi9_begin(xl9555_t *dev, const xl9555_spi9_t *spi);
+
+/*
+ * The pin waveform for all words is computed up front and written as
+ * multi-byte bursts to the output register pair, one state per byte.
+ */
+int xl9555_spi9_write(xl9555_t *dev, const xl9555_spi9_t *spi, const uint16_t *words, size_t count);
+
+#ifdef ESP_PLATFORM
+// On the board bus, through the I2C scheduler at IO priority
+int xl9555_init_i2c(xl9555_t *dev, uint8_t address);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
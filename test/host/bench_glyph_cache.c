@@ -0,0 +1,247 @@
+/**
+ * @file      bench_glyph_cache.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "host_test.h"
+#include "lvgl.h"
+#include "cache_store.h"
+
+/*
+ * Dashboard digit draws with and without the glyph sprite cache:
+ *   stock    what lv_draw_sw_letter() does per draw for a 1 bpp glyph:
+ *            fetch the bitmap, unpack it to a coverage mask, blend
+ *   cached   what glyph_cache.c does: unpack once into an A8 sprite in a
+ *            cache_store, then every draw is one blend with the sprite
+ * Both blend with the same RGB565 mix, so the difference is the per draw
+ * fetch and unpack. Both paths must paint identical frames.
+ *
+ *   bench_glyph_cache [frames]
+ */
+#define FB_W            320
+#define FB_H            240
+#define DEFAULT_FRAMES  200
+
+extern const lv_font_t industry_120;
+extern const lv_font_t industry_90;
+extern const lv_font_t industry_black_100;
+
+typedef struct {
+    const lv_font_t *font;
+    const char *name;
+    const char *text;
+    lv_coord_t x;
+    lv_coord_t y;
+    lv_color_t color;
+} dash_label_t;
+
+// Current temperature, target temperature and timer of the main.cpp dashboard
+static const dash_label_t dashboard[] = {
+    {&industry_120, "industry_120", "23", 10, 10, {.full = 0xFFFF}},
+    {&industry_90, "industry_90", "25", 180, 20, {.full = 0xFD20}},
+    {&industry_90, "industry_90", "1230", 10, 140, {.full = 0x07E0}},
+};
+
+static lv_color_t fb[FB_H][FB_W];
+static lv_opa_t mask_buf[256 * 256];
+static cache_store_t sprites;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// lv_color_mix() for RGB565
+static lv_color_t mix(lv_color_t c1, lv_color_t c2, lv_opa_t a)
+{
+    lv_color_t r;
+    r.ch.red = (c1.ch.red * a + c2.ch.red * (255 - a) + 128) / 255;
+    r.ch.green = (c1.ch.green * a + c2.ch.green * (255 - a) + 128) / 255;
+    r.ch.blue = (c1.ch.blue * a + c2.ch.blue * (255 - a) + 128) / 255;
+    return r;
+}
+
+static void blend(const lv_opa_t *mask, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, lv_color_t color)
+{
+    for (lv_coord_t row = 0; row < h; row++) {
+        if (y + row < 0 || y + row >= FB_H) {
+            continue;
+        }
+        lv_color_t *dst = &fb[y + row][0];
+        const lv_opa_t *m = &mask[row * w];
+        for (lv_coord_t col = 0; col < w; col++) {
+            if (x + col < 0 || x + col >= FB_W) {
+                continue;
+            }
+            lv_opa_t a = m[col];
+            if (a == LV_OPA_COVER) {
+                dst[x + col] = color;
+            } else if (a != LV_OPA_TRANSP) {
+                dst[x + col] = mix(color, dst[x + col], a);
+            }
+        }
+    }
+}
+
+// Unpack of lv_draw_sw_letter() and glyph_fill(): packed rows, no padding
+static void unpack(const uint8_t *bitmap, uint8_t bpp, uint32_t count, lv_opa_t *out)
+{
+    uint8_t m = (1 << bpp) - 1;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t bit = i * bpp;
+        uint8_t v = (bitmap[bit >> 3] >> (8 - bpp - (bit & 7))) & m;
+        out[i] = (lv_opa_t)((v * 255) / m);
+    }
+}
+
+static bool place(const lv_font_t *font, uint32_t letter, lv_coord_t *x, lv_coord_t y,
+                  lv_font_glyph_dsc_t *g, lv_coord_t *gx, lv_coord_t *gy)
+{
+    if (!lv_font_get_glyph_dsc(font, g, letter, 0)) {
+        return false;
+    }
+    *gx = *x + g->ofs_x;
+    *gy = y + (font->line_height - font->base_line) - g->box_h - g->ofs_y;
+    *x += g->adv_w;
+    return g->box_w && g->box_h;
+}
+
+static void draw_stock(const dash_label_t *l)
+{
+    lv_coord_t x = l->x, gx, gy;
+    for (const char *p = l->text; *p; p++) {
+        lv_font_glyph_dsc_t g;
+        if (!place(l->font, (uint8_t)*p, &x, l->y, &g, &gx, &gy)) {
+            continue;
+        }
+        const uint8_t *bitmap = lv_font_get_glyph_bitmap(l->font, (uint8_t)*p);
+        if (!bitmap) {
+            continue;
+        }
+        unpack(bitmap, g.bpp, (uint32_t)g.box_w * g.box_h, mask_buf);
+        blend(mask_buf, gx, gy, g.box_w, g.box_h, l->color);
+    }
+}
+
+typedef struct {
+    const lv_font_t *font;
+    const lv_font_glyph_dsc_t *g;
+    uint32_t letter;
+} sprite_job_t;
+
+static bool sprite_fill(void *buf, size_t size, void *user_data)
+{
+    sprite_job_t *job = (sprite_job_t *)user_data;
+    const uint8_t *bitmap = lv_font_get_glyph_bitmap(job->font, job->letter);
+    if (!bitmap) {
+        return false;
+    }
+    unpack(bitmap, job->g->bpp, (uint32_t)job->g->box_w * job->g->box_h, (lv_opa_t *)buf);
+    return true;
+}
+
+static void draw_cached(const dash_label_t *l)
+{
+    lv_coord_t x = l->x, gx, gy;
+    for (const char *p = l->text; *p; p++) {
+        lv_font_glyph_dsc_t g;
+        if (!place(l->font, (uint8_t)*p, &x, l->y, &g, &gx, &gy)) {
+            continue;
+        }
+        cache_key_t key;
+        memset(&key, 0, sizeof(key));
+        uint64_t fp = (uintptr_t)l->font;
+        key.w[0] = (uint32_t)fp;
+        key.w[1] = (uint32_t)(fp >> 32);
+        key.w[2] = (uint8_t)*p;
+        sprite_job_t job = {l->font, &g, (uint8_t)*p};
+        lv_opa_t *sprite = cache_store_get(&sprites, &key, (size_t)g.box_w * g.box_h, sprite_fill, &job);
+        if (sprite) {
+            blend(sprite, gx, gy, g.box_w, g.box_h, l->color);
+        }
+    }
+}
+
+static uint32_t glyph_count(const dash_label_t *labels, size_t n)
+{
+    uint32_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        count += strlen(labels[i].text);
+    }
+    return count;
+}
+
+// ns per glyph for `frames` redraws of the labels
+static double run(void (*draw)(const dash_label_t *), const dash_label_t *labels, size_t n, int frames)
+{
+    uint64_t start = now_ns();
+    for (int f = 0; f < frames; f++) {
+        for (size_t i = 0; i < n; i++) {
+            draw(&labels[i]);
+        }
+    }
+    return (double)(now_ns() - start) / ((double)frames * glyph_count(labels, n));
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : DEFAULT_FRAMES;
+    const size_t labels = sizeof(dashboard) / sizeof(dashboard[0]);
+    CHECK(cache_store_init(&sprites, "glyph", 128 * 1024, 64, CACHE_STORE_CAPS_PSRAM));
+
+    // Same pixels from both paths
+    static lv_color_t stock_fb[FB_H][FB_W];
+    memset(fb, 0, sizeof(fb));
+    for (size_t i = 0; i < labels; i++) {
+        draw_stock(&dashboard[i]);
+    }
+    memcpy(stock_fb, fb, sizeof(fb));
+    memset(fb, 0, sizeof(fb));
+    for (size_t i = 0; i < labels; i++) {
+        draw_cached(&dashboard[i]);
+    }
+    CHECK(memcmp(stock_fb, fb, sizeof(fb)) == 0);
+    uint32_t painted = 0;
+    for (int y = 0; y < FB_H; y++) {
+        for (int x = 0; x < FB_W; x++) {
+            painted += fb[y][x].full != 0;
+        }
+    }
+    CHECK(painted > 1000);
+
+    // One sprite per distinct glyph, every later draw a hit
+    uint32_t misses = sprites.stats.misses;
+    double stock_ns = run(draw_stock, dashboard, labels, frames);
+    double cached_ns = run(draw_cached, dashboard, labels, frames);
+    CHECK(sprites.stats.misses == misses);
+
+    printf("dashboard, %d frames of %u glyphs\n", frames, (unsigned)glyph_count(dashboard, labels));
+    printf("  stock   %8.0f ns/glyph\n", stock_ns);
+    printf("  cached  %8.0f ns/glyph  (%.2fx)\n", cached_ns, stock_ns / cached_ns);
+
+    // Per font, all ten digits
+    static const struct {
+        const lv_font_t *font;
+        const char *name;
+    } fonts[] = {
+        {&industry_120, "industry_120"},
+        {&industry_90, "industry_90"},
+        {&industry_black_100, "industry_black_100"},
+    };
+    for (size_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        dash_label_t digits = {fonts[i].font, fonts[i].name, "0123456789", 0, 0, {.full = 0xFFFF}};
+        double s = run(draw_stock, &digits, 1, frames);
+        double c = run(draw_cached, &digits, 1, frames);
+        printf("  %-20s stock %8.0f  cached %8.0f ns/glyph  (%.2fx)\n", fonts[i].name, s, c, s / c);
+    }
+    cache_store_dump(&sprites);
+    return host_test_result();
+}
@@ -0,0 +1,87 @@
+// Generated by tools/font_rle.py --reference from the lv_font_conv output, do not edit
+#pragma once
+
+#include <stdint.h>
+#include "lvgl.h"
+
+extern const lv_font_t fa_symbol_40;
+static const uint32_t fa_symbol_40_crc[] = {
+    0xb9b7381b, 0xf7d7fd35, 0xa9b37b39, 0x943bd814, 0x63ff4dde, 0xfa2fb29e,
+    0xd55343f9, 0x722a2ea9, 0x31d3192d, 0x4d483213, 0x52e6ccb6, 0x7e63a1ae,
+    0xd02ec2b4, 0x3153fdb3, 0xbd42982a, 0x78985ec8, 0x2b586284, 0xfb0514ef,
+    0x873ddc0c, 0x44a47d89, 0x019e8b4b, 0xf89d890c, 0x9e1a9194, 0x9a4603e2,
+    0x9f0c1ebb, 0x5fa020cc, 0xa5cc614d, 0x2d890b2f, 0x32fb49f6, 0xcccecaa6,
+    0xc24e2e95, 0xe4d1b9f8, 0x8fc7d6e9, 0x4dc96647, 0x55165063, 0xe510814a,
+    0x44fd381d, 0x320b6ac5, 0x41698a99, 0xd73c12e0, 0x8a93da3a, 0xd91c9ec1,
+    0xde04c2a5, 0x4d293416, 0xe3302fdb, 0x0b4917e9, 0x7775e393, 0x7067f1b2,
+    0x8bb74509, 0x2abeb725, 0x487ad1ea, 0x2da437de, 0xe29a9fa8, 0x1f04805c,
+    0xe551680c, 0xa371b91b, 0x47032987,
+};
+
+extern const lv_font_t industry_120;
+static const uint32_t industry_120_crc[] = {
+    0x5fad10f7, 0x6cd00bff, 0x17c3143b, 0x3b5e05cf, 0x7345cb0c, 0xf1c8c986,
+    0xb37cd49f, 0x716fec52, 0xd45c461c, 0x50298fc7, 0x1cbbafec, 0xef60dff2,
+    0x1307a250,
+};
+
+extern const lv_font_t industry_30;
+static const uint32_t industry_30_crc[] = {
+    0xd1a18d2b, 0xe5d6219f, 0xf0e6839c,
+};
+
+extern const lv_font_t industry_40;
+static const uint32_t industry_40_crc[] = {
+    0x35881e8a, 0x62176c51, 0x8c3b40af,
+};
+
+extern const lv_font_t industry_50;
+static const uint32_t industry_50_crc[] = {
+    0x91aa1270, 0xd7e8d542, 0x33d2a4eb,
+};
+
+extern const lv_font_t industry_60;
+static const uint32_t industry_60_crc[] = {
+    0x6269ee50, 0x23f44752, 0xcde810b9, 0x29cfa615, 0xca01593d, 0x9b840855,
+    0xa8d151b7, 0x3c8af956, 0xee28df31, 0xb515e9d1, 0xb515bea4, 0xa9a4eb1e,
+    0xa80bba65,
+};
+
+extern const lv_font_t industry_90;
+static const uint32_t industry_90_crc[] = {
+    0x1a09631b, 0x7731a8c8, 0xb4b86bd5, 0x72b8e6d4, 0x152b1fa6, 0xb61d291a,
+    0x339769da, 0x377a82cc, 0x2942e61a, 0x0c8c8eb5, 0x57ab1f4f, 0xcd155076,
+    0x436b7950,
+};
+
+extern const lv_font_t industry_black_100;
+static const uint32_t industry_black_100_crc[] = {
+    0xff6cab0b, 0xd046e01d, 0x59c5a2ee, 0xf5d51f8a, 0x58aebeea, 0xc3ecefd6,
+    0x5b898844, 0xd26dde19, 0xdd25c302, 0x0314eaa1, 0x865d4389, 0x0f2ebc68,
+};
+
+extern const lv_font_t industry_black_80;
+static const uint32_t industry_black_80_crc[] = {
+    0x658bfef2, 0xa6223a94, 0x4d35b33f, 0x8cb5f497, 0x8588984c, 0x60d61616,
+    0xb20d7c74, 0x444cd118, 0x9401229d, 0xa0144fc6, 0x58c09756, 0x1315e592,
+    0xd1904108,
+};
+
+// Glyph ids 1..glyphs, raw_bytes is the uncompressed glyph_bitmap[]
+static const struct {
+    const lv_font_t *font;
+    const char *name;
+    uint16_t glyphs;
+    uint32_t raw_bytes;
+    const uint32_t *crc;
+} font_rle_reference[] = {
+    {&fa_symbol_40, "fa_symbol_40", 57, 9130, fa_symbol_40_crc},
+    {&industry_120, "industry_120", 13, 6913, industry_120_crc},
+    {&industry_30, "industry_30", 3, 87, industry_30_crc},
+    {&industry_40, "industry_40", 3, 153, industry_40_crc},
+    {&industry_50, "industry_50", 3, 239, industry_50_crc},
+    {&industry_60, "industry_60", 13, 1753, industry_60_crc},
+    {&industry_90, "industry_90", 13, 3864, industry_90_crc},
+    {&industry_black_100, "industry_black_100", 12, 4721, industry_black_100_crc},
+    {&industry_black_80, "industry_black_80", 13, 3122, industry_black_80_crc},
+};
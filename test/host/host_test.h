@@ -0,0 +1,30 @@
+/**
+ * @file      host_test.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+
+// A failed check is reported and counted, the test keeps going
+static int host_test_failures;
+
+#define CHECK(cond) do {                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            host_test_failures++;                                               \
+        }                                                                       \
+    } while (0)
+
+static inline int host_test_result(void)
+{
+    if (host_test_failures) {
+        fprintf(stderr, "%d check(s) failed\n", host_test_failures);
+        return 1;
+    }
+    return 0;
+}
@@ -1,5 +1,5 @@
 /**
- * @file      initSequence.cpp
+ * @file      legacy_init_tables.c
  * @author    Lewis He (lewishe@outlook.com)
  * @license   MIT
  * @copyright Copyright (c) 2023  Shenzhen Xin Yuan Electronic Technology Co., Ltd
@@ -8,9 +8,10 @@
  */
 
 #include "initSequence.h"
+#include "legacy_init_tables.h"
 
 
-const lcd_cmd_t sh8501_cmd[SH8501_INIT_SEQUENCE_LENGHT] = {
+const legacy_lcd_cmd_t legacy_sh8501_cmd[LEGACY_SH8501_INIT_SEQUENCE_LENGHT] = {
 
     // ===  CMD2 password  ===
     {0xfe00, {0x20}, 0x01},
@@ -501,7 +502,7 @@ const lcd_cmd_t sh8501_cmd[SH8501_INIT_SEQUENCE_LENGHT] = {
     {0x2900, {}, 0x80},
 };
 
-const lcd_cmd_t rm67162_cmd[RM67162_INIT_SEQUENCE_LENGHT] = {
+const legacy_lcd_cmd_t legacy_rm67162_cmd[LEGACY_RM67162_INIT_SEQUENCE_LENGHT] = {
     {0x1100, {0x00}, 0x80}, // Sleep Out
     // {0x44, {0x01, 0x66},        0x02}, //Set_Tear_Scanline
     // {0x35, {0x00},        0x00}, //TE ON
@@ -516,7 +517,7 @@ const lcd_cmd_t rm67162_cmd[RM67162_INIT_SEQUENCE_LENGHT] = {
     {0x3600, {0x60}, 0x01}, //
 };
 
-const lcd_cmd_t rm690b0_cmd[RM690B0_INIT_SEQUENCE_LENGHT] = {
+const legacy_lcd_cmd_t legacy_rm690b0_cmd[LEGACY_RM690B0_INIT_SEQUENCE_LENGHT] = {
     {0xFE00, {0x20}, 0x01},           //SET PAGE
     {0x2600, {0x0A}, 0x01},           //MIPI OFF
     {0x2400, {0x80}, 0x01},           //SPI write RAM
@@ -532,7 +533,7 @@ const lcd_cmd_t rm690b0_cmd[RM690B0_INIT_SEQUENCE_LENGHT] = {
     {0x5100, {0xFF}, 0x01},           //Write Display Brightness  MAX_VAL=0XFF
 };
 
-const lcd_cmd_t jd9613_cmd[JD9613_INIT_SEQUENCE_LENGHT] = {
+const legacy_lcd_cmd_t legacy_jd9613_cmd[LEGACY_JD9613_INIT_SEQUENCE_LENGHT] = {
     {0xfe, {0x01}, 0x02},
     {0xf7, {0x96, 0x13, 0xa9}, 0x04},
     {0x90, {0x01}, 0x02},
@@ -624,7 +625,7 @@ const lcd_cmd_t jd9613_cmd[JD9613_INIT_SEQUENCE_LENGHT] = {
 
 
 
-  const lcd_cmd_t st7701_2_1_inches[ST7701_2_1_INIT_SEQUENCE_LENGHT] = {
+const legacy_lcd_cmd_t legacy_st7701_2_1_inches[LEGACY_ST7701_2_1_INIT_SEQUENCE_LENGHT] = {
     {0xFF, {0x77, 0x01, 0x00, 0x00, 0x10}, 0x05},
     {0xC0, {0x3b, 0x00}, 0x02},
     {0xC1, {0x0b, 0x02}, 0x02},
@@ -670,7 +671,7 @@ const lcd_cmd_t jd9613_cmd[JD9613_INIT_SEQUENCE_LENGHT] = {
     {0, {0}, 0xff}
 };
 
-const lcd_cmd_t st7701_2_8_inches[ST7701_2_8_INIT_SEQUENCE_LENGHT] = {
+const legacy_lcd_cmd_t legacy_st7701_2_8_inches[LEGACY_ST7701_2_8_INIT_SEQUENCE_LENGHT] = {
     {0xFF, {0x77, 0x01, 0x00, 0x00, 0x13}, 0x05},
     {0xEF, {0x08}, 0x01},
     {0xFF, {0x77, 0x01, 0x00, 0x00, 0x10}, 0x05},
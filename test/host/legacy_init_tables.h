@@ -0,0 +1,44 @@
+/**
+ * @file      legacy_init_tables.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2023  Shenzhen Xin Yuan Electronic Technology Co., Ltd
+ * @date      2023-05-29
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The panel init tables as they were before init_stream, in the old
+ * lcd_cmd_t layout. test_init_stream decodes the packed streams back and
+ * compares them against these.
+ */
+typedef struct {
+    uint32_t addr;
+    uint8_t param[20];
+    uint32_t len;
+} legacy_lcd_cmd_t;
+
+#define LEGACY_SH8501_INIT_SEQUENCE_LENGHT          407
+#define LEGACY_RM67162_INIT_SEQUENCE_LENGHT         6
+#define LEGACY_RM690B0_INIT_SEQUENCE_LENGHT         13
+#define LEGACY_JD9613_INIT_SEQUENCE_LENGHT          88
+#define LEGACY_ST7701_2_1_INIT_SEQUENCE_LENGHT      40
+#define LEGACY_ST7701_2_8_INIT_SEQUENCE_LENGHT      42
+
+extern const legacy_lcd_cmd_t legacy_sh8501_cmd[LEGACY_SH8501_INIT_SEQUENCE_LENGHT];
+extern const legacy_lcd_cmd_t legacy_rm67162_cmd[LEGACY_RM67162_INIT_SEQUENCE_LENGHT];
+extern const legacy_lcd_cmd_t legacy_rm690b0_cmd[LEGACY_RM690B0_INIT_SEQUENCE_LENGHT];
+extern const legacy_lcd_cmd_t legacy_jd9613_cmd[LEGACY_JD9613_INIT_SEQUENCE_LENGHT];
+extern const legacy_lcd_cmd_t legacy_st7701_2_1_inches[LEGACY_ST7701_2_1_INIT_SEQUENCE_LENGHT];
+extern const legacy_lcd_cmd_t legacy_st7701_2_8_inches[LEGACY_ST7701_2_8_INIT_SEQUENCE_LENGHT];
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,151 @@
+/**
+ * @file      lvgl.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+/*
+ * The part of the LVGL 8.3 font API the generated fonts in main/fonts and
+ * the font modules use, so they build on host. Field names follow LVGL,
+ * the layout does not have to. Colours are RGB565 as in lv_conf.h.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LVGL_VERSION_MAJOR      8
+#define LVGL_VERSION_MINOR      3
+#define LVGL_VERSION_PATCH      11
+#define LV_VERSION_CHECK(x, y, z) (x == LVGL_VERSION_MAJOR && (y < LVGL_VERSION_MINOR || \
+                                   (y == LVGL_VERSION_MINOR && z <= LVGL_VERSION_PATCH)))
+
+#define LV_ATTRIBUTE_LARGE_CONST
+
+typedef int16_t lv_coord_t;
+typedef uint8_t lv_opa_t;
+
+#define LV_OPA_TRANSP           0
+#define LV_OPA_COVER            255
+
+typedef union {
+    struct {
+        uint16_t blue : 5;
+        uint16_t green : 6;
+        uint16_t red : 5;
+    } ch;
+    uint16_t full;
+} lv_color_t;
+
+typedef enum {
+    LV_FONT_SUBPX_NONE,
+    LV_FONT_SUBPX_HOR,
+    LV_FONT_SUBPX_VER,
+    LV_FONT_SUBPX_BOTH,
+} lv_font_subpx_t;
+
+struct _lv_font_t;
+
+typedef struct {
+    const struct _lv_font_t *resolved_font;
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint8_t bpp;
+} lv_font_glyph_dsc_t;
+
+typedef struct _lv_font_t {
+    bool (*get_glyph_dsc)(const struct _lv_font_t *, lv_font_glyph_dsc_t *, uint32_t letter, uint32_t letter_next);
+    const uint8_t *(*get_glyph_bitmap)(const struct _lv_font_t *, uint32_t);
+    lv_coord_t line_height;
+    lv_coord_t base_line;
+    uint8_t subpx : 2;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    const void *dsc;
+    const struct _lv_font_t *fallback;
+    void *user_data;
+} lv_font_t;
+
+typedef struct {
+    uint32_t bitmap_index : 20;
+    uint32_t adv_w : 12;
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+} lv_font_fmt_txt_glyph_dsc_t;
+
+typedef enum {
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_FULL,
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_TINY,
+} lv_font_fmt_txt_cmap_type_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    const uint16_t *unicode_list;
+    const void *glyph_id_ofs_list;
+    uint16_t list_length;
+    lv_font_fmt_txt_cmap_type_t type;
+} lv_font_fmt_txt_cmap_t;
+
+typedef struct {
+    const void *glyph_ids;
+    const int8_t *values;
+    uint32_t pair_cnt : 30;
+    uint32_t glyph_ids_size : 2;
+} lv_font_fmt_txt_kern_pair_t;
+
+typedef struct {
+    const int8_t *class_pair_values;
+    const uint8_t *left_class_mapping;
+    const uint8_t *right_class_mapping;
+    uint8_t left_class_cnt;
+    uint8_t right_class_cnt;
+} lv_font_fmt_txt_kern_classes_t;
+
+typedef struct {
+    uint32_t last_letter;
+    uint32_t last_glyph_id;
+} lv_font_fmt_txt_glyph_cache_t;
+
+typedef struct {
+    const uint8_t *glyph_bitmap;
+    const lv_font_fmt_txt_glyph_dsc_t *glyph_dsc;
+    const lv_font_fmt_txt_cmap_t *cmaps;
+    const void *kern_dsc;
+    uint16_t kern_scale;
+    uint16_t cmap_num : 9;
+    uint16_t bpp : 4;
+    uint16_t kern_classes : 1;
+    uint16_t bitmap_format : 2;
+    lv_font_fmt_txt_glyph_cache_t *cache;
+} lv_font_fmt_txt_dsc_t;
+
+// Glyph lookup without kerning, enough for box and bitmap
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                                   uint32_t letter_next);
+const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t letter);
+
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                           uint32_t letter_next);
+const uint8_t *lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter);
+
+void *lv_mem_realloc(void *data_p, size_t new_size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,102 @@
+/**
+ * @file      lvgl_stub.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdlib.h>
+#include "lvgl.h"
+
+// Same letter to glyph id mapping as lv_font_fmt_txt.c, including its one letter cache
+static uint32_t stub_glyph_id(const lv_font_t *font, uint32_t letter)
+{
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    if (fdsc->cache && fdsc->cache->last_letter == letter) {
+        return fdsc->cache->last_glyph_id;
+    }
+
+    uint32_t gid = 0;
+    for (uint16_t i = 0; i < fdsc->cmap_num && !gid; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if (rcp >= cmap->range_length) {
+            continue;
+        }
+        switch (cmap->type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            gid = cmap->glyph_id_start + rcp;
+            break;
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+            gid = cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[rcp];
+            break;
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+            for (uint16_t k = 0; k < cmap->list_length; k++) {
+                if (cmap->unicode_list[k] == rcp) {
+                    gid = cmap->glyph_id_start;
+                    gid += cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY ? k :
+                           ((const uint16_t *)cmap->glyph_id_ofs_list)[k];
+                    break;
+                }
+            }
+            break;
+        }
+    }
+
+    if (fdsc->cache) {
+        fdsc->cache->last_letter = letter;
+        fdsc->cache->last_glyph_id = gid;
+    }
+    return gid;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                                   uint32_t letter_next)
+{
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = stub_glyph_id(font, letter);
+    if (!gid) {
+        return false;
+    }
+    const lv_font_fmt_txt_glyph_dsc_t *gdsc = &fdsc->glyph_dsc[gid];
+    dsc_out->adv_w = (gdsc->adv_w + 8) >> 4;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+    dsc_out->bpp = (uint8_t)fdsc->bpp;
+    return true;
+}
+
+const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t letter)
+{
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = stub_glyph_id(font, letter);
+    if (!gid) {
+        return NULL;
+    }
+    return &fdsc->glyph_bitmap[fdsc->glyph_dsc[gid].bitmap_index];
+}
+
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                           uint32_t letter_next)
+{
+    dsc_out->resolved_font = NULL;
+    if (!font->get_glyph_dsc(font, dsc_out, letter, letter_next)) {
+        return false;
+    }
+    dsc_out->resolved_font = font;
+    return true;
+}
+
+const uint8_t *lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter)
+{
+    return font->get_glyph_bitmap(font, letter);
+}
+
+void *lv_mem_realloc(void *data_p, size_t new_size)
+{
+    return realloc(data_p, new_size);
+}
@@ -0,0 +1,110 @@
+/**
+ * @file      test_boot_stages.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <unistd.h>
+#include "host_test.h"
+#include "boot_stages.h"
+
+// Same graph as app_main, the stubs sleep a scaled down version of each stage
+enum {
+    STAGE_I2C,
+    STAGE_POWER,
+    STAGE_TOUCH,
+    STAGE_DISPLAY,
+    STAGE_LVGL,
+    STAGE_COUNT,
+};
+
+static int order[16];
+static int order_count;
+
+#define STUB(fn, id, ms) static void fn(void) { order[order_count++] = id; usleep((ms) * 1000); }
+STUB(stub_i2c, STAGE_I2C, 1)
+STUB(stub_power, STAGE_POWER, 3)
+STUB(stub_touch, STAGE_TOUCH, 5)
+STUB(stub_display, STAGE_DISPLAY, 40)
+STUB(stub_lvgl, STAGE_LVGL, 8)
+
+static void check_order(const boot_stage_t *stages, size_t count)
+{
+    CHECK(order_count == (int)count);
+    for (size_t i = 0; i < count; i++) {
+        CHECK(stages[i].end_us >= stages[i].start_us);
+        for (size_t d = 0; d < count; d++) {
+            if (stages[i].deps & BOOT_STAGE_DEP(d)) {
+                CHECK(stages[d].end_us <= stages[i].start_us);
+            }
+        }
+    }
+}
+
+// T-Display-S3-Long: touch waits for the panel reset
+static void test_long_graph(void)
+{
+    boot_stage_t stages[] = {
+        {"i2c",     stub_i2c,     0},
+        {"power",   stub_power,   BOOT_STAGE_DEP(STAGE_I2C)},
+        {"touch",   stub_touch,   BOOT_STAGE_DEP(STAGE_POWER) | BOOT_STAGE_DEP(STAGE_DISPLAY)},
+        {"display", stub_display, BOOT_STAGE_DEP(STAGE_POWER)},
+        {"lvgl",    stub_lvgl,    0},
+    };
+    order_count = 0;
+    CHECK(boot_stages_run(stages, STAGE_COUNT, true));
+    check_order(stages, STAGE_COUNT);
+
+    int64_t length_us = 0;
+    uint32_t path = boot_stages_critical_path(stages, STAGE_COUNT, &length_us);
+    CHECK(path == (BOOT_STAGE_DEP(STAGE_I2C) | BOOT_STAGE_DEP(STAGE_POWER) |
+                   BOOT_STAGE_DEP(STAGE_DISPLAY) | BOOT_STAGE_DEP(STAGE_TOUCH)));
+    CHECK(length_us >= 49000);
+    boot_stages_report(stages, STAGE_COUNT);
+}
+
+// T-RGB: the touch probe picks the panel table, so display follows touch
+static void test_rgb_graph(void)
+{
+    boot_stage_t stages[] = {
+        {"i2c",     stub_i2c,     0},
+        {"power",   stub_power,   BOOT_STAGE_DEP(STAGE_I2C)},
+        {"touch",   stub_touch,   BOOT_STAGE_DEP(STAGE_POWER)},
+        {"display", stub_display, BOOT_STAGE_DEP(STAGE_POWER) | BOOT_STAGE_DEP(STAGE_TOUCH)},
+        {"lvgl",    stub_lvgl,    0},
+    };
+    order_count = 0;
+    CHECK(boot_stages_run(stages, STAGE_COUNT, true));
+    check_order(stages, STAGE_COUNT);
+
+    int64_t length_us = 0;
+    uint32_t path = boot_stages_critical_path(stages, STAGE_COUNT, &length_us);
+    CHECK(path == (BOOT_STAGE_DEP(STAGE_I2C) | BOOT_STAGE_DEP(STAGE_POWER) |
+                   BOOT_STAGE_DEP(STAGE_TOUCH) | BOOT_STAGE_DEP(STAGE_DISPLAY)));
+    // lvgl depends on nothing, it is never on the path
+    CHECK(!(path & BOOT_STAGE_DEP(STAGE_LVGL)));
+    boot_stages_report(stages, STAGE_COUNT);
+}
+
+static void test_cycle(void)
+{
+    boot_stage_t stages[] = {
+        {"a", stub_i2c, BOOT_STAGE_DEP(1)},
+        {"b", stub_i2c, BOOT_STAGE_DEP(0)},
+        {"c", stub_i2c, 0},
+    };
+    order_count = 0;
+    CHECK(!boot_stages_run(stages, 3, false));
+    CHECK(order_count == 1);
+    CHECK(stages[2].end_us >= 0);
+}
+
+int main(void)
+{
+    test_long_graph();
+    test_rgb_graph();
+    test_cycle();
+    return host_test_result();
+}
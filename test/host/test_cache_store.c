@@ -0,0 +1,188 @@
+/**
+ * @file      test_cache_store.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "host_test.h"
+#include "cache_store.h"
+
+#define CAPACITY    1000
+#define ENTRIES     8
+#define IMAGE_SIZE  300
+
+/*
+ * Stub decoder: fills the buffer from the image id, counts how often it
+ * ran, and fails on request the way a truncated file does.
+ */
+typedef struct {
+    uint32_t id;
+    bool fail;
+} stub_image_t;
+
+static uint32_t decodes;
+
+static bool stub_decode(void *buf, size_t size, void *user_data)
+{
+    const stub_image_t *img = (const stub_image_t *)user_data;
+    decodes++;
+    memset(buf, (int)img->id, size);
+    return !img->fail;
+}
+
+static cache_key_t key_of(uint32_t id)
+{
+    cache_key_t key = {{0}};
+    key.w[0] = id;
+    return key;
+}
+
+static void *get(cache_store_t *s, uint32_t id, size_t size)
+{
+    stub_image_t img = {id, false};
+    cache_key_t key = key_of(id);
+    return cache_store_get(s, &key, size, stub_decode, &img);
+}
+
+static bool cached(cache_store_t *s, uint32_t id)
+{
+    cache_key_t key = key_of(id);
+    return cache_store_lookup(s, &key, NULL) != NULL;
+}
+
+// Hits skip the decoder, misses decode once, the counters follow
+static void test_hits(void)
+{
+    cache_store_t s;
+    CHECK(cache_store_init(&s, "test", CAPACITY, ENTRIES, CACHE_STORE_CAPS_PSRAM));
+    decodes = 0;
+    uint8_t *a = get(&s, 1, IMAGE_SIZE);
+    CHECK(a && a[0] == 1 && a[IMAGE_SIZE - 1] == 1);
+    CHECK(get(&s, 1, IMAGE_SIZE) == a);
+    CHECK(get(&s, 1, IMAGE_SIZE) == a);
+    CHECK(decodes == 1);
+    CHECK(s.stats.hits == 2 && s.stats.misses == 1);
+    CHECK(s.stats.entries == 1 && s.stats.bytes_used == IMAGE_SIZE);
+
+    // A failed decode leaves nothing behind
+    stub_image_t bad = {2, true};
+    cache_key_t key = key_of(2);
+    CHECK(cache_store_get(&s, &key, IMAGE_SIZE, stub_decode, &bad) == NULL);
+    CHECK(s.stats.entries == 1 && s.stats.bytes_used == IMAGE_SIZE);
+
+    // Larger than the whole cache
+    CHECK(get(&s, 3, CAPACITY + 1) == NULL);
+    CHECK(s.stats.rejects == 1);
+    cache_store_deinit(&s);
+}
+
+// Byte bound with second chance: a referenced entry outlives an idle one
+static void test_clock(void)
+{
+    cache_store_t s;
+    CHECK(cache_store_init(&s, "test", CAPACITY, ENTRIES, CACHE_STORE_CAPS_PSRAM));
+    CHECK(get(&s, 1, IMAGE_SIZE) && get(&s, 2, IMAGE_SIZE) && get(&s, 3, IMAGE_SIZE));
+
+    // Every entry was just used, one full sweep clears the bits and the oldest goes
+    CHECK(get(&s, 4, IMAGE_SIZE));
+    CHECK(s.stats.evictions == 1);
+    CHECK(s.stats.bytes_used == 3 * IMAGE_SIZE);
+
+    // 3 is used again, 2 is not: 2 is the next victim
+    CHECK(cached(&s, 3));
+    CHECK(get(&s, 5, IMAGE_SIZE));
+    CHECK(s.stats.evictions == 2);
+    CHECK(!cached(&s, 1) && !cached(&s, 2));
+    CHECK(cached(&s, 3) && cached(&s, 4) && cached(&s, 5));
+
+    // Many small entries: the slot count binds before the bytes do
+    for (uint32_t id = 10; id < 30; id++) {
+        CHECK(get(&s, id, 10));
+        CHECK(s.stats.entries <= ENTRIES && s.stats.bytes_used <= CAPACITY);
+    }
+    CHECK(s.stats.bytes_peak <= CAPACITY);
+    cache_store_deinit(&s);
+}
+
+// Pinned entries are never evicted, when only pins are left inserts are refused
+static void test_pins(void)
+{
+    cache_store_t s;
+    CHECK(cache_store_init(&s, "test", CAPACITY, ENTRIES, CACHE_STORE_CAPS_PSRAM));
+    uint8_t *a = get(&s, 1, IMAGE_SIZE);
+    uint8_t *b = get(&s, 2, IMAGE_SIZE);
+    cache_key_t ka = key_of(1), kb = key_of(2);
+    CHECK(cache_store_pin(&s, &ka) && cache_store_pin(&s, &kb));
+    CHECK(s.stats.pinned == 2);
+
+    for (uint32_t id = 10; id < 40; id++) {
+        CHECK(get(&s, id, IMAGE_SIZE));
+    }
+    CHECK(cached(&s, 1) && cached(&s, 2));
+    CHECK(a[0] == 1 && b[0] == 2);
+
+    // Pinned data is not replaced, clear keeps it
+    CHECK(cache_store_insert(&s, &ka, IMAGE_SIZE * 2) == NULL);
+    cache_store_clear(&s);
+    CHECK(cached(&s, 1) && cached(&s, 2));
+    CHECK(s.stats.entries == 2);
+
+    // Only pins left and no room for another entry
+    CHECK(get(&s, 50, CAPACITY - IMAGE_SIZE) == NULL);
+    CHECK(s.stats.rejects == 1);
+
+    // An open image and a user pin on the same entry: dropping one keeps the other
+    CHECK(cache_store_pin(&s, &ka));
+    CHECK(cache_store_unpin(&s, &ka));
+    CHECK(s.stats.pinned == 2);
+    CHECK(cache_store_unpin_data(&s, a));
+    CHECK(s.stats.pinned == 1);
+    CHECK(!cache_store_unpin(&s, &ka));
+    CHECK(!cache_store_unpin_data(&s, &decodes));
+    cache_store_deinit(&s);
+}
+
+/*
+ * The store's unpin_all clears every pin, decoder pins included. That is
+ * why img_cache keeps its own list: img_cache_unpin_all() must only drop
+ * the pins img_cache_pin() took and leave open images pinned.
+ */
+static void test_unpin_all(void)
+{
+    cache_store_t s;
+    CHECK(cache_store_init(&s, "test", CAPACITY, ENTRIES, CACHE_STORE_CAPS_PSRAM));
+    CHECK(get(&s, 1, IMAGE_SIZE) && get(&s, 2, IMAGE_SIZE));
+    cache_key_t open_image = key_of(1), user_pin = key_of(2);
+    CHECK(cache_store_pin(&s, &open_image));
+    CHECK(cache_store_pin(&s, &user_pin));
+
+    // img_cache_unpin_all(): only the recorded user pins
+    CHECK(cache_store_unpin(&s, &user_pin));
+    for (uint32_t id = 10; id < 20; id++) {
+        get(&s, id, IMAGE_SIZE);
+    }
+    CHECK(cached(&s, 1));
+    CHECK(!cached(&s, 2));
+
+    // The store level call drops the open image's pin too
+    cache_store_unpin_all(&s);
+    CHECK(s.stats.pinned == 0);
+    for (uint32_t id = 20; id < 30; id++) {
+        get(&s, id, IMAGE_SIZE);
+    }
+    CHECK(!cached(&s, 1));
+    cache_store_dump(&s);
+    cache_store_deinit(&s);
+}
+
+int main(void)
+{
+    test_hits();
+    test_clock();
+    test_pins();
+    test_unpin_all();
+    return host_test_result();
+}
@@ -0,0 +1,128 @@
+/**
+ * @file      test_display_pm.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include "host_test.h"
+#include "display_pm.h"
+
+#define MS(ms)  ((int64_t)(ms) * 1000)
+
+// Fake panel, the state the ops left it in
+static int level = -1;
+static bool idle_on, sleep_on;
+static uint32_t brightness_writes;
+
+static void fake_brightness(void *user, uint8_t l)
+{
+    level = l;
+    brightness_writes++;
+}
+
+static void fake_idle(void *user, bool on)
+{
+    idle_on = on;
+}
+
+static void fake_sleep(void *user, bool on)
+{
+    sleep_on = on;
+}
+
+static const display_pm_ops_t ops = {fake_brightness, fake_idle, fake_sleep, NULL};
+static const display_pm_config_t config = {
+    .dim_ms = 10000, .idle_ms = 20000, .sleep_ms = 30000, .fade_ms = 500, .bright = 200, .dim = 40,
+};
+
+// ACTIVE -> DIMMED (fade) -> IDLE -> SLEEP against the fake clock, and back on input
+static void test_stages(void)
+{
+    display_pm_t pm;
+    int64_t t = 0;
+    display_pm_init(&pm, &ops, &config, t);
+    CHECK(level == 200 && pm.state == DISPLAY_PM_ACTIVE);
+    CHECK(display_pm_tick(&pm, t) == 10000);
+
+    t = MS(10000);
+    CHECK(display_pm_tick(&pm, t) == DISPLAY_PM_FADE_STEP_MS);
+    CHECK(pm.state == DISPLAY_PM_DIMMED && level == 200);
+    t += MS(250);
+    CHECK(display_pm_tick(&pm, t) == DISPLAY_PM_FADE_STEP_MS);
+    CHECK(level == 120);
+    // Fade done, the next call is due at the idle timeout
+    t += MS(300);
+    CHECK(display_pm_tick(&pm, t) == 20000 - 10550);
+    CHECK(level == 40);
+
+    t = MS(20000);
+    display_pm_tick(&pm, t);
+    CHECK(pm.state == DISPLAY_PM_IDLE && idle_on && !sleep_on);
+
+    t = MS(30000);
+    CHECK(display_pm_tick(&pm, t) == UINT32_MAX);
+    CHECK(pm.state == DISPLAY_PM_SLEEP && sleep_on && level == 0);
+
+    // The waking touch is swallowed, the next one is not
+    CHECK(display_pm_input(&pm, t));
+    CHECK(pm.state == DISPLAY_PM_ACTIVE && !sleep_on && !idle_on && level == 200);
+    CHECK(!display_pm_input(&pm, t + 1));
+
+    // A late tick goes straight through every stage
+    t += MS(100000);
+    display_pm_tick(&pm, t);
+    CHECK(pm.state == DISPLAY_PM_SLEEP && idle_on && sleep_on && level == 0);
+
+    // Input while only dimmed reaches the UI
+    display_pm_input(&pm, t);
+    t += MS(10100);
+    display_pm_tick(&pm, t);
+    CHECK(pm.state == DISPLAY_PM_DIMMED);
+    CHECK(!display_pm_input(&pm, t));
+    CHECK(level == 200);
+}
+
+// A brightness change waits while the display is dimmed and is restored on input
+static void test_set_bright(void)
+{
+    display_pm_t pm;
+    display_pm_init(&pm, &ops, &config, 0);
+    display_pm_set_bright(&pm, 150);
+    CHECK(level == 150);
+
+    display_pm_tick(&pm, MS(10000));
+    display_pm_tick(&pm, MS(10600));
+    CHECK(pm.state == DISPLAY_PM_DIMMED && level == 40);
+    display_pm_set_bright(&pm, 255);
+    CHECK(level == 40);
+    display_pm_input(&pm, MS(11000));
+    CHECK(level == 255);
+}
+
+// A stage with timeout 0 is skipped, a tick with nothing due writes nothing
+static void test_skipped_stage(void)
+{
+    display_pm_config_t cfg = config;
+    cfg.idle_ms = 0;
+    display_pm_t pm;
+    display_pm_init(&pm, &ops, &cfg, 0);
+    idle_on = false;
+    display_pm_tick(&pm, MS(31000));
+    CHECK(!idle_on && sleep_on && pm.state == DISPLAY_PM_SLEEP);
+    display_pm_input(&pm, MS(31000));
+
+    uint32_t writes = brightness_writes;
+    display_pm_tick(&pm, MS(32000));
+    CHECK(brightness_writes == writes);
+}
+
+int main(void)
+{
+    test_stages();
+    test_set_bright();
+    test_skipped_stage();
+    CHECK(display_pm_state_name(DISPLAY_PM_SLEEP) != NULL);
+    return host_test_result();
+}
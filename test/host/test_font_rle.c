@@ -0,0 +1,179 @@
+/**
+ * @file      test_font_rle.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "host_test.h"
+#include "font_rle.h"
+#include "font_rle_reference.h"
+
+/*
+ * Every glyph of every run-length encoded font in main/fonts is decoded and
+ * compared with the CRC32 of its original lv_font_conv bitmap, then the
+ * flash size of both forms is reported.
+ *
+ *   test_font_rle                  check and flash report
+ *   test_font_rle --bench [frames] per frame decode cost as well
+ */
+#define FONT_COUNT      (sizeof(font_rle_reference) / sizeof(font_rle_reference[0]))
+#define DEFAULT_FRAMES  10000
+
+static uint32_t crc32(const uint8_t *p, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+// Bytes one encoded glyph takes, walked the way font_rle_decode() reads it
+static uint32_t rle_length(const uint8_t *in, uint32_t pixels)
+{
+    const uint8_t *p = in;
+    uint32_t pos = 0;
+    while (pos < pixels) {
+        uint8_t b;
+        do {
+            b = *p++;
+            pos += b;
+        } while (b == 255);
+    }
+    return p - in;
+}
+
+static const lv_font_fmt_txt_dsc_t *fmt(const lv_font_t *font)
+{
+    return (const lv_font_fmt_txt_dsc_t *)font->dsc;
+}
+
+// Decoder straight from the glyph table, and the encoded size of the font
+static uint32_t check_decode(size_t f)
+{
+    const lv_font_fmt_txt_dsc_t *fdsc = fmt(font_rle_reference[f].font);
+    static uint8_t out[8192];
+    uint32_t encoded = 0;
+    for (uint16_t gid = 1; gid <= font_rle_reference[f].glyphs; gid++) {
+        const lv_font_fmt_txt_glyph_dsc_t *g = &fdsc->glyph_dsc[gid];
+        uint32_t pixels = (uint32_t)g->box_w * g->box_h;
+        if (!pixels) {
+            continue;
+        }
+        CHECK((pixels + 7) / 8 <= sizeof(out));
+        const uint8_t *in = &fdsc->glyph_bitmap[g->bitmap_index];
+        font_rle_decode(in, out, pixels);
+        if (crc32(out, (pixels + 7) / 8) != font_rle_reference[f].crc[gid - 1]) {
+            fprintf(stderr, "%s: glyph %u differs from the original bitmap\n", font_rle_reference[f].name, gid);
+            host_test_failures++;
+        }
+        encoded += rle_length(in, pixels);
+    }
+    return encoded;
+}
+
+// Every letter through get_glyph_bitmap, the path LVGL takes, served from the decoded glyph cache
+static void check_letters(size_t f)
+{
+    const lv_font_t *font = font_rle_reference[f].font;
+    uint32_t letters = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        for (uint32_t letter = 0x20; letter < 0x10000; letter++) {
+            lv_font_glyph_dsc_t g;
+            if (!lv_font_get_glyph_dsc(font, &g, letter, 0) || !g.box_w || !g.box_h) {
+                continue;
+            }
+            uint32_t gid = fmt(font)->cache->last_glyph_id;
+            const uint8_t *bitmap = font_rle_get_glyph_bitmap(font, letter);
+            CHECK(bitmap != NULL);
+            CHECK(!bitmap || crc32(bitmap, ((uint32_t)g.box_w * g.box_h + 7) / 8) == font_rle_reference[f].crc[gid - 1]);
+            letters += pass == 0;
+        }
+    }
+    CHECK(letters > 0);
+    // A letter the font does not have
+    CHECK(font_rle_get_glyph_bitmap(font, 0x10FFFF) == NULL);
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/*
+ * The dashboard frame redraws 4 industry_120 and 8 industry_90 digits.
+ * Cold decodes every glyph as if the cache always missed, warm is the
+ * cache hit LVGL sees once the digits are resident.
+ */
+static void bench(int frames)
+{
+    static const struct {
+        const lv_font_t *font;
+        const char *text;
+    } frame[] = {
+        {&industry_120, "2356"},
+        {&industry_90, "25301230"},
+    };
+    static uint8_t out[8192];
+    uint64_t cold = 0, warm = 0;
+    uint32_t glyphs = 0;
+    volatile uint8_t sink = 0;
+
+    for (int f = 0; f < frames; f++) {
+        for (size_t l = 0; l < sizeof(frame) / sizeof(frame[0]); l++) {
+            const lv_font_fmt_txt_dsc_t *fdsc = fmt(frame[l].font);
+            for (const char *p = frame[l].text; *p; p++) {
+                lv_font_glyph_dsc_t g;
+                if (!lv_font_get_glyph_dsc(frame[l].font, &g, (uint8_t)*p, 0)) {
+                    continue;
+                }
+                const lv_font_fmt_txt_glyph_dsc_t *gd = &fdsc->glyph_dsc[fdsc->cache->last_glyph_id];
+                uint64_t t0 = now_ns();
+                font_rle_decode(&fdsc->glyph_bitmap[gd->bitmap_index], out, (uint32_t)gd->box_w * gd->box_h);
+                uint64_t t1 = now_ns();
+                const uint8_t *bitmap = font_rle_get_glyph_bitmap(frame[l].font, (uint8_t)*p);
+                uint64_t t2 = now_ns();
+                sink ^= out[0] ^ (bitmap ? bitmap[0] : 0);
+                cold += t1 - t0;
+                warm += t2 - t1;
+                glyphs += f == 0;
+            }
+        }
+    }
+    printf("dashboard frame, %u glyphs, %d frames\n", (unsigned)glyphs, frames);
+    printf("  every glyph decoded  %8.2f us/frame\n", cold / 1000.0 / frames);
+    printf("  decoded glyph cache  %8.2f us/frame\n", warm / 1000.0 / frames);
+    font_rle_dump();
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t raw_total = 0, rle_total = 0;
+    printf("%-20s %6s %8s %6s\n", "font", "glyphs", "raw", "rle");
+    for (size_t f = 0; f < FONT_COUNT; f++) {
+        uint32_t encoded = check_decode(f);
+        check_letters(f);
+        printf("%-20s %6u %8u %6u\n", font_rle_reference[f].name, font_rle_reference[f].glyphs,
+               (unsigned)font_rle_reference[f].raw_bytes, (unsigned)encoded);
+        raw_total += font_rle_reference[f].raw_bytes;
+        rle_total += encoded;
+    }
+    printf("%-20s %6s %8u %6u  (%u%%, %u bytes of flash saved)\n", "total", "", (unsigned)raw_total,
+           (unsigned)rle_total, (unsigned)(rle_total * 100 / raw_total), (unsigned)(raw_total - rle_total));
+    CHECK(rle_total < raw_total);
+
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        bench(argc > 2 ? atoi(argv[2]) : DEFAULT_FRAMES);
+    }
+    return host_test_result();
+}
@@ -0,0 +1,209 @@
+/**
+ * @file      test_gesture.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <math.h>
+#include <string.h>
+#include "host_test.h"
+#include "gesture.h"
+
+/*
+ * Each trace feeds samples at 15 ms, the touch polling period, and the
+ * events it produced are written as "name(value)@ms;" for comparison.
+ * Timer events carry the time of the poll that fired them.
+ */
+static gesture_t g;
+static char out[2048];
+static int pos;
+
+static void record(int count, const gesture_event_t *e)
+{
+    for (int i = 0; i < count; i++) {
+        pos += snprintf(out + pos, sizeof(out) - pos, "%s", gesture_name(e[i].type));
+        if (e[i].type == GESTURE_PINCH) {
+            pos += snprintf(out + pos, sizeof(out) - pos, "(%.2f)", e[i].scale);
+        } else if (e[i].type == GESTURE_ROTATE) {
+            pos += snprintf(out + pos, sizeof(out) - pos, "(%.0f)", e[i].angle_deg);
+        }
+        pos += snprintf(out + pos, sizeof(out) - pos, "@%lld;", (long long)(e[i].time_us / 1000));
+    }
+}
+
+static void one(long ms, int x, int y)
+{
+    touch_sample_t s = {.count = 1, .time_us = ms * 1000};
+    s.points[0].x = x;
+    s.points[0].y = y;
+    gesture_event_t e[GESTURE_MAX_EVENTS];
+    record(gesture_feed(&g, &s, e), e);
+}
+
+static void two(long ms, int x0, int y0, int x1, int y1)
+{
+    touch_sample_t s = {.count = 2, .time_us = ms * 1000};
+    s.points[0].x = x0;
+    s.points[0].y = y0;
+    s.points[1].x = x1;
+    s.points[1].y = y1;
+    gesture_event_t e[GESTURE_MAX_EVENTS];
+    record(gesture_feed(&g, &s, e), e);
+}
+
+static void up(long ms)
+{
+    touch_sample_t s = {.count = 0, .time_us = ms * 1000};
+    gesture_event_t e[GESTURE_MAX_EVENTS];
+    record(gesture_feed(&g, &s, e), e);
+}
+
+static void poll_at(long ms)
+{
+    gesture_event_t e[GESTURE_MAX_EVENTS];
+    record(gesture_poll(&g, ms * 1000, e), e);
+}
+
+static void trace_tap(void)
+{
+    one(0, 100, 100);
+    one(15, 102, 101);
+    up(60);
+    poll_at(200);
+    poll_at(320);
+}
+
+static void trace_double_tap(void)
+{
+    one(0, 100, 100);
+    up(60);
+    one(200, 105, 98);
+    up(260);
+    poll_at(1000);
+}
+
+// Second tap after the double tap gap: two single taps
+static void trace_slow_double_tap(void)
+{
+    one(0, 100, 100);
+    up(60);
+    poll_at(400);
+    one(500, 100, 100);
+    up(560);
+    poll_at(900);
+}
+
+static void trace_long_press(void)
+{
+    one(0, 50, 50);
+    for (int t = 15; t <= 900; t += 15) {
+        one(t, 52, 51);
+    }
+    up(915);
+}
+
+static void trace_swipe_left(void)
+{
+    for (int t = 0; t <= 150; t += 15) {
+        one(t, 200 - t, 100 + t / 10);
+    }
+    up(165);
+}
+
+static void trace_swipe_up(void)
+{
+    for (int t = 0; t <= 150; t += 15) {
+        one(t, 100, 300 - t * 2);
+    }
+    up(165);
+}
+
+static void trace_pinch(void)
+{
+    for (int t = 0; t <= 60; t += 15) {
+        two(t, 100 - t, 100, 200 + t, 100);
+    }
+    up(75);
+}
+
+static void trace_rotate(void)
+{
+    for (int k = 0; k <= 4; k++) {
+        float a = k * 0.1f;
+        two(k * 15, (int)(150 - 50 * cosf(a)), (int)(150 - 50 * sinf(a)),
+            (int)(150 + 50 * cosf(a)), (int)(150 + 50 * sinf(a)));
+    }
+    up(90);
+}
+
+// Controllers do not keep point order, swapped fingers are still one rotation
+static void trace_rotate_swapped(void)
+{
+    for (int k = 0; k <= 4; k++) {
+        float a = k * 0.1f;
+        int ax = 150 - 50 * cosf(a), ay = 150 - 50 * sinf(a);
+        int bx = 150 + 50 * cosf(a), by = 150 + 50 * sinf(a);
+        if (k & 1) {
+            two(k * 15, bx, by, ax, ay);
+        } else {
+            two(k * 15, ax, ay, bx, by);
+        }
+    }
+    up(90);
+}
+
+// The second press turns out to be a swipe, the pending tap goes out with it
+static void trace_tap_then_swipe(void)
+{
+    one(0, 100, 100);
+    up(50);
+    for (int t = 100; t <= 250; t += 15) {
+        one(t, 100 + (t - 100), 100);
+    }
+    up(260);
+}
+
+static void run(const char *name, void (*trace)(void), const char *want)
+{
+    gesture_init(&g, NULL);
+    pos = 0;
+    out[0] = '\0';
+    trace();
+    if (strcmp(out, want) != 0) {
+        fprintf(stderr, "%s: got \"%s\", want \"%s\"\n", name, out, want);
+        host_test_failures++;
+    }
+}
+
+// Same trace twice gives the same events, only sample times drive the timers
+static void test_deterministic(void)
+{
+    char first[sizeof(out)];
+    run("long press", trace_long_press, "long press@600;");
+    memcpy(first, out, sizeof(first));
+    run("long press", trace_long_press, "long press@600;");
+    CHECK(strcmp(first, out) == 0);
+
+    gesture_init(&g, NULL);
+    CHECK(gesture_next_deadline(&g) == -1);
+    pos = 0;
+    one(0, 10, 10);
+    CHECK(gesture_next_deadline(&g) == 600000);
+}
+
+int main(void)
+{
+    run("tap", trace_tap, "tap@320;");
+    run("double tap", trace_double_tap, "double tap@260;");
+    run("slow double tap", trace_slow_double_tap, "tap@400;tap@900;");
+    run("swipe left", trace_swipe_left, "swipe left@165;");
+    run("swipe up", trace_swipe_up, "swipe up@165;");
+    run("pinch", trace_pinch, "pinch(1.30)@15;pinch(1.60)@30;pinch(1.90)@45;pinch(2.20)@60;");
+    run("rotate", trace_rotate, "rotate(11)@30;rotate(17)@45;rotate(23)@60;");
+    run("rotate swapped", trace_rotate_swapped, "rotate(11)@30;rotate(17)@45;rotate(23)@60;");
+    run("tap then swipe", trace_tap_then_swipe, "tap@260;swipe right@260;");
+    test_deterministic();
+    return host_test_result();
+}
@@ -0,0 +1,146 @@
+/**
+ * @file      test_i2c_sched.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "host_test.h"
+#include "i2c_sched.h"
+
+#define XFER_US     500
+#define FAIL_LEN    99          // a transfer with this tx length fails on the bus
+#define BUS_ERROR   (-5)
+
+/*
+ * Simulated bus: every transfer takes 500 us of the fake clock and appends
+ * the device id to the log. A touch read can be injected from inside a
+ * transfer, the way the touch interrupt lands while telemetry holds the bus.
+ */
+static i2c_sched_t sched;
+static int64_t clock_us;
+static char bus_log[64];
+static int bus_len;
+static int inject_at = -1;
+static i2c_sched_job_t touch_job;
+static uint32_t dones;
+
+static int sim_xfer(void *user, uint8_t device, const i2c_sched_xfer_t *xfer)
+{
+    clock_us += XFER_US;
+    bus_log[bus_len++] = '0' + device;
+    bus_log[bus_len] = '\0';
+    if (bus_len == inject_at) {
+        i2c_sched_submit(&sched, &touch_job);
+    }
+    return xfer->tx_len == FAIL_LEN ? BUS_ERROR : 0;
+}
+
+static int64_t sim_now(void *user)
+{
+    return clock_us;
+}
+
+static void job_done(i2c_sched_job_t *job)
+{
+    dones++;
+}
+
+static void drain(void)
+{
+    while (i2c_sched_step(&sched)) {
+    }
+}
+
+static void expect_log(const char *want)
+{
+    if (strcmp(bus_log, want) != 0) {
+        fprintf(stderr, "bus order \"%s\", want \"%s\"\n", bus_log, want);
+        host_test_failures++;
+    }
+    bus_len = 0;
+    bus_log[0] = '\0';
+}
+
+int main(void)
+{
+    const i2c_sched_bus_t bus = {sim_xfer, sim_now, NULL};
+    CHECK(i2c_sched_init(&sched, &bus) == 0);
+    int touch = i2c_sched_add_device(&sched, "touch", 0x15);
+    int pmu = i2c_sched_add_device(&sched, "pmu", 0x34);
+    CHECK(touch == 0 && pmu == 1);
+
+    static uint8_t touch_rx[6];
+    const i2c_sched_xfer_t touch_xfer = {.rx = touch_rx, .rx_len = sizeof(touch_rx)};
+    touch_job = (i2c_sched_job_t) {
+        .device = touch, .priority = I2C_SCHED_PRIO_TOUCH, .xfers = &touch_xfer, .count = 1, .done = job_done,
+    };
+
+    // PMU telemetry: status, ADC block, charger state
+    const i2c_sched_xfer_t pmu_xfers[3] = {{.tx_len = 1, .rx_len = 2}, {.tx_len = 1, .rx_len = 8}, {.tx_len = 1, .rx_len = 1}};
+    i2c_sched_job_t pmu_job = {
+        .device = pmu, .priority = I2C_SCHED_PRIO_TELEMETRY, .xfers = pmu_xfers, .count = 3, .done = job_done,
+    };
+
+    // A touch read arriving during the first PMU transfer goes before the second
+    inject_at = 1;
+    i2c_sched_submit(&sched, &pmu_job);
+    drain();
+    expect_log("1011");
+    CHECK(dones == 2);
+    CHECK(pmu_job.result == 0 && touch_job.result == 0);
+    i2c_sched_stats_t st;
+    i2c_sched_get_stats(&sched, pmu, &st);
+    CHECK(st.jobs == 1 && st.xfers == 3 && st.bytes == 14 && st.preempted == 1);
+    CHECK(st.busy_us == 3 * XFER_US);
+    i2c_sched_get_stats(&sched, touch, &st);
+    CHECK(st.jobs == 1 && st.wait_max_us <= XFER_US);
+
+    // An atomic batch keeps the bus until it is done
+    pmu_job.atomic = true;
+    inject_at = 1;
+    i2c_sched_submit(&sched, &pmu_job);
+    drain();
+    expect_log("1110");
+
+    // Deadline passed before the job started: dropped without touching the bus
+    pmu_job.atomic = false;
+    inject_at = -1;
+    pmu_job.deadline_us = clock_us + 1000;
+    i2c_sched_submit(&sched, &pmu_job);
+    clock_us += 2000;
+    CHECK(i2c_sched_step(&sched));
+    CHECK(pmu_job.result == I2C_SCHED_MISSED);
+    CHECK(!i2c_sched_step(&sched));
+    expect_log("");
+    i2c_sched_get_stats(&sched, pmu, &st);
+    CHECK(st.missed == 1);
+
+    // Priority first, then the earlier deadline, then submission order
+    i2c_sched_job_t late = {.device = pmu, .priority = I2C_SCHED_PRIO_TELEMETRY, .xfers = pmu_xfers, .count = 1,
+                            .deadline_us = clock_us + 9000};
+    i2c_sched_job_t soon = late;
+    soon.deadline_us = clock_us + 5000;
+    i2c_sched_job_t io = {.device = touch, .priority = I2C_SCHED_PRIO_IO, .xfers = pmu_xfers, .count = 1};
+    i2c_sched_submit(&sched, &late);
+    i2c_sched_submit(&sched, &soon);
+    i2c_sched_submit(&sched, &io);
+    CHECK(sched.queue == &io && io.link == &soon && soon.link == &late);
+    drain();
+    expect_log("011");
+
+    // A failed transfer ends its batch
+    const i2c_sched_xfer_t failing[2] = {{.tx_len = FAIL_LEN}, {.tx_len = 1}};
+    i2c_sched_job_t err_job = {.device = pmu, .xfers = failing, .count = 2};
+    i2c_sched_submit(&sched, &err_job);
+    drain();
+    CHECK(err_job.result == BUS_ERROR);
+    expect_log("1");
+    i2c_sched_get_stats(&sched, pmu, &st);
+    CHECK(st.errors == 1);
+
+    i2c_sched_print(&sched, stdout);
+    return host_test_result();
+}
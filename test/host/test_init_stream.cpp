@@ -0,0 +1,181 @@
+/**
+ * @file      test_init_stream.cpp
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <cstring>
+#include "host_test.h"
+#include "initSequence.h"
+#include "legacy_init_tables.h"
+
+// How each driver used to read the length byte of its table
+struct legacy_layout {
+    unsigned cmd_shift;
+    unsigned len_mask;
+    bool len_has_cmd;
+    unsigned delay_flag[2];
+    unsigned delay_ms[2];
+};
+
+static const legacy_layout qspi_layout = {8, 0x1F, false, {0x80, 0x20}, {120, 10}};
+static const legacy_layout jd9613_layout = {0, 0x1F, true, {0, 0}, {0, 0}};
+static const legacy_layout st7701_layout = {0, 0x1F, false, {0x80, 0}, {100, 0}};
+
+// Decode the stream and walk the legacy table alongside it
+static void check_decode(const char *name, const init_stream_t *stream, const legacy_lcd_cmd_t *tbl, size_t count,
+                         const legacy_layout &l)
+{
+    const uint8_t *p = stream->data;
+    init_stream_item_t item;
+    size_t cmds = 0;
+    int before = host_test_failures;
+
+    for (size_t i = 0; i < count && tbl[i].len != 0xFF; i++) {
+        unsigned len = tbl[i].len & l.len_mask;
+        if (l.len_has_cmd && len) {
+            len--;
+        }
+        p = init_stream_decode(p, &item);
+        CHECK(item.op == INIT_STREAM_CMD);
+        CHECK(item.cmd == (uint8_t)(tbl[i].addr >> l.cmd_shift));
+        CHECK(item.len == len);
+        CHECK(item.op != INIT_STREAM_CMD || memcmp(item.param, tbl[i].param, len) == 0);
+        for (int d = 0; d < 2; d++) {
+            if (l.delay_flag[d] && (tbl[i].len & l.delay_flag[d])) {
+                p = init_stream_decode(p, &item);
+                CHECK(item.op == INIT_STREAM_DELAY);
+                CHECK(item.delay_ms == l.delay_ms[d]);
+            }
+        }
+        cmds++;
+        if (host_test_failures != before) {
+            fprintf(stderr, "%s: first mismatch at entry %zu\n", name, i);
+            return;
+        }
+    }
+    p = init_stream_decode(p, &item);
+    CHECK(item.op == INIT_STREAM_END);
+    // The end marker is the last byte, decode does not step over it
+    CHECK((size_t)(p + 1 - stream->data) == stream->size);
+    CHECK(cmds == stream->cmds);
+    printf("%-16s %4zu cmds %6zu -> %5u bytes\n", name, cmds, count * sizeof(legacy_lcd_cmd_t), stream->size);
+}
+
+struct recorder {
+    uint32_t writes;
+    uint32_t flushes;
+    uint32_t delays;
+    uint32_t delay_ms;
+    bool flushed;           // nothing queued since the last flush
+};
+
+static void rec_write(void *user, uint8_t cmd, const uint8_t *param, uint8_t len)
+{
+    recorder *r = (recorder *)user;
+    r->writes++;
+    r->flushed = false;
+}
+
+static void rec_flush(void *user)
+{
+    recorder *r = (recorder *)user;
+    r->flushes++;
+    r->flushed = true;
+}
+
+static void rec_delay(void *user, uint32_t ms)
+{
+    recorder *r = (recorder *)user;
+    CHECK(r->flushed);
+    r->delays++;
+    r->delay_ms += ms;
+}
+
+static void check_run(const init_stream_t *stream, uint32_t delays, uint32_t delay_ms)
+{
+    recorder r = {};
+    init_stream_ops_t ops = {rec_write, rec_flush, rec_delay, &r};
+    CHECK(init_stream_run(stream, &ops) == stream->cmds);
+    CHECK(r.writes == stream->cmds);
+    CHECK(r.delays == delays);
+    CHECK(r.delay_ms == delay_ms);
+    CHECK(r.flushes == delays + 1);
+    CHECK(r.flushed);
+}
+
+// T-Display-S3-Long table lives in the stream only: DISPOFF, SLPIN, SLPOUT, DISPON
+static void check_axs15231b(void)
+{
+    static const uint8_t cmds[] = {0x28, 0x10, 0x11, 0x29};
+    static const uint16_t delays[] = {20, 20, 200, 0};
+    const uint8_t *p = axs15231b_init.data;
+    init_stream_item_t item;
+    for (size_t i = 0; i < sizeof(cmds); i++) {
+        p = init_stream_decode(p, &item);
+        CHECK(item.op == INIT_STREAM_CMD && item.cmd == cmds[i] && item.len == 0);
+        if (delays[i]) {
+            p = init_stream_decode(p, &item);
+            CHECK(item.op == INIT_STREAM_DELAY && item.delay_ms == delays[i]);
+        }
+    }
+    p = init_stream_decode(p, &item);
+    CHECK(item.op == INIT_STREAM_END);
+    check_run(&axs15231b_init, 3, 240);
+}
+
+static void check_find(void)
+{
+    // Last brightness write of the RM67162 table is what the driver restores
+    const uint8_t *param = NULL;
+    uint8_t len = 0;
+    uint8_t expected = 0;
+    bool present = false;
+    for (size_t i = 0; i < LEGACY_RM67162_INIT_SEQUENCE_LENGHT && legacy_rm67162_cmd[i].len != 0xFF; i++) {
+        if ((legacy_rm67162_cmd[i].addr >> 8) == 0x51) {
+            expected = legacy_rm67162_cmd[i].param[0];
+            present = true;
+        }
+    }
+    CHECK(init_stream_find(&rm67162_init, 0x51, &param, &len) == present);
+    CHECK(!present || (len == 1 && param[0] == expected));
+    CHECK(!init_stream_find(&rm67162_init, 0xEE, &param, &len));
+}
+
+// Delays the legacy table asks for, as count and total
+static void legacy_delays(const legacy_lcd_cmd_t *tbl, size_t count, const legacy_layout &l,
+                          uint32_t *delays, uint32_t *delay_ms)
+{
+    *delays = 0;
+    *delay_ms = 0;
+    for (size_t i = 0; i < count && tbl[i].len != 0xFF; i++) {
+        for (int d = 0; d < 2; d++) {
+            if (l.delay_flag[d] && (tbl[i].len & l.delay_flag[d])) {
+                (*delays)++;
+                *delay_ms += l.delay_ms[d];
+            }
+        }
+    }
+}
+
+#define CHECK_TABLE(stream, tbl, layout) do {                                   \
+        uint32_t delays, delay_ms;                                              \
+        check_decode(#stream, &stream, tbl, sizeof(tbl) / sizeof(tbl[0]), layout); \
+        legacy_delays(tbl, sizeof(tbl) / sizeof(tbl[0]), layout, &delays, &delay_ms); \
+        check_run(&stream, delays, delay_ms);                                   \
+    } while (0)
+
+int main(void)
+{
+    CHECK_TABLE(sh8501_init, legacy_sh8501_cmd, qspi_layout);
+    CHECK_TABLE(rm67162_init, legacy_rm67162_cmd, qspi_layout);
+    CHECK_TABLE(rm690b0_init, legacy_rm690b0_cmd, qspi_layout);
+    CHECK_TABLE(jd9613_init, legacy_jd9613_cmd, jd9613_layout);
+    CHECK_TABLE(st7701_2_1_init, legacy_st7701_2_1_inches, st7701_layout);
+    CHECK_TABLE(st7701_2_8_init, legacy_st7701_2_8_inches, st7701_layout);
+    check_axs15231b();
+    check_find();
+    return host_test_result();
+}
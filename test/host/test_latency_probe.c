@@ -0,0 +1,93 @@
+/**
+ * @file      test_latency_probe.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include "host_test.h"
+#include "latency_probe.h"
+
+/*
+ * Fake 320x240 display refreshing every 16 ms, flushed in 40 row parts of
+ * 3 ms each. The fake touch source taps every 100 ms and is read at a
+ * random phase of the frame.
+ */
+#define FRAME_US    16000
+#define PART_US     3000
+#define PART_ROWS   40
+#define TAPS        200
+
+static void frame(int64_t t, int16_t y1, int16_t y2)
+{
+    for (int16_t y = y1; y <= y2; y += PART_ROWS) {
+        int16_t end = y + PART_ROWS - 1 > y2 ? y2 : y + PART_ROWS - 1;
+        latency_probe_flush_start(t, 0, y, 319, end, end == y2);
+        t += PART_US;
+        latency_probe_flush_done(t);
+    }
+}
+
+static int16_t clamp_row(int y)
+{
+    return y < 0 ? 0 : y > 239 ? 239 : y;
+}
+
+static void run(bool full_refresh, latency_stats_t *s)
+{
+    uint32_t seed = 1;
+    latency_probe_reset();
+    for (int i = 0; i < TAPS; i++) {
+        seed = seed * 1103515245 + 12345;
+        int64_t read_at = i * 100000LL + (seed >> 16) % FRAME_US;
+        int16_t x = 50 + (seed >> 8) % 200, y = 20 + (seed >> 4) % 200;
+        latency_probe_touch(read_at, x, y);
+
+        int64_t next_frame = (read_at / FRAME_US + 1) * FRAME_US;
+        if (full_refresh) {
+            frame(next_frame, 0, 239);
+        } else {
+            // An unrelated area first, the probe must wait for the one under the finger
+            latency_probe_invalidate(0, 0, 319, 10);
+            latency_probe_invalidate(x - 20, y - 10, x + 20, y + 10);
+            frame(next_frame, clamp_row(y - 10), clamp_row(y + 10));
+        }
+    }
+
+    // A touch on a static area never draws, it times out rather than matching a later one
+    latency_probe_touch(30000000, 5, 5);
+    latency_probe_touch(31500000, 100, 100);
+    latency_probe_invalidate(90, 90, 110, 110);
+    frame(31516000, 90, 110);
+
+    latency_probe_get(s);
+    latency_probe_print(stdout);
+}
+
+int main(void)
+{
+    latency_stats_t s;
+
+    // Partial refresh: one part of 3 ms after at most a frame of waiting
+    run(false, &s);
+    CHECK(s.count == TAPS + 1);
+    CHECK(s.dropped == 1);
+    CHECK(s.min_us >= PART_US);
+    CHECK(s.max_us <= FRAME_US + 2 * PART_US);
+    CHECK(latency_stats_percentile(&s, 50) <= latency_stats_percentile(&s, 99));
+    CHECK(latency_stats_percentile(&s, 99) <= (s.max_us / LATENCY_PROBE_BUCKET_US + 1) * LATENCY_PROBE_BUCKET_US);
+
+    // Full refresh: the clock runs until the last of six parts
+    run(true, &s);
+    CHECK(s.count == TAPS + 1);
+    CHECK(s.dropped == 1);
+    CHECK(s.min_us >= 6 * PART_US);
+    CHECK(s.max_us <= FRAME_US + 6 * PART_US);
+
+    latency_probe_reset();
+    latency_probe_get(&s);
+    CHECK(s.count == 0 && s.dropped == 0);
+    CHECK(latency_stats_percentile(&s, 50) == 0);
+    return host_test_result();
+}
@@ -0,0 +1,192 @@
+/**
+ * @file      test_pmu_decode.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <string.h>
+#include "host_test.h"
+#include "pmu_decode.h"
+
+/*
+ * Simulated register files, read back in the same bursts pmu_telemetry.c
+ * issues, then decoded.
+ */
+static uint8_t axp[256];
+static uint8_t sy[SY6970_REG_LAST + 1];
+
+static const uint8_t *burst(const uint8_t *file, uint8_t reg)
+{
+    return &file[reg];
+}
+
+static const axp2101_rail_t *rail(const char *name)
+{
+    for (size_t i = 0; i < axp2101_rail_count; i++) {
+        if (strcmp(axp2101_rails[i].name, name) == 0) {
+            return &axp2101_rails[i];
+        }
+    }
+    return NULL;
+}
+
+static uint16_t rail_mv(const char *name, uint8_t value)
+{
+    const axp2101_rail_t *r = rail(name);
+    axp[r->voltage_reg] = value;
+    return axp2101_rail_mv(r, burst(axp, AXP2101_REG_DC_ONOFF));
+}
+
+// Every range of the DC and LDO voltage codes, including the step changes
+static void test_rail_voltages(void)
+{
+    memset(axp, 0, sizeof(axp));
+    CHECK(rail_mv("DC1", 0x12) == 3300);
+
+    // DC2/DC3: 10 mV to 70, 20 mV to 87, DC3 only: 100 mV from 88
+    CHECK(rail_mv("DC2", 0) == 500);
+    CHECK(rail_mv("DC2", 70) == 1200);
+    CHECK(rail_mv("DC2", 71) == 1220);
+    CHECK(rail_mv("DC2", 87) == 1540);
+    CHECK(rail_mv("DC3", 88) == 1600);
+    CHECK(rail_mv("DC3", 105) == 3300);
+    CHECK(rail_mv("DC3", 106) == 3400);
+    // The top bit is not part of the code
+    CHECK(rail_mv("DC3", 0x80 | 105) == 3300);
+
+    // DC4 keeps 20 mV steps up to 1.84 V
+    CHECK(rail_mv("DC4", 70) == 1200);
+    CHECK(rail_mv("DC4", 71) == 1220);
+    CHECK(rail_mv("DC4", 102) == 1840);
+
+    CHECK(rail_mv("DC5", 0x12) == 3200);
+    CHECK(rail_mv("ALDO1", 0x1C) == 3300);
+    CHECK(rail_mv("BLDO2", 0x0D) == 1800);
+    CHECK(rail_mv("DLDO1", 0x1C) == 3300);
+
+    // CPUSLDO and DLDO2 in 50 mV steps
+    CHECK(rail_mv("CPUSLDO", 0) == 500);
+    CHECK(rail_mv("CPUSLDO", 18) == 1400);
+    CHECK(rail_mv("DLDO2", 1) == 550);
+    CHECK(rail_mv("DLDO2", 0x0D) == 1150);
+}
+
+// Enable bits across the three on/off registers, DLDO2 sits alone in 0x91
+static void test_rail_enables(void)
+{
+    memset(axp, 0, sizeof(axp));
+    axp[0x80] = 0x05;       // DC1, DC3
+    axp[0x90] = 0x41;       // ALDO1, CPUSLDO
+    axp[0x91] = 0x01;       // DLDO2
+    const uint8_t *regs = burst(axp, AXP2101_REG_DC_ONOFF);
+    uint32_t on = 0;
+    for (size_t i = 0; i < axp2101_rail_count; i++) {
+        on |= (uint32_t)axp2101_rail_on(&axp2101_rails[i], regs) << i;
+    }
+    CHECK(axp2101_rail_on(rail("DC1"), regs) && axp2101_rail_on(rail("DC3"), regs));
+    CHECK(axp2101_rail_on(rail("ALDO1"), regs) && axp2101_rail_on(rail("CPUSLDO"), regs));
+    CHECK(axp2101_rail_on(rail("DLDO2"), regs));
+    CHECK(!axp2101_rail_on(rail("DC2"), regs) && !axp2101_rail_on(rail("DLDO1"), regs));
+    CHECK(__builtin_popcount(on) == 5);
+
+    // Every rail register falls inside the one burst the dump reads
+    CHECK(axp2101_rail_count == 14);
+    for (size_t i = 0; i < axp2101_rail_count; i++) {
+        CHECK(axp2101_rails[i].enable_reg - AXP2101_REG_DC_ONOFF < AXP2101_RAIL_REGS);
+        CHECK(axp2101_rails[i].voltage_reg - AXP2101_REG_DC_ONOFF < AXP2101_RAIL_REGS);
+    }
+}
+
+static void set_adc(uint8_t reg, uint16_t mv)
+{
+    axp[reg] = mv >> 8;
+    axp[reg + 1] = mv & 0xFF;
+}
+
+static pmu_status_t axp_status(void)
+{
+    pmu_status_t st;
+    memset(&st, 0xA5, sizeof(st));
+    axp2101_decode_status(burst(axp, AXP2101_REG_STATUS1), burst(axp, AXP2101_REG_ADC_VBAT_H),
+                          axp[AXP2101_REG_BAT_PERCENT], &st);
+    return st;
+}
+
+static void test_axp2101_status(void)
+{
+    memset(axp, 0, sizeof(axp));
+    axp[0x00] = 0x28;       // VBUS good, battery present
+    axp[0x01] = 0x20;       // charging
+    set_adc(0x34, 3987);
+    set_adc(0x36, 0x3FFF);  // TS, not reported
+    set_adc(0x38, 5012);
+    set_adc(0x3A, 4800);
+    axp[AXP2101_REG_BAT_PERCENT] = 76;
+
+    pmu_status_t st = axp_status();
+    CHECK(st.battery_present && st.vbus_in && st.charging);
+    CHECK(st.vbat_mv == 3987 && st.vbus_mv == 5012 && st.vsys_mv == 4800);
+    CHECK(st.battery_percent == 76);
+
+    // Discharging, VBUS reported absent by status2 even with status1 good
+    axp[0x01] = 0x48;
+    st = axp_status();
+    CHECK(!st.charging && !st.vbus_in && st.vbus_mv == 0);
+
+    // No battery: no voltage or gauge, whatever the ADC holds
+    axp[0x00] = 0x20;
+    axp[0x01] = 0x00;
+    st = axp_status();
+    CHECK(!st.battery_present && st.vbat_mv == 0 && st.battery_percent == -1);
+    CHECK(st.vbus_in && st.vbus_mv == 5012);
+}
+
+static pmu_status_t sy_status(void)
+{
+    pmu_status_t st;
+    memset(&st, 0xA5, sizeof(st));
+    sy6970_decode_status(burst(sy, SY6970_REG_STATUS), &st);
+    return st;
+}
+
+// 0x0B status, 0x0C fault, 0x0D VINDPM, 0x0E BATV, 0x0F SYSV, 0x10 TSPCT, 0x11 VBUSV
+static void test_sy6970_status(void)
+{
+    memset(sy, 0, sizeof(sy));
+    sy[0x0B] = 0x10;        // fast charging
+    sy[0x0C] = 0xFF;        // faults are not decoded
+    sy[0x0D] = 0x7F;        // neither is VINDPM, it must not be read as BATV
+    sy[0x0E] = 85;          // 2304 + 85 * 20
+    sy[0x0F] = 90;
+    sy[0x11] = 0x80 | 24;   // VBUS good, 2600 + 24 * 100
+
+    pmu_status_t st = sy_status();
+    CHECK(st.battery_present && st.charging && st.vbus_in);
+    CHECK(st.vbat_mv == 4004 && st.vsys_mv == 4104 && st.vbus_mv == 5000);
+    CHECK(st.battery_percent == -1);
+
+    // Pre-charge counts as charging, done does not
+    sy[0x0B] = 0x08;
+    CHECK(sy_status().charging);
+    sy[0x0B] = 0x18;
+    CHECK(!sy_status().charging);
+
+    // BATV reads zero with no battery, VBUS not good reads absent
+    sy[0x0E] = 0x80;
+    sy[0x11] = 24;
+    st = sy_status();
+    CHECK(!st.battery_present && st.vbat_mv == 0);
+    CHECK(!st.vbus_in && st.vbus_mv == 0);
+    CHECK(st.vsys_mv == 4104);
+}
+
+int main(void)
+{
+    test_rail_voltages();
+    test_rail_enables();
+    test_axp2101_status();
+    test_sy6970_status();
+    return host_test_result();
+}
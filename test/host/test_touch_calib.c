@@ -0,0 +1,104 @@
+/**
+ * @file      test_touch_calib.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <math.h>
+#include <stdlib.h>
+#include "host_test.h"
+#include "touch_calib.h"
+
+// Crosshair targets of the 320x240 calibration screen
+static const touch_calib_point_t targets[TOUCH_CALIB_POINTS] = {{32, 24}, {288, 120}, {160, 216}};
+
+/*
+ * A mirrored, skewed and offset panel: what the controller reports for a
+ * touch at screen position x, y.
+ */
+static void panel(double x, double y, double *xr, double *yr)
+{
+    *xr = 0.9 * (320 - x) + 0.05 * y + 7;
+    *yr = -0.03 * x + 1.1 * y - 5;
+}
+
+// The map from three taps holds over the whole screen, within the Q16 and tap rounding
+static void test_solve(void)
+{
+    touch_calib_point_t raw[TOUCH_CALIB_POINTS];
+    for (int i = 0; i < TOUCH_CALIB_POINTS; i++) {
+        double xr, yr;
+        panel(targets[i].x, targets[i].y, &xr, &yr);
+        raw[i].x = lround(xr);
+        raw[i].y = lround(yr);
+    }
+    touch_calib_t cal;
+    CHECK(touch_calib_solve(raw, targets, &cal));
+
+    double max_err = 0;
+    for (int x = 0; x < 320; x += 7) {
+        for (int y = 0; y < 240; y += 7) {
+            double xr, yr;
+            int16_t ox, oy;
+            panel(x, y, &xr, &yr);
+            touch_calib_apply(&cal, lround(xr), lround(yr), &ox, &oy);
+            max_err = fmax(max_err, hypot(ox - x, oy - y));
+        }
+    }
+    printf("max map error %.2f px\n", max_err);
+    CHECK(max_err <= 2.0);
+
+    // The taps themselves land on their targets
+    for (int i = 0; i < TOUCH_CALIB_POINTS; i++) {
+        int16_t ox, oy;
+        touch_calib_apply(&cal, raw[i].x, raw[i].y, &ox, &oy);
+        CHECK(abs(ox - targets[i].x) <= 1 && abs(oy - targets[i].y) <= 1);
+    }
+}
+
+static void test_identity(void)
+{
+    touch_calib_t id = TOUCH_CALIB_IDENTITY();
+    int16_t ox, oy;
+    touch_calib_apply(&id, 123, -45, &ox, &oy);
+    CHECK(ox == 123 && oy == -45);
+}
+
+// Taps on a line, or all in one spot, are a missed tap and not a calibration
+static void test_rejects(void)
+{
+    touch_calib_t cal;
+    const touch_calib_point_t line[TOUCH_CALIB_POINTS] = {{10, 10}, {100, 100}, {200, 200}};
+    const touch_calib_point_t repeated[TOUCH_CALIB_POINTS] = {{100, 100}, {101, 100}, {100, 102}};
+    CHECK(!touch_calib_solve(line, targets, &cal));
+    CHECK(!touch_calib_solve(repeated, targets, &cal));
+}
+
+static void test_oversample(void)
+{
+    uint16_t x, y;
+    // One light sample and one far outlier go, the rest average out
+    const touch_raw_sample_t burst[] = {
+        {100, 50, 800}, {102, 51, 790}, {99, 49, 810}, {180, 10, 805}, {101, 50, 300}, {100, 52, 795},
+    };
+    CHECK(touch_oversample(burst, 6, 8, &x, &y));
+    CHECK(x == 100 && y == 51);
+
+    // Mostly the edge of a press
+    const touch_raw_sample_t light[] = {{100, 50, 800}, {10, 10, 100}, {20, 20, 120}, {30, 30, 110}};
+    CHECK(!touch_oversample(light, 4, 8, &x, &y));
+
+    const touch_raw_sample_t released[] = {{1, 1, 0}, {2, 2, 0}};
+    CHECK(!touch_oversample(released, 2, 8, &x, &y));
+}
+
+int main(void)
+{
+    test_solve();
+    test_identity();
+    test_rejects();
+    test_oversample();
+    return host_test_result();
+}
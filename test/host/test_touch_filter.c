@@ -0,0 +1,164 @@
+/**
+ * @file      test_touch_filter.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <math.h>
+#include "host_test.h"
+#include "touch_filter.h"
+
+#define SAMPLE_US       15000       // touch polling period
+#define DISPLAY_LEAD_US 16000       // sample to photon, one frame at 60 Hz
+#define SAMPLES         400
+#define REST_FROM       200         // the finger stops here and stays
+
+/*
+ * A trace is a circular drag followed by a rest, sampled every 15 ms with
+ * sensor noise added. The ground truth is the noiseless path, both at the
+ * sample time and at the time the frame reaches the display.
+ */
+typedef struct {
+    float noise_px;             // standard deviation per axis
+    int spike_every;            // one resistive outlier per N samples, 0 for none
+    float speed_px_s;
+} trace_t;
+
+typedef struct {
+    double raw;                 // raw sample against the truth
+    double filtered;
+    double held;                // filtered position shown one frame later
+    double predicted;           // predicted position for the display time
+    double rest_raw;            // jitter once the finger rests
+    double rest_filtered;
+} trace_error_t;
+
+// Own generator, the traces must not depend on the C library's rand()
+static uint32_t lcg_state;
+
+static float uniform(void)
+{
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return ((lcg_state >> 8) + 1.0f) / 16777218.0f;
+}
+
+static float gauss(void)
+{
+    float u = uniform(), v = uniform();
+    return sqrtf(-2.0f * logf(u)) * cosf(6.2831853f * v);
+}
+
+static void truth(const trace_t *tr, int64_t time_us, float *x, float *y)
+{
+    const int64_t rest_us = (int64_t)REST_FROM * SAMPLE_US;
+    float w = tr->speed_px_s / 120.0f;
+    float sec = (time_us < rest_us ? time_us : rest_us) / 1e6f;
+    *x = 200 + 120 * cosf(sec * w);
+    *y = 150 + 120 * sinf(sec * w);
+}
+
+static void replay(const trace_t *tr, const touch_filter_config_t *cfg, trace_error_t *err)
+{
+    touch_filter_t f;
+    touch_filter_init(&f, cfg);
+    lcg_state = 7;
+    int moving = 0, resting = 0;
+    *err = (trace_error_t) {0};
+
+    for (int i = 0; i < SAMPLES; i++) {
+        int64_t t = (int64_t)i * SAMPLE_US;
+        float gx, gy, dx, dy;
+        truth(tr, t, &gx, &gy);
+        truth(tr, t + DISPLAY_LEAD_US, &dx, &dy);
+
+        int16_t x = (int16_t)lroundf(gx + tr->noise_px * gauss());
+        int16_t y = (int16_t)lroundf(gy + tr->noise_px * gauss());
+        if (tr->spike_every && (lcg_state >> 16) % tr->spike_every == 0) {
+            x += 30;
+            y -= 25;
+        }
+        double raw = hypot(x - gx, y - gy);
+        touch_filter_update(&f, t, &x, &y);
+        int16_t px = x, py = y;
+        touch_filter_predict(&f, t + DISPLAY_LEAD_US, &px, &py);
+
+        // Skip the filter settling in and the stop itself
+        if (i >= 20 && i < REST_FROM) {
+            err->raw += raw;
+            err->filtered += hypot(x - gx, y - gy);
+            err->held += hypot(x - dx, y - dy);
+            err->predicted += hypot(px - dx, py - dy);
+            moving++;
+        } else if (i >= REST_FROM + 30) {
+            err->rest_raw += raw;
+            err->rest_filtered += hypot(x - gx, y - gy);
+            resting++;
+        }
+    }
+    err->raw /= moving;
+    err->filtered /= moving;
+    err->held /= moving;
+    err->predicted /= moving;
+    err->rest_raw /= resting;
+    err->rest_filtered /= resting;
+}
+
+static void report(const char *name, const trace_t *tr, const trace_error_t *e)
+{
+    printf("%-28s %5.0f px/s  raw %5.2f  filtered %5.2f  at display: held %5.2f predicted %5.2f  rest %5.2f -> %5.2f\n",
+           name, tr->speed_px_s, e->raw, e->filtered, e->held, e->predicted, e->rest_raw, e->rest_filtered);
+}
+
+int main(void)
+{
+    const touch_filter_config_t off = {.median = 1, .min_cutoff_hz = 0, .d_cutoff_hz = 10, .predict_max_us = 0};
+    const touch_filter_config_t def = TOUCH_FILTER_CONFIG_DEFAULT();
+    const touch_filter_config_t resistive = TOUCH_FILTER_CONFIG_RESISTIVE();
+
+    static const float speeds[] = {300, 1000};
+    for (size_t i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++) {
+        trace_t cap = {1.5f, 0, speeds[i]};
+        trace_t res = {4.0f, 15, speeds[i]};
+        trace_error_t cap_raw, cap_def, res_raw, res_def, res_med;
+
+        replay(&cap, &off, &cap_raw);
+        replay(&cap, &def, &cap_def);
+        replay(&res, &off, &res_raw);
+        replay(&res, &def, &res_def);
+        replay(&res, &resistive, &res_med);
+        report("capacitive, unfiltered", &cap, &cap_raw);
+        report("capacitive, default", &cap, &cap_def);
+        report("resistive, unfiltered", &res, &res_raw);
+        report("resistive, one-euro", &res, &res_def);
+        report("resistive, median3+one-euro", &res, &res_med);
+
+        // At rest the one-euro stage damps the jitter
+        CHECK(cap_def.rest_filtered < cap_raw.rest_raw);
+        CHECK(res_def.rest_filtered < res_raw.rest_raw);
+        // The median removes the outliers the one-euro stage only smears, at the cost of lag
+        CHECK(res_med.rest_filtered < res_def.rest_filtered);
+        // Prediction brings the drawn point closer to the finger than holding the last one
+        CHECK(cap_def.predicted < cap_def.held);
+        CHECK(res_med.predicted < res_med.held);
+        // With either panel's defaults a drag is closer to the finger than the raw points
+        CHECK(cap_def.predicted < cap_raw.held);
+        CHECK(res_med.predicted < res_raw.held);
+    }
+
+    // Prediction stops at predict_max_us
+    touch_filter_t f;
+    touch_filter_init(&f, &def);
+    for (int i = 0; i < 10; i++) {
+        int16_t x = 100 + i * 15, y = 100;
+        touch_filter_update(&f, (int64_t)i * SAMPLE_US, &x, &y);
+    }
+    int16_t near_x = 0, near_y = 0, far_x = 0, far_y = 0;
+    touch_filter_predict(&f, 9 * SAMPLE_US + def.predict_max_us, &near_x, &near_y);
+    touch_filter_predict(&f, 9 * SAMPLE_US + 10 * def.predict_max_us, &far_x, &far_y);
+    CHECK(near_x > 0 && near_y > 0);
+    CHECK(near_x == far_x && near_y == far_y);
+
+    return host_test_result();
+}
@@ -0,0 +1,155 @@
+/**
+ * @file      test_trace_ring.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <string.h>
+#include "host_test.h"
+#include "trace_ring.h"
+
+#define WRITERS         3
+#define WRITES          200000
+
+_Static_assert(sizeof(trace_event_t) == 20, "tools/trace_decode.py reads 20 byte records");
+
+/*
+ * Writers fill every field from one counter so a torn record shows up as
+ * fields that do not belong together.
+ */
+static void *writer(void *arg)
+{
+    int id = (int)(long)arg;
+    for (int i = 0; i < WRITES; i++) {
+        int16_t v = i & 0x7FFF;
+        trace_ring_record(TRACE_EV_TOUCH, id, v, -v, id, i);
+        if (!(i & 63)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void test_concurrent(void)
+{
+    static trace_event_t ev[TRACE_RING_SIZE];
+    pthread_t threads[WRITERS];
+    trace_ring_clear();
+    for (long i = 0; i < WRITERS; i++) {
+        pthread_create(&threads[i], NULL, writer, (void *)i);
+    }
+
+    long snapshots = 0, records = 0, torn = 0, order = 0;
+    for (int k = 0; k < 2000; k++) {
+        size_t n = trace_ring_snapshot(ev, TRACE_RING_SIZE);
+        snapshots++;
+        records += n;
+        for (size_t i = 0; i < n; i++) {
+            if (ev[i].b != -ev[i].a || ev[i].c != ev[i].arg || (int16_t)(ev[i].d & 0x7FFF) != ev[i].a) {
+                torn++;
+            }
+            if (i && ev[i].seq <= ev[i - 1].seq) {
+                order++;
+            }
+        }
+        sched_yield();
+    }
+    for (int i = 0; i < WRITERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    printf("%ld snapshots, %ld records each on average\n", snapshots, records / snapshots);
+    CHECK(torn == 0);
+    CHECK(order == 0);
+
+    // Quiet ring: a full snapshot of the newest records
+    size_t n = trace_ring_snapshot(ev, TRACE_RING_SIZE);
+    CHECK(n == TRACE_RING_SIZE);
+    CHECK(n && ev[n - 1].seq - ev[0].seq == TRACE_RING_SIZE - 1);
+    CHECK(trace_ring_snapshot(ev, 10) == 10);
+}
+
+static int hex_nibble(char c)
+{
+    return c <= '9' ? c - '0' : c - 'a' + 10;
+}
+
+/*
+ * The export block read back the way tools/trace_decode.py reads it: the
+ * header carries the record size and count, then one hex line per record.
+ */
+static void test_export(const char *path)
+{
+    trace_ring_clear();
+    trace_flush_start(0, 0, 240, 40);
+    trace_touch(10, 20, 1, 0);
+    trace_i2c(0x3B, 0xB5, 20, 0x107, 812);
+    trace_gesture(3, -5, 7, 130);
+    trace_flush_end();
+
+    trace_event_t want[8];
+    size_t count = trace_ring_snapshot(want, 8);
+    CHECK(count == 5);
+
+    FILE *f = fopen(path, "w+");
+    CHECK(f != NULL);
+    if (!f) {
+        return;
+    }
+    // Serial noise around the block, as in a captured monitor log
+    fputs("I (123) boot: ESP-IDF v5.3\n", f);
+    trace_ring_export(f);
+    fputs("I (456) main: done\n", f);
+    rewind(f);
+
+    char line[128];
+    unsigned size = 0, n = 0;
+    size_t got = 0;
+    bool in_block = false, ended = false;
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "--- trace_ring %u %u ---", &size, &n) == 2) {
+            in_block = true;
+            continue;
+        }
+        if (!in_block) {
+            continue;
+        }
+        if (strncmp(line, "--- end trace_ring ---", 22) == 0) {
+            ended = true;
+            break;
+        }
+        CHECK(strlen(line) == sizeof(trace_event_t) * 2 + 1);
+        uint8_t raw[sizeof(trace_event_t)];
+        for (size_t i = 0; i < sizeof(raw); i++) {
+            raw[i] = hex_nibble(line[i * 2]) << 4 | hex_nibble(line[i * 2 + 1]);
+        }
+        if (got < count) {
+            CHECK(memcmp(raw, &want[got], sizeof(raw)) == 0);
+        }
+        got++;
+    }
+    fclose(f);
+    CHECK(ended);
+    CHECK(size == sizeof(trace_event_t));
+    CHECK(n == count && got == count);
+
+    CHECK(want[0].type == TRACE_EV_FLUSH_START && want[0].c == 240 && want[0].d == 40);
+    CHECK(want[2].type == TRACE_EV_I2C && want[2].arg == 0x3B && want[2].a == 0xB5 && want[2].d == 812);
+    CHECK(want[3].type == TRACE_EV_GESTURE && want[3].a == -5 && want[3].c == 130);
+    for (size_t i = 1; i < count; i++) {
+        CHECK(want[i].seq == want[i - 1].seq + 1);
+        CHECK((int32_t)(want[i].time_us - want[i - 1].time_us) >= 0);
+    }
+}
+
+// The export is left in the given file for the decoder test
+int main(int argc, char **argv)
+{
+    test_concurrent();
+    test_export(argc > 1 ? argv[1] : "trace_ring.log");
+    return host_test_result();
+}
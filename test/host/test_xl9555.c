@@ -0,0 +1,177 @@
+/**
+ * @file      test_xl9555.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdlib.h>
+#include "host_test.h"
+#include "xl9555_sim.h"
+
+static xl9555_sim_t sim;
+
+static void set_bit(uint8_t *regs, uint8_t pin, bool on)
+{
+    if (on) {
+        regs[pin >> 3] |= 1 << (pin & 7);
+    } else {
+        regs[pin >> 3] &= ~(1 << (pin & 7));
+    }
+}
+
+// Shadows start from what the chip holds
+static void test_init(void)
+{
+    xl9555_bus_t bus = xl9555_sim_reset(&sim);
+    sim.regs[XL9555_REG_OUTPUT0] = 0x12;
+    sim.regs[XL9555_REG_CONFIG0 + 1] = 0x0F;
+    xl9555_t dev;
+    CHECK(xl9555_init(&dev, &bus) == 0);
+    CHECK(dev.out[0] == 0x12 && dev.out[1] == 0xFF);
+    CHECK(dev.cfg[0] == 0xFF && dev.cfg[1] == 0x0F);
+    CHECK(sim.writes == 0);
+}
+
+// Every pin change is a single write, a change to the current level none at all
+static void test_write_costs(void)
+{
+    xl9555_bus_t bus = xl9555_sim_reset(&sim);
+    xl9555_t dev;
+    CHECK(xl9555_init(&dev, &bus) == 0);
+    uint32_t reads = sim.reads;
+
+    CHECK(xl9555_write(&dev, 6, false) == 0);
+    CHECK(sim.writes == 1);
+    CHECK(xl9555_write(&dev, 6, false) == 0);
+    CHECK(xl9555_pin_mode(&dev, 6, true) == 0);
+    CHECK(xl9555_pin_mode(&dev, 6, true) == 0);
+    CHECK(sim.writes == 2);
+    CHECK(sim.reads == reads);
+    CHECK(!(sim.regs[XL9555_REG_OUTPUT0] & (1 << 6)));
+    CHECK(!(sim.regs[XL9555_REG_CONFIG0] & (1 << 6)));
+}
+
+// Touch reset and panel power: a batch of changes costs one write per register pair
+static void test_batch(void)
+{
+    xl9555_bus_t bus = xl9555_sim_reset(&sim);
+    xl9555_t dev;
+    CHECK(xl9555_init(&dev, &bus) == 0);
+
+    xl9555_batch_begin(&dev);
+    for (uint8_t pin = 0; pin < XL9555_PIN_COUNT; pin++) {
+        CHECK(xl9555_write(&dev, pin, pin & 1) == 0);
+        CHECK(xl9555_pin_mode(&dev, pin, true) == 0);
+    }
+    xl9555_batch_begin(&dev);
+    CHECK(xl9555_write(&dev, 0, true) == 0);
+    CHECK(xl9555_batch_end(&dev) == 0);
+    CHECK(sim.writes == 0);
+    CHECK(xl9555_batch_end(&dev) == 0);
+    CHECK(sim.writes == 2);
+    CHECK(sim.regs[XL9555_REG_OUTPUT0] == 0xAB && sim.regs[XL9555_REG_OUTPUT0 + 1] == 0xAA);
+    CHECK(sim.regs[XL9555_REG_CONFIG0] == 0x00 && sim.regs[XL9555_REG_CONFIG0 + 1] == 0x00);
+
+    // Explicit flush inside a batch, e.g. SD CS before a transfer
+    xl9555_batch_begin(&dev);
+    CHECK(xl9555_write(&dev, 7, false) == 0);
+    CHECK(xl9555_flush(&dev) == 0);
+    CHECK(sim.writes == 3);
+    CHECK(!(sim.regs[XL9555_REG_OUTPUT0] & (1 << 7)));
+    CHECK(xl9555_batch_end(&dev) == 0);
+    CHECK(sim.writes == 3);
+}
+
+// Outputs go out before directions, a pin switched to output never glitches
+static void test_batch_order(void)
+{
+    xl9555_bus_t bus = xl9555_sim_reset(&sim);
+    xl9555_t dev;
+    CHECK(xl9555_init(&dev, &bus) == 0);
+    xl9555_batch_begin(&dev);
+    CHECK(xl9555_pin_mode(&dev, 2, true) == 0);
+    CHECK(xl9555_write(&dev, 2, false) == 0);
+    sim.trace_len = 0;
+    CHECK(xl9555_batch_end(&dev) == 0);
+    CHECK(sim.trace_len == 1 && !(sim.trace[0] & (1 << 2)));
+    CHECK(!(sim.regs[XL9555_REG_CONFIG0] & (1 << 2)));
+}
+
+// Random pin traffic against a plain model of the registers
+static void test_random(void)
+{
+    xl9555_bus_t bus = xl9555_sim_reset(&sim);
+    xl9555_t dev;
+    CHECK(xl9555_init(&dev, &bus) == 0);
+    uint8_t out[2] = {0xFF, 0xFF}, cfg[2] = {0xFF, 0xFF};
+    srand(1);
+
+    for (int i = 0; i < 100000 && !host_test_failures; i++) {
+        int op = rand() % 5, pin = rand() % XL9555_PIN_COUNT, level = rand() & 1;
+        switch (op) {
+        case 0:
+            CHECK(xl9555_write(&dev, pin, level) == 0);
+            set_bit(out, pin, level);
+            break;
+        case 1:
+            CHECK(xl9555_pin_mode(&dev, pin, level) == 0);
+            set_bit(cfg, pin, !level);
+            break;
+        case 2:
+            if (dev.batch < 4) {
+                xl9555_batch_begin(&dev);
+            }
+            break;
+        case 3:
+            if (dev.batch) {
+                CHECK(xl9555_batch_end(&dev) == 0);
+            }
+            break;
+        default:
+            // A read sees the input register and flushes whatever is pending
+            sim.regs[XL9555_REG_INPUT0] = rand();
+            sim.regs[XL9555_REG_INPUT0 + 1] = rand();
+            CHECK(xl9555_read(&dev, pin) == ((sim.regs[XL9555_REG_INPUT0 + (pin >> 3)] >> (pin & 7)) & 1));
+            CHECK(memcmp(out, sim.regs + XL9555_REG_OUTPUT0, 2) == 0);
+            CHECK(memcmp(cfg, sim.regs + XL9555_REG_CONFIG0, 2) == 0);
+            break;
+        }
+        if (!dev.batch) {
+            CHECK(memcmp(out, sim.regs + XL9555_REG_OUTPUT0, 2) == 0);
+            CHECK(memcmp(cfg, sim.regs + XL9555_REG_CONFIG0, 2) == 0);
+        }
+    }
+    while (dev.batch) {
+        CHECK(xl9555_batch_end(&dev) == 0);
+    }
+    CHECK(memcmp(out, sim.regs + XL9555_REG_OUTPUT0, 2) == 0);
+    CHECK(memcmp(cfg, sim.regs + XL9555_REG_CONFIG0, 2) == 0);
+    printf("random: %lu writes, %lu reads\n", (unsigned long)sim.writes, (unsigned long)sim.reads);
+}
+
+// Something else wrote the chip, sync reloads the shadows
+static void test_sync(void)
+{
+    xl9555_bus_t bus = xl9555_sim_reset(&sim);
+    xl9555_t dev;
+    CHECK(xl9555_init(&dev, &bus) == 0);
+    sim.regs[XL9555_REG_OUTPUT0 + 1] = 0x55;
+    CHECK(xl9555_sync(&dev) == 0);
+    CHECK(dev.out[1] == 0x55);
+    CHECK(xl9555_write(&dev, 8, false) == 0);
+    CHECK(sim.regs[XL9555_REG_OUTPUT0 + 1] == 0x54);
+}
+
+int main(void)
+{
+    test_init();
+    test_write_costs();
+    test_batch();
+    test_batch_order();
+    test_random();
+    test_sync();
+    CHECK(xl9555_write(NULL, XL9555_PIN_COUNT, true) == -1);
+    return host_test_result();
+}
@@ -0,0 +1,136 @@
+/**
+ * @file      test_xl9555_spi9.c
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#include <stdlib.h>
+#include "host_test.h"
+#include "xl9555_sim.h"
+
+// T-RGB wiring of the ST7701 3-wire SPI
+#define PIN_CS      3
+#define PIN_MOSI    4
+#define PIN_SCLK    5
+#define WORDS       1000
+
+static uint8_t legacy[XL9555_SIM_TRACE];
+static size_t legacy_len;
+static uint32_t legacy_transactions;
+
+// ExtensionIOXL9555::transfer9(): one read-modify-write of the output register per digitalWrite
+static void legacy_pin(uint8_t *state, uint8_t pin, bool level)
+{
+    *state = level ? *state | (1 << pin) : *state & ~(1 << pin);
+    legacy[legacy_len++] = *state;
+    legacy_transactions += 2;
+}
+
+static void legacy_transfer9(uint8_t *state, uint16_t data)
+{
+    legacy_pin(state, PIN_CS, false);
+    for (int i = 0; i < 9; i++) {
+        legacy_pin(state, PIN_SCLK, false);
+        legacy_pin(state, PIN_MOSI, data & 0x100);
+        legacy_pin(state, PIN_SCLK, true);
+        data <<= 1;
+    }
+    legacy_pin(state, PIN_CS, true);
+}
+
+/*
+ * What the panel sees: MOSI sampled on every rising SCLK edge while CS is
+ * low, a frame ends on the rising CS edge and must hold exactly 9 bits.
+ * Returns the frame count, -1 on a malformed frame.
+ */
+static int decode(const uint8_t *states, size_t count, uint8_t idle, uint16_t *frames)
+{
+    uint8_t prev = idle;
+    uint16_t word = 0;
+    int bits = 0, n = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint8_t s = states[i];
+        bool cs = s & (1 << PIN_CS), sclk = s & (1 << PIN_SCLK), mosi = s & (1 << PIN_MOSI);
+        bool was_cs = prev & (1 << PIN_CS), was_sclk = prev & (1 << PIN_SCLK);
+        // Mode 0: data may only change while the clock is low
+        if (!cs && sclk && was_sclk && ((s ^ prev) & (1 << PIN_MOSI))) {
+            return -1;
+        }
+        if (!cs && was_cs) {
+            word = 0;
+            bits = 0;
+        }
+        if (!cs && sclk && !was_sclk) {
+            word = (word << 1) | mosi;
+            bits++;
+        }
+        if (cs && !was_cs) {
+            if (bits != 9) {
+                return -1;
+            }
+            frames[n++] = word;
+        }
+        prev = s;
+    }
+    return n;
+}
+
+int main(void)
+{
+    static xl9555_sim_t sim;
+    xl9555_bus_t bus = xl9555_sim_reset(&sim);
+    // Other pins of both ports carry a pattern that must survive
+    sim.regs[XL9555_REG_OUTPUT0] = 0xA5;
+    sim.regs[XL9555_REG_OUTPUT0 + 1] = 0x3C;
+
+    xl9555_t dev;
+    CHECK(xl9555_init(&dev, &bus) == 0);
+    xl9555_spi9_t spi = {PIN_CS, PIN_SCLK, PIN_MOSI};
+    CHECK(xl9555_spi9_begin(&dev, &spi) == 0);
+    const uint8_t idle = sim.regs[XL9555_REG_OUTPUT0];
+    CHECK(idle & (1 << PIN_CS));
+    CHECK(!(idle & (1 << PIN_SCLK)));
+
+    // The first ST7701 command with its data words (bit 8 set), then random words
+    static const uint16_t head[] = {0x0FF, 0x177, 0x101, 0x100, 0x100, 0x110};
+    uint16_t words[WORDS];
+    srand(7);
+    for (int i = 0; i < WORDS; i++) {
+        words[i] = i < (int)(sizeof(head) / sizeof(head[0])) ? head[i] : rand() & 0x1FF;
+    }
+
+    sim.trace_len = 0;
+    sim.writes = 0;
+    CHECK(xl9555_spi9_write(&dev, &spi, words, WORDS) == 0);
+
+    uint8_t state = idle;
+    legacy_len = 0;
+    for (int i = 0; i < WORDS; i++) {
+        legacy_transfer9(&state, words[i]);
+    }
+
+    static uint16_t batched[WORDS + 1], reference[WORDS + 1];
+    int n_batched = decode(sim.trace, sim.trace_len, idle, batched);
+    int n_reference = decode(legacy, legacy_len, idle, reference);
+    CHECK(n_reference == WORDS);
+    CHECK(n_batched == WORDS);
+    CHECK(n_batched == WORDS && memcmp(batched, reference, sizeof(words)) == 0);
+    CHECK(n_batched == WORDS && memcmp(batched, words, sizeof(words)) == 0);
+
+    // Only the three SPI pins move, the other port is rewritten unchanged
+    const uint8_t spi_pins = (1 << PIN_CS) | (1 << PIN_SCLK) | (1 << PIN_MOSI);
+    for (size_t i = 0; i < sim.trace_len; i++) {
+        CHECK((sim.trace[i] & ~spi_pins) == (0xA5 & ~spi_pins));
+    }
+    CHECK(sim.regs[XL9555_REG_OUTPUT0 + 1] == 0x3C);
+    // Back to idle, MOSI keeps its last bit
+    CHECK((sim.trace[sim.trace_len - 1] & ~(1 << PIN_MOSI)) == (idle & ~(1 << PIN_MOSI)));
+    CHECK(dev.out[0] == sim.regs[XL9555_REG_OUTPUT0]);
+
+    printf("%d words: %zu states in %lu I2C writes, legacy %zu states in %lu I2C transactions\n", WORDS,
+           sim.trace_len, (unsigned long)sim.writes, legacy_len, (unsigned long)legacy_transactions);
+    CHECK(sim.writes == (WORDS + XL9555_SPI9_BURST_WORDS - 1) / XL9555_SPI9_BURST_WORDS);
+    return host_test_result();
+}
@@ -0,0 +1,67 @@
+/**
+ * @file      xl9555_sim.h
+ * @author    Lewis He (lewishe@outlook.com)
+ * @license   MIT
+ * @copyright Copyright (c) 2026  Shenzhen Xinyuan Electronic Technology Co., Ltd
+ * @date      2026-10-19
+ *
+ */
+#pragma once
+
+#include <string.h>
+#include "xl9555.h"
+
+#define XL9555_SIM_TRACE    65536
+
+/*
+ * Register model of the expander behind an xl9555_bus_t. Like the chip, a
+ * multi-byte write toggles between the two registers of a pair. Every
+ * value written to the port 0 output register is kept in trace[].
+ */
+typedef struct {
+    uint8_t regs[8];
+    uint32_t writes;
+    uint32_t reads;
+    uint8_t trace[XL9555_SIM_TRACE];
+    size_t trace_len;
+} xl9555_sim_t;
+
+static int xl9555_sim_write(void *user, const uint8_t *data, size_t len)
+{
+    xl9555_sim_t *sim = (xl9555_sim_t *)user;
+    uint8_t reg = data[0];
+    sim->writes++;
+    for (size_t i = 1; i < len; i++) {
+        if (reg >= sizeof(sim->regs)) {
+            return -1;
+        }
+        if (reg != XL9555_REG_INPUT0 && reg != XL9555_REG_INPUT0 + 1) {
+            sim->regs[reg] = data[i];
+        }
+        if (reg == XL9555_REG_OUTPUT0 && sim->trace_len < XL9555_SIM_TRACE) {
+            sim->trace[sim->trace_len++] = data[i];
+        }
+        reg ^= 1;
+    }
+    return 0;
+}
+
+static int xl9555_sim_read(void *user, uint8_t reg, uint8_t *data, size_t len)
+{
+    xl9555_sim_t *sim = (xl9555_sim_t *)user;
+    sim->reads++;
+    for (size_t i = 0; i < len; i++) {
+        data[i] = sim->regs[(reg & ~1) | ((reg + i) & 1)];
+    }
+    return 0;
+}
+
+// Power-on state: all pins inputs, outputs latched high
+static inline xl9555_bus_t xl9555_sim_reset(xl9555_sim_t *sim)
+{
+    memset(sim, 0, sizeof(*sim));
+    memset(sim->regs + XL9555_REG_OUTPUT0, 0xFF, 2);
+    memset(sim->regs + XL9555_REG_CONFIG0, 0xFF, 2);
+    xl9555_bus_t bus = {xl9555_sim_write, xl9555_sim_read, sim};
+    return bus;
+}
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+"""
+Pack LVGL fmt_txt font sources (as converted by tools/font_rle.py) into a
+binary image for the "fonts" flash partition, plus a C file that defines
+the lv_font_t objects the application links against.
+
+    python3 tools/font_pack.py -o fonts.bin -c font_pack_fonts.c main/fonts/*.c
+
+Image layout (little endian, offsets relative to the start of the font):
+
+    pack header   magic "LFPK", u16 version, u16 font count, 8 reserved
+    font table    per font: char name[20], u32 offset, u32 size, u32 reserved
+    font header   u16 glyphs, u16 cmaps, u8 bpp, u8 bitmap format,
+                  u8 kern left classes, u8 kern right classes, u16 kern scale,
+                  u16 kern type, u32 glyph dsc, u32 cmaps, u32 kern, u32 bitmap,
+                  u32 kern pair count
+    glyph dsc     lv_font_fmt_txt_glyph_dsc_t (8 bytes, LV_FONT_FMT_TXT_LARGE 0)
+    cmaps         u32 range start, u16 range length, u16 glyph id start,
+                  u16 list length, u8 type, u8 reserved, u32 unicode list,
+                  u32 glyph id offset list
+    kern          classes: left class map, right class map, class pair values
+                  pairs: glyph id pairs (u8 or u16), pair values
+    bitmap        run-length glyph bitmaps
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAGIC = b"LFPK"
+VERSION = 1
+NAME_LEN = 20
+FORMAT_RLE = 2
+
+KERN_NONE = 0
+KERN_CLASSES = 1
+KERN_PAIRS_8 = 2
+KERN_PAIRS_16 = 3
+
+CMAP_TYPES = {
+    "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL": 0,
+    "LV_FONT_FMT_TXT_CMAP_SPARSE_FULL": 1,
+    "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY": 2,
+    "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY": 3,
+}
+
+
+def c_array(src, name):
+    m = re.search(r"\b%s\[\] =\s*\{(.*?)\};" % re.escape(name), src, re.S)
+    if not m:
+        return None
+    body = re.sub(r"/\*.*?\*/", "", m.group(1))
+    return [int(x, 0) for x in re.findall(r"-?0x[0-9a-fA-F]+|-?\d+", body)]
+
+
+def c_field(src, name, default=None):
+    m = re.search(r"\.%s\s*=\s*(-?\w+)" % name, src)
+    if not m:
+        return default
+    return m.group(1)
+
+
+def align4(buf):
+    while len(buf) % 4:
+        buf.append(0)
+
+
+def parse_font(path):
+    src = open(path).read()
+    if "font_rle_get_glyph_bitmap" not in src:
+        sys.exit("%s: convert it with tools/font_rle.py first" % path)
+
+    name = re.search(r"const lv_font_t (\w+) = \{", src).group(1)
+    font = {
+        "name": name,
+        "bitmap": bytes(c_array(src, "glyph_bitmap")),
+        "bpp": int(c_field(src, "bpp")),
+        "line_height": int(c_field(src, "line_height")),
+        "base_line": int(c_field(src, "base_line")),
+        "underline_position": int(c_field(src, "underline_position", 0)),
+        "underline_thickness": int(c_field(src, "underline_thickness", 0)),
+        "kern_scale": int(c_field(src, "kern_scale", 0)),
+        "kern_classes": int(c_field(src, "kern_classes", 0)),
+    }
+
+    font["glyphs"] = [tuple(int(v) for v in g) for g in re.findall(
+        r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+        r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}", src)]
+
+    cmaps = []
+    for m in re.finditer(r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+                         r"\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), "
+                         r"\.type = (\w+)", src):
+        cmaps.append({
+            "range_start": int(m.group(1)),
+            "range_length": int(m.group(2)),
+            "glyph_id_start": int(m.group(3)),
+            "unicode_list": None if m.group(4) == "NULL" else c_array(src, m.group(4)),
+            "ofs_list": None if m.group(5) == "NULL" else c_array(src, m.group(5)),
+            "list_length": int(m.group(6)),
+            "type": CMAP_TYPES[m.group(7)],
+        })
+    font["cmaps"] = cmaps
+
+    font["kern"] = None
+    if c_field(src, "kern_dsc") == "NULL":
+        pass
+    elif font["kern_classes"] == 0:
+        ids_size = int(c_field(src, "glyph_ids_size"))
+        font["kern"] = {
+            "type": KERN_PAIRS_16 if ids_size else KERN_PAIRS_8,
+            "ids": c_array(src, "kern_pair_glyph_ids"),
+            "values": c_array(src, "kern_pair_values"),
+            "pair_cnt": int(c_field(src, "pair_cnt")),
+        }
+    else:
+        font["kern"] = {
+            "type": KERN_CLASSES,
+            "left": c_array(src, "kern_left_class_mapping"),
+            "right": c_array(src, "kern_right_class_mapping"),
+            "values": c_array(src, "kern_class_values"),
+            "left_cnt": int(c_field(src, "left_class_cnt")),
+            "right_cnt": int(c_field(src, "right_class_cnt")),
+        }
+    return font
+
+
+def build_font(font):
+    body = bytearray(32)
+
+    glyph_ofs = len(body)
+    for bitmap_index, adv_w, box_w, box_h, ofs_x, ofs_y in font["glyphs"]:
+        # bitmap_index:20 and adv_w:12 share one little endian word
+        body += struct.pack("<IBBbb", bitmap_index | (adv_w << 20), box_w, box_h, ofs_x, ofs_y)
+
+    cmap_ofs = len(body)
+    body += bytearray(20 * len(font["cmaps"]))
+    for i, cmap in enumerate(font["cmaps"]):
+        list_ofs = 0
+        if cmap["unicode_list"]:
+            align4(body)
+            list_ofs = len(body)
+            body += struct.pack("<%dH" % len(cmap["unicode_list"]), *cmap["unicode_list"])
+        ofs_list_ofs = 0
+        if cmap["ofs_list"]:
+            align4(body)
+            ofs_list_ofs = len(body)
+            fmt = "<%dB" if cmap["type"] == 0 else "<%dH"
+            body += struct.pack(fmt % len(cmap["ofs_list"]), *cmap["ofs_list"])
+        struct.pack_into("<IHHHBBII", body, cmap_ofs + 20 * i,
+                         cmap["range_start"], cmap["range_length"], cmap["glyph_id_start"],
+                         cmap["list_length"], cmap["type"], 0, list_ofs, ofs_list_ofs)
+
+    align4(body)
+    kern_ofs = 0
+    kern_type = KERN_NONE
+    left_cnt = right_cnt = pair_cnt = 0
+    kern = font["kern"]
+    if kern:
+        kern_ofs = len(body)
+        kern_type = kern["type"]
+        if kern_type == KERN_CLASSES:
+            left_cnt = kern["left_cnt"]
+            right_cnt = kern["right_cnt"]
+            body += bytes(kern["left"]) + bytes(kern["right"])
+        else:
+            pair_cnt = kern["pair_cnt"]
+            fmt = "<%dH" if kern_type == KERN_PAIRS_16 else "<%dB"
+            body += struct.pack(fmt % len(kern["ids"]), *kern["ids"])
+        body += struct.pack("<%db" % len(kern["values"]), *kern["values"])
+
+    align4(body)
+    bitmap_ofs = len(body)
+    body += font["bitmap"]
+
+    struct.pack_into("<HHBBBBHHIIIII", body, 0,
+                     len(font["glyphs"]), len(font["cmaps"]), font["bpp"], FORMAT_RLE,
+                     left_cnt, right_cnt, font["kern_scale"], kern_type,
+                     glyph_ofs, cmap_ofs, kern_ofs, bitmap_ofs, pair_cnt)
+    align4(body)
+    return body
+
+
+def build_pack(fonts):
+    table_len = len(fonts) * (NAME_LEN + 12)
+    image = bytearray(struct.pack("<4sHH8x", MAGIC, VERSION, len(fonts)))
+    image += bytearray(table_len)
+    for i, font in enumerate(fonts):
+        blob = build_font(font)
+        name = font["name"].encode()
+        if len(name) >= NAME_LEN:
+            sys.exit("%s: font name too long" % font["name"])
+        struct.pack_into("<%dsIII" % NAME_LEN, image, 16 + i * (NAME_LEN + 12),
+                         name, len(image), len(blob), 0)
+        image += blob
+    return image
+
+
+SHIM_HEADER = """/*
+ * Generated by tools/font_pack.py, do not edit.
+ * Glyph data lives in the "fonts" partition and is resolved on first use.
+ */
+#include "font_pack.h"
+"""
+
+SHIM_FONT = """
+static font_pack_font_t pack_{name} = FONT_PACK_FONT_INIT("{name}");
+const lv_font_t {name} = {{
+    .get_glyph_dsc = font_pack_get_glyph_dsc,
+    .get_glyph_bitmap = font_pack_get_glyph_bitmap,
+    .line_height = {line_height},
+    .base_line = {base_line},
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = {underline_position},
+    .underline_thickness = {underline_thickness},
+    .dsc = &pack_{name},
+    .fallback = NULL,
+    .user_data = NULL,
+}};
+"""
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack LVGL fonts for the fonts partition")
+    parser.add_argument("-o", "--output", required=True, help="binary image")
+    parser.add_argument("-c", "--source", required=True, help="generated C file with the lv_font_t objects")
+    parser.add_argument("fonts", nargs="+")
+    args = parser.parse_args()
+
+    fonts = [parse_font(p) for p in args.fonts]
+    image = build_pack(fonts)
+    with open(args.output, "wb") as f:
+        f.write(image)
+
+    shim = SHIM_HEADER + "".join(SHIM_FONT.format(**font) for font in fonts)
+    # Only touch the C file when it changed, so the app is not rebuilt needlessly
+    if not os.path.exists(args.source) or open(args.source).read() != shim:
+        with open(args.source, "w") as f:
+            f.write(shim)
+
+    print("font pack: %d fonts, %d bytes" % (len(fonts), len(image)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""
+Convert 1 bpp LVGL font sources produced by lv_font_conv (--no-compress)
+to run-length encoded glyph bitmaps decoded by main/font_rle.c.
+
+Each glyph is stored as alternating pixel runs, starting with background.
+A run byte of 255 adds 255 pixels and continues the same run.
+
+    python3 tools/font_rle.py main/fonts/*.c
+
+--reference writes the CRC32 of every raw glyph bitmap of the sources
+instead, run it on the fonts before conversion. test/host/test_font_rle.c
+checks the decoder against that table.
+
+    python3 tools/font_rle.py --reference test/host/font_rle_reference.h main/fonts/*.c
+"""
+import os
+import re
+import sys
+import zlib
+
+MARKER = "font_rle_get_glyph_bitmap"
+
+
+def encode_runs(bits):
+    out = bytearray()
+    cur = 0
+    i = 0
+    n = len(bits)
+    while i < n:
+        j = i
+        while j < n and bits[j] == cur:
+            j += 1
+        run = j - i
+        while run >= 255:
+            out.append(255)
+            run -= 255
+        out.append(run)
+        cur ^= 1
+        i = j
+    return out
+
+
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), 8):
+        lines.append("    " + ", ".join("0x%x" % b for b in data[i:i + 8]) + ",")
+    return lines
+
+
+DSC_RE = re.compile(r"\{\.bitmap_index = (\d+), (\.adv_w = \d+, \.box_w = (\d+), \.box_h = (\d+),)")
+
+
+def parse(path):
+    """Source, bitmap match, raw bitmap bytes and glyph descriptors of an unconverted font."""
+    src = open(path).read()
+    if MARKER in src:
+        print("%s: already converted" % path)
+        return None
+
+    m = re.search(r"\.bpp = (\d+),", src)
+    if not m or m.group(1) != "1":
+        print("%s: only 1 bpp fonts are supported" % path)
+        return None
+
+    bm = re.search(r"(glyph_bitmap\[\] = \{\n)(.*?)(\n\};)", src, re.S)
+    raw = bytes(int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", re.sub(r"/\*.*?\*/", "", bm.group(2))))
+    return src, bm, raw, DSC_RE.findall(src)
+
+
+def convert(path):
+    parsed = parse(path)
+    if not parsed:
+        return None
+    src, bm, raw, glyphs = parsed
+    names = re.findall(r"/\* (U\+[0-9A-F]+ .*?) \*/", bm.group(2))
+
+    out = bytearray()
+    lines = []
+    index = []
+    for gid, (bitmap_index, _, w, h) in enumerate(glyphs):
+        w = int(w)
+        h = int(h)
+        index.append(len(out))
+        if gid == 0:
+            continue
+        if lines:
+            lines.append("")
+        lines.append("    /* %s */" % names.pop(0))
+        if w * h == 0:
+            continue
+        start = int(bitmap_index)
+        packed = raw[start:start + (w * h + 7) // 8]
+        bits = [(packed[k >> 3] >> (7 - (k & 7))) & 1 for k in range(w * h)]
+        enc = encode_runs(bits)
+        lines += format_bytes(enc)
+        out += enc
+    for i in range(len(lines) - 1, -1, -1):
+        if lines[i].endswith(","):
+            lines[i] = lines[i][:-1]
+            break
+
+    src = src[:bm.start(2)] + "\n".join(lines) + src[bm.end(2):]
+
+    it = iter(index)
+    src = DSC_RE.sub(lambda mm: "{.bitmap_index = %d, %s" % (next(it), mm.group(2)), src)
+
+    src = src.replace("#include \"lvgl.h\"\n", "#include \"lvgl.h\"\n#include \"font_rle.h\"\n", 1)
+    src = src.replace(".get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,", ".get_glyph_bitmap = font_rle_get_glyph_bitmap,", 1)
+    src = re.sub(r"( \* Opts: .*\n)", r"\1 * Post-processed with tools/font_rle.py (run-length glyph bitmaps)\n", src, count=1)
+
+    open(path, "w").write(src)
+    return len(raw), len(out)
+
+
+def reference(out_path, paths):
+    lines = [
+        "// Generated by tools/font_rle.py --reference from the lv_font_conv output, do not edit",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "#include \"lvgl.h\"",
+        "",
+    ]
+    fonts = []
+    for path in paths:
+        parsed = parse(path)
+        if not parsed:
+            continue
+        raw = parsed[2]
+        name = os.path.splitext(os.path.basename(path))[0]
+        crcs = []
+        for bitmap_index, _, w, h in parsed[3][1:]:
+            start = int(bitmap_index)
+            crcs.append(zlib.crc32(raw[start:start + (int(w) * int(h) + 7) // 8]))
+        lines.append("extern const lv_font_t %s;" % name)
+        lines.append("static const uint32_t %s_crc[] = {" % name)
+        for i in range(0, len(crcs), 6):
+            lines.append("    " + ", ".join("0x%08x" % c for c in crcs[i:i + 6]) + ",")
+        lines.append("};")
+        lines.append("")
+        fonts.append((name, len(crcs), len(raw)))
+
+    lines.append("// Glyph ids 1..glyphs, raw_bytes is the uncompressed glyph_bitmap[]")
+    lines.append("static const struct {")
+    lines.append("    const lv_font_t *font;")
+    lines.append("    const char *name;")
+    lines.append("    uint16_t glyphs;")
+    lines.append("    uint32_t raw_bytes;")
+    lines.append("    const uint32_t *crc;")
+    lines.append("} font_rle_reference[] = {")
+    for name, count, size in fonts:
+        lines.append("    {&%s, \"%s\", %d, %d, %s_crc}," % (name, name, count, size, name))
+    lines.append("};")
+    open(out_path, "w").write("\n".join(lines) + "\n")
+    print("%s: %d fonts" % (out_path, len(fonts)))
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    if sys.argv[1] == "--reference":
+        reference(sys.argv[2], sys.argv[3:])
+        return
+    total_raw = total_rle = 0
+    for path in sys.argv[1:]:
+        res = convert(path)
+        if res:
+            raw, rle = res
+            total_raw += raw
+            total_rle += rle
+            print("%s: %d -> %d bytes" % (path, raw, rle))
+    if total_raw:
+        print("total: %d -> %d bytes (%d%%)" % (total_raw, total_rle, total_rle * 100 // total_raw))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""
+Convert a PNG into the run-length encoded boot splash shown by
+main/boot_splash.c before LVGL is up. Only the standard library is needed.
+
+    python3 tools/png2splash.py images/boot_splash.png -o boot_splash.bin
+
+Image layout (little endian):
+
+    header    magic "LSPL", u16 width, u16 height, u16 background,
+              u16 flags, u32 payload size
+    payload   packets over the row-major pixels, runs may cross rows:
+              0x80 | (n - 1), pixel        n copies of pixel (n <= 128)
+              n - 1, pixel * n              n literal pixels (n <= 128)
+
+Pixels and the background are RGB565 in the byte order the panels take,
+swapped by default to match LV_COLOR_16_SWAP.
+"""
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = b"LSPL"
+FLAG_SWAPPED = 0x01
+MAX_PACKET = 128
+
+
+def read_png(path):
+    data = open(path, "rb").read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: not a PNG file" % path)
+    pos = 8
+    idat = b""
+    palette = None
+    trns = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    if depth != 8 or interlace:
+        sys.exit("%s: only 8 bit, non interlaced PNG is supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else b if pb <= pc else c
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if ctype == 0:
+                pixels.append((px[0], px[0], px[0], 255))
+            elif ctype == 2:
+                pixels.append((px[0], px[1], px[2], 255))
+            elif ctype == 3:
+                r, g, b = palette[px[0]]
+                a = trns[px[0]] if trns and px[0] < len(trns) else 255
+                pixels.append((r, g, b, a))
+            elif ctype == 4:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            else:
+                pixels.append(tuple(px))
+    return width, height, pixels
+
+
+def rgb565(r, g, b, swap):
+    v = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+    return ((v >> 8) | (v << 8)) & 0xFFFF if swap else v
+
+
+def encode(pixels):
+    out = bytearray()
+    i = 0
+    n = len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_PACKET and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            out += struct.pack("<BH", 0x80 | (run - 1), pixels[i])
+            i += run
+            continue
+        # Literal packet until the next run of at least three pixels
+        j = i
+        while j < n and j - i < MAX_PACKET:
+            if j + 2 < n and pixels[j] == pixels[j + 1] == pixels[j + 2]:
+                break
+            j += 1
+        out.append(j - i - 1)
+        out += struct.pack("<%dH" % (j - i), *pixels[i:j])
+        i = j
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a PNG to the boot splash format")
+    parser.add_argument("image")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("--bg", default="000000", help="background and alpha blend colour, RRGGBB")
+    parser.add_argument("--no-swap", action="store_true", help="keep RGB565 in native byte order")
+    args = parser.parse_args()
+
+    swap = not args.no_swap
+    bg = tuple(int(args.bg[i:i + 2], 16) for i in (0, 2, 4))
+    width, height, rgba = read_png(args.image)
+
+    pixels = []
+    for r, g, b, a in rgba:
+        r = (r * a + bg[0] * (255 - a)) // 255
+        g = (g * a + bg[1] * (255 - a)) // 255
+        b = (b * a + bg[2] * (255 - a)) // 255
+        pixels.append(rgb565(r, g, b, swap))
+
+    payload = encode(pixels)
+    header = struct.pack("<4sHHHHI", MAGIC, width, height, rgb565(*bg, swap),
+                         FLAG_SWAPPED if swap else 0, len(payload))
+    with open(args.output, "wb") as f:
+        f.write(header + payload)
+
+    print("boot splash: %dx%d, %d -> %d bytes" % (width, height, width * height * 2, len(payload)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Decode the event trace printed by trace_ring_export() (console command
+"tracebin") from a captured serial log. Only the standard library is needed.
+
+    python3 tools/trace_decode.py monitor.log
+    python3 tools/trace_decode.py monitor.log --chrome trace.json
+
+Block layout, one record per line as hex of the little endian struct:
+
+    --- trace_ring <record size> <count> ---
+    u32 seq, u32 time_us, u8 type, u8 arg, i16 a, i16 b, i16 c, u32 d
+    --- end trace_ring ---
+
+Timestamps are the low 32 bits of esp_timer and are unwrapped here. With
+--chrome, flushes and I2C transactions become duration events, touch
+samples and gestures instant events, for chrome://tracing or Perfetto.
+"""
+import argparse
+import json
+import re
+import struct
+import sys
+
+RECORD = struct.Struct("<IIBBhhhI")
+BEGIN = re.compile(r"--- trace_ring (\d+) (\d+) ---")
+END = "--- end trace_ring ---"
+
+TOUCH, FLUSH_START, FLUSH_END, I2C, GESTURE = 1, 2, 3, 4, 5
+
+
+def read_blocks(path):
+    """Return the records of the last complete block in the log."""
+    blocks = []
+    records = None
+    for line in open(path, errors="replace"):
+        line = line.strip()
+        m = BEGIN.search(line)
+        if m:
+            if int(m.group(1)) != RECORD.size:
+                sys.exit("record size %s, this decoder reads %d" % (m.group(1), RECORD.size))
+            records = []
+            continue
+        if records is None:
+            continue
+        if END in line:
+            blocks.append(records)
+            records = None
+            continue
+        hexdata = re.search(r"[0-9a-f]{%d}" % (RECORD.size * 2), line)
+        if hexdata:
+            records.append(RECORD.unpack(bytes.fromhex(hexdata.group(0))))
+    if not blocks:
+        sys.exit("%s: no trace_ring block found" % path)
+    return blocks[-1]
+
+
+def unwrap(records):
+    out = []
+    base = 0
+    prev = None
+    for seq, t, kind, arg, a, b, c, d in records:
+        if prev is not None and t < prev and prev - t > 0x80000000:
+            base += 1 << 32
+        prev = t
+        out.append((seq, base + t, kind, arg, a, b, c, d))
+    return out
+
+
+def describe(kind, arg, a, b, c, d):
+    if kind == TOUCH:
+        return "touch   x %d y %d points %d type %d" % (a, b, c, arg)
+    if kind == FLUSH_START:
+        return "flush   %d,%d %dx%d" % (a, b, c, d)
+    if kind == FLUSH_END:
+        return "flushed"
+    if kind == I2C:
+        return "i2c     0x%02x reg 0x%02x len %d err 0x%x %d us" % (arg, a & 0xFF, b, c & 0xFFFF, d)
+    if kind == GESTURE:
+        return "gesture %d at %d,%d value %d" % (arg, a, b, c)
+    return "type %d %d %d %d %d %d" % (kind, arg, a, b, c, d)
+
+
+def print_text(records):
+    lost = 0
+    start = records[0][1] if records else 0
+    flush_at = None
+    for i, (seq, t, kind, arg, a, b, c, d) in enumerate(records):
+        if i and seq != records[i - 1][0] + 1:
+            lost += seq - records[i - 1][0] - 1
+        extra = ""
+        if kind == FLUSH_START:
+            flush_at = t
+        elif kind == FLUSH_END and flush_at is not None:
+            extra = " (%d us)" % (t - flush_at)
+            flush_at = None
+        print("%10.3f ms  %s%s" % ((t - start) / 1000.0, describe(kind, arg, a, b, c, d), extra))
+    print("%d records, %d lost to overwrite or in flight" % (len(records), lost))
+
+
+def chrome(records):
+    events = [{"ph": "M", "name": "thread_name", "pid": 1, "tid": tid, "args": {"name": name}}
+              for tid, name in ((1, "touch"), (2, "flush"), (3, "i2c"))]
+    flush = None
+    for seq, t, kind, arg, a, b, c, d in records:
+        if kind == TOUCH:
+            events.append({"ph": "i", "s": "t", "pid": 1, "tid": 1, "ts": t, "name": "touch",
+                           "args": {"x": a, "y": b, "points": c}})
+        elif kind == GESTURE:
+            events.append({"ph": "i", "s": "t", "pid": 1, "tid": 1, "ts": t, "name": "gesture %d" % arg,
+                           "args": {"x": a, "y": b, "value": c}})
+        elif kind == FLUSH_START:
+            flush = (t, a, b, c, d)
+        elif kind == FLUSH_END and flush:
+            ts, x, y, w, h = flush
+            events.append({"ph": "X", "pid": 1, "tid": 2, "ts": ts, "dur": t - ts, "name": "flush",
+                           "args": {"x": x, "y": y, "w": w, "h": h}})
+            flush = None
+        elif kind == I2C:
+            events.append({"ph": "X", "pid": 1, "tid": 3, "ts": t, "dur": d, "name": "i2c 0x%02x" % arg,
+                           "args": {"reg": a & 0xFF, "len": b, "err": c}})
+    return {"displayTimeUnit": "ms", "traceEvents": events}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode a trace_ring dump")
+    parser.add_argument("log", help="serial log holding a trace_ring block")
+    parser.add_argument("--chrome", metavar="JSON", help="write Chrome trace event JSON instead of text")
+    args = parser.parse_args()
+
+    records = unwrap(read_blocks(args.log))
+    if args.chrome:
+        with open(args.chrome, "w") as f:
+            json.dump(chrome(records), f)
+        print("trace: %d records -> %s" % (len(records), args.chrome))
+    else:
+        print_text(records)
+
+
+if __name__ == "__main__":
+    main()